@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdlib>
+
+namespace eMU
+{
+namespace bt
+{
+namespace env
+{
+
+class AllocationCounter
+{
+public:
+    AllocationCounter();
+
+    void restart();
+    size_t getNumberOfAllocations() const;
+
+private:
+    size_t start_;
+};
+
+}
+}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+
+namespace eMU
+{
+namespace bt
+{
+namespace env
+{
+
+class Stopwatch
+{
+public:
+    Stopwatch();
+
+    void restart();
+    double getElapsedSeconds() const;
+
+    // time between pause and resume is not counted
+    void pause();
+    void resume();
+
+    void report(const std::string &name, size_t operations, size_t bytes = 0) const;
+
+private:
+    std::chrono::steady_clock::time_point start_;
+    std::chrono::steady_clock::duration accumulated_;
+    bool paused_;
+};
+
+}
+}
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <core/common/logging.hpp>
+
+#include <boost/noncopyable.hpp>
+#include <boost/thread.hpp>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace eMU
+{
+namespace core
+{
+namespace common
+{
+
+class LogRing;
+
+// Every thread gets its own single producer ring of log slots, background writer drains them and passes
+// formatted lines to boost log sinks. Producers never lock, registration of a ring is the only shared step.
+// Instance lives until exit, then writer is stopped and remaining records are written synchronously.
+class AsyncLogger: boost::noncopyable
+{
+public:
+    static AsyncLogger& getInstance();
+
+    static std::string format(const LogSlot &slot);
+    static void write(const LogSlot &slot);
+
+    ~AsyncLogger();
+
+    LogSlot* acquire();
+    void commit();
+
+    // blocks until records queued so far are written
+    void flush();
+    void stop();
+
+    uint64_t getNumberOfWrittenRecords() const;
+    uint64_t getNumberOfSynchronousRecords() const;
+
+    void countSynchronousRecord();
+
+private:
+    static AsyncLogger* createInstance();
+
+    AsyncLogger();
+
+    LogRing& getThreadRing();
+    void work();
+    size_t drain();
+
+    boost::thread writer_;
+    std::mutex mutex_;
+    std::condition_variable stopped_;
+    std::vector<std::shared_ptr<LogRing>> rings_;
+    std::atomic<bool> running_;
+
+    std::atomic<uint64_t> numberOfWrittenRecords_;
+    std::atomic<uint64_t> numberOfSynchronousRecords_;
+};
+
+}
+}
+}
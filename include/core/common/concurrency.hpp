@@ -1,32 +1,60 @@
-#pragma once
-
-#include <core/common/asio.hpp>
-
-#include <boost/thread.hpp>
-
-namespace eMU
-{
-namespace core
-{
-namespace common
-{
-
-class Concurrency
-{
-public:
-    Concurrency(asio::io_service &ioService, size_t maxNumberOfThreads);
-
-    void start();
-    void join();
-
-private:
-    Concurrency();
-
-    asio::io_service &ioService_;
-    size_t maxNumberOfThreads_;
-    boost::thread_group threads_;
-};
-
-}
-}
-}
+#pragma once
+
+#include <core/common/asio.hpp>
+
+#include <boost/thread.hpp>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace eMU
+{
+namespace core
+{
+namespace common
+{
+
+class Concurrency
+{
+public:
+    enum class Model
+    {
+        SHARED_IO_SERVICE,
+        IO_SERVICE_PER_THREAD
+    };
+
+    Concurrency(asio::io_service &ioService, size_t maxNumberOfThreads);
+
+    // In IO_SERVICE_PER_THREAD model ioService becomes the first loop, the remaining ones are owned by Concurrency.
+    // Every loop is run by exactly one thread pinned to its own core.
+    Concurrency(asio::io_service &ioService, size_t maxNumberOfThreads, Model model);
+    ~Concurrency();
+
+    void start();
+    void join();
+    void stop();
+
+    Model getModel() const;
+    size_t getNumberOfIoServices() const;
+    asio::io_service& getIoService(size_t index);
+    asio::io_service& getNextIoService();
+
+private:
+    Concurrency();
+
+    void run(size_t index);
+
+    asio::io_service &ioService_;
+    size_t maxNumberOfThreads_;
+    Model model_;
+    boost::thread_group threads_;
+
+    std::vector<std::unique_ptr<asio::io_service>> ownedIoServices_;
+    std::vector<asio::io_service*> ioServices_;
+    std::vector<std::unique_ptr<asio::io_service::work>> works_;
+    std::atomic<size_t> nextIoService_;
+};
+
+}
+}
+}
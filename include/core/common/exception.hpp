@@ -1,19 +1,19 @@
-#pragma once
-
-#include <sstream>
-#include <string>
-
-namespace eMU
-{
-namespace core
-{
-namespace common
-{
-
-class Exception
-{
-};
-
-}
-}
-}
+#pragma once
+
+#include <sstream>
+#include <string>
+
+namespace eMU
+{
+namespace core
+{
+namespace common
+{
+
+class Exception
+{
+};
+
+}
+}
+}
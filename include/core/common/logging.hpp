@@ -1,5 +1,134 @@
-#pragma once
-
-#include <boost/log/trivial.hpp>
-
-#define eMU_LOG(severity) BOOST_LOG_TRIVIAL(severity) << "[" << __FILE__ << ":" << __LINE__ << "] "
+#pragma once
+
+#include <boost/log/trivial.hpp>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <stdint.h>
+
+// Records below this severity are compiled out together with evaluation of their arguments.
+#ifndef eMU_LOG_MIN_SEVERITY
+#define eMU_LOG_MIN_SEVERITY trace
+#endif
+
+#define eMU_LOG(severity) \
+    (::boost::log::trivial::severity < ::boost::log::trivial::eMU_LOG_MIN_SEVERITY) ? (void)0 : \
+    ::eMU::core::common::LogRecordVoidify() & \
+    ::eMU::core::common::LogRecord(::boost::log::trivial::severity, __FILE__, __LINE__)
+
+namespace eMU
+{
+namespace core
+{
+namespace common
+{
+
+enum class LogArgumentType: uint8_t
+{
+    SIGNED,
+    UNSIGNED,
+    FLOATING,
+    CHARACTER,
+    STRING
+};
+
+// Single record in binary form, arguments are stored as type tag followed by value.
+struct LogSlot
+{
+    static const size_t kDataSize = 224;
+
+    boost::log::trivial::severity_level severity_;
+    const char *file_;
+    int line_;
+    uint16_t size_;
+    bool truncated_;
+    uint8_t data_[kDataSize];
+};
+
+template<typename T>
+struct LogArgumentTraits
+{
+    static const bool kCharacter = std::is_integral<T>::value && sizeof(T) == 1 && !std::is_same<T, bool>::value;
+    static const bool kSigned = (std::is_integral<T>::value && std::is_signed<T>::value) || std::is_enum<T>::value;
+    static const bool kUnsigned = std::is_integral<T>::value || (std::is_class<T>::value && std::is_convertible<T, unsigned long long>::value);
+
+    static const LogArgumentType kType = kCharacter ? LogArgumentType::CHARACTER :
+                                         kSigned ? LogArgumentType::SIGNED :
+                                         kUnsigned ? LogArgumentType::UNSIGNED :
+                                         std::is_floating_point<T>::value ? LogArgumentType::FLOATING : LogArgumentType::STRING;
+};
+
+// Arguments are written to ring of calling thread and formatted later by background writer of AsyncLogger.
+// Types without binary form (e.g. endpoints) are formatted in place. When ring is full record is written synchronously.
+class LogRecord
+{
+public:
+    LogRecord(boost::log::trivial::severity_level severity, const char *file, int line);
+    ~LogRecord();
+
+    LogRecord& operator<<(const char *value);
+    LogRecord& operator<<(const std::string &value);
+
+    template<typename T>
+    LogRecord& operator<<(const T &value)
+    {
+        this->append(value, std::integral_constant<LogArgumentType, LogArgumentTraits<T>::kType>());
+        return *this;
+    }
+
+private:
+    LogRecord(const LogRecord&);
+    LogRecord& operator=(const LogRecord&);
+
+    template<typename T>
+    void append(const T &value, std::integral_constant<LogArgumentType, LogArgumentType::SIGNED>)
+    {
+        int64_t number = static_cast<int64_t>(value);
+        this->appendValue(LogArgumentType::SIGNED, &number, sizeof(number));
+    }
+
+    template<typename T>
+    void append(const T &value, std::integral_constant<LogArgumentType, LogArgumentType::UNSIGNED>)
+    {
+        uint64_t number = static_cast<uint64_t>(value);
+        this->appendValue(LogArgumentType::UNSIGNED, &number, sizeof(number));
+    }
+
+    template<typename T>
+    void append(const T &value, std::integral_constant<LogArgumentType, LogArgumentType::FLOATING>)
+    {
+        double number = static_cast<double>(value);
+        this->appendValue(LogArgumentType::FLOATING, &number, sizeof(number));
+    }
+
+    template<typename T>
+    void append(const T &value, std::integral_constant<LogArgumentType, LogArgumentType::CHARACTER>)
+    {
+        char character = static_cast<char>(value);
+        this->appendValue(LogArgumentType::CHARACTER, &character, sizeof(character));
+    }
+
+    template<typename T>
+    void append(const T &value, std::integral_constant<LogArgumentType, LogArgumentType::STRING>)
+    {
+        std::ostringstream stream;
+        stream << value;
+        this->appendString(stream.str().data(), stream.str().length());
+    }
+
+    void appendValue(LogArgumentType type, const void *value, size_t size);
+    void appendString(const char *value, size_t length);
+
+    LogSlot *slot_;
+    LogSlot localSlot_;
+};
+
+// Turns record expression into void, so it fits into conditional operator of eMU_LOG.
+struct LogRecordVoidify
+{
+    void operator&(const LogRecord&) {}
+};
+
+}
+}
+}
@@ -1,7 +1,7 @@
-#pragma once
-
-#ifdef eMU_UT
-#define MOCKABLE virtual
-#else
-#define MOCKABLE
-#endif
+#pragma once
+
+#ifdef eMU_UT
+#define MOCKABLE virtual
+#else
+#define MOCKABLE
+#endif
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <boost/noncopyable.hpp>
+#include <atomic>
+#include <stdint.h>
+#include <cstdlib>
+
+namespace eMU
+{
+namespace core
+{
+namespace metrics
+{
+
+// Monotonic counter sharded by thread, each shard has own cache line so incrementing threads do not share it.
+class Counter: boost::noncopyable
+{
+public:
+    static const size_t kNumberOfShards = 16;
+
+    Counter();
+
+    void increment(uint64_t value = 1)
+    {
+        shards_[getThreadShard()].value_.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    uint64_t getValue() const;
+
+private:
+    struct Shard
+    {
+        Shard():
+            value_(0) {}
+
+        std::atomic<uint64_t> value_;
+        char padding_[64 - sizeof(std::atomic<uint64_t>)];
+    };
+
+    static size_t getThreadShard();
+
+    Shard shards_[kNumberOfShards];
+};
+
+}
+}
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <core/metrics/registry.hpp>
+
+#include <boost/asio.hpp>
+#include <boost/noncopyable.hpp>
+#include <atomic>
+#include <memory>
+
+namespace eMU
+{
+namespace core
+{
+namespace metrics
+{
+
+// Serves registry in Prometheus text format on loopback interface. Every connection gets one response to
+// its first request, whatever path it asks for, and is closed afterwards.
+// Works on real asio only, so like timers it is created in main.
+class Exporter: boost::noncopyable
+{
+public:
+    Exporter(boost::asio::io_service &ioService, uint16_t port, Registry &registry);
+
+    void queueAccept();
+    uint64_t getNumberOfScrapes() const;
+
+private:
+    struct Scrape;
+
+    void acceptHandler(std::shared_ptr<Scrape> scrape, const boost::system::error_code &errorCode);
+    void requestHandler(std::shared_ptr<Scrape> scrape, const boost::system::error_code &errorCode);
+
+    boost::asio::io_service &ioService_;
+    boost::asio::ip::tcp::acceptor acceptor_;
+    Registry &registry_;
+    std::atomic<uint64_t> numberOfScrapes_;
+};
+
+}
+}
+}
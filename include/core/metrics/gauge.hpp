@@ -0,0 +1,46 @@
+#pragma once
+
+#include <boost/noncopyable.hpp>
+#include <atomic>
+#include <stdint.h>
+
+namespace eMU
+{
+namespace core
+{
+namespace metrics
+{
+
+class Gauge: boost::noncopyable
+{
+public:
+    Gauge():
+        value_(0) {}
+
+    void set(int64_t value)
+    {
+        value_.store(value, std::memory_order_relaxed);
+    }
+
+    void increment(int64_t value = 1)
+    {
+        value_.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    void decrement(int64_t value = 1)
+    {
+        value_.fetch_sub(value, std::memory_order_relaxed);
+    }
+
+    int64_t getValue() const
+    {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<int64_t> value_;
+};
+
+}
+}
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <boost/noncopyable.hpp>
+#include <atomic>
+#include <stdint.h>
+#include <cstdlib>
+
+namespace eMU
+{
+namespace core
+{
+namespace metrics
+{
+
+// Log-linear buckets in HDR histogram fashion: values below 8 are exact, above that every power of two
+// is split into 8 buckets, so any recorded value is known with relative error below 12.5%.
+class Histogram: boost::noncopyable
+{
+public:
+    static const size_t kSubBucketBits = 3;
+    static const size_t kSubBucketCount = 1 << kSubBucketBits;
+    static const size_t kNumberOfBuckets = (64 - kSubBucketBits + 1) * kSubBucketCount;
+
+    Histogram();
+
+    void record(uint64_t value);
+
+    uint64_t getCount() const;
+    uint64_t getSum() const;
+    uint64_t getMax() const;
+
+    // upper bound of bucket holding given percentile, 0 when nothing was recorded
+    uint64_t getValueAtPercentile(double percentile) const;
+
+    static size_t getBucketIndex(uint64_t value);
+    static uint64_t getBucketUpperBound(size_t index);
+
+private:
+    std::atomic<uint64_t> buckets_[kNumberOfBuckets];
+    std::atomic<uint64_t> count_;
+    std::atomic<uint64_t> sum_;
+    std::atomic<uint64_t> max_;
+};
+
+}
+}
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <core/metrics/counter.hpp>
+#include <core/metrics/gauge.hpp>
+#include <core/metrics/histogram.hpp>
+
+#include <boost/noncopyable.hpp>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace eMU
+{
+namespace core
+{
+namespace metrics
+{
+
+// Metrics are created once, usually at startup, and updated through returned references without locking.
+// Labels are given in exposition form, e.g. stream_id="1234"; the same name and labels yield the same metric.
+// Histograms are exposed as summaries with fixed quantiles.
+class Registry: boost::noncopyable
+{
+public:
+    typedef std::function<int64_t()> Callback;
+
+    static Registry& getInstance();
+
+    Registry();
+
+    Counter& getCounter(const std::string &name, const std::string &help, const std::string &labels = "");
+    Gauge& getGauge(const std::string &name, const std::string &help, const std::string &labels = "");
+    Histogram& getHistogram(const std::string &name, const std::string &help, const std::string &labels = "");
+
+    // gauge read at scrape time, for values owned by other components, e.g. queue depths
+    void addGaugeCallback(const std::string &name, const std::string &help, const Callback &callback, const std::string &labels = "");
+
+    std::string format() const;
+
+private:
+    enum class Type
+    {
+        COUNTER,
+        GAUGE,
+        SUMMARY
+    };
+
+    struct Family
+    {
+        Type type_;
+        std::string help_;
+        std::map<std::string, std::unique_ptr<Counter>> counters_;
+        std::map<std::string, std::unique_ptr<Gauge>> gauges_;
+        std::map<std::string, Callback> callbacks_;
+        std::map<std::string, std::unique_ptr<Histogram>> histograms_;
+    };
+
+    Family& getFamily(const std::string &name, const std::string &help, Type type);
+
+    mutable std::mutex mutex_;
+    std::map<std::string, Family> families_;
+};
+
+}
+}
+}
@@ -1,43 +1,59 @@
-#pragma once
-
-#include <core/common/exception.hpp>
-
-#include <vector>
-#include <stdint.h>
-#include <cstdlib>
-
-namespace eMU
-{
-namespace core
-{
-namespace network
-{
-
-class Payload
-{
-public:                                                       
-    typedef std::vector<uint8_t> Data;
-
-    class SizeOutOfBoundException: public common::Exception {};
-
-    Payload();
-
-    static size_t getMaxSize();
-    size_t getSize() const;
-    void setSize(size_t newSize);
-    void clear();
-    bool empty() const;
-
-    uint8_t& operator[](size_t offset);
-    const uint8_t& operator[](size_t offset) const;
-
-    friend std::ostream& operator<<(std::ostream &out, const Payload &payload);
-
-private:
-    Data data_;
-    size_t size_;
-};
-
-}
-}
-}
+#pragma once
+
+#include <core/common/exception.hpp>
+
+#include <stdint.h>
+#include <cstdlib>
+#include <ostream>
+
+namespace eMU
+{
+namespace core
+{
+namespace network
+{
+
+class Payload
+{
+public:
+    class SizeOutOfBoundException: public common::Exception {};
+
+    Payload();
+    Payload(const Payload &payload);
+    Payload(Payload &&payload);
+    ~Payload();
+
+    Payload& operator=(const Payload &payload);
+    Payload& operator=(Payload &&payload);
+
+    static size_t getMaxSize();
+    static size_t getInlineCapacity();
+
+    size_t getSize() const;
+    void setSize(size_t newSize);
+    size_t getCapacity() const;
+    void reserve(size_t capacity);
+    void clear();
+    bool empty() const;
+
+    uint8_t& operator[](size_t offset);
+    const uint8_t& operator[](size_t offset) const;
+
+    friend std::ostream& operator<<(std::ostream &out, const Payload &payload);
+
+private:
+    static const size_t kInlineCapacity = 256;
+
+    bool isInline() const;
+    void releaseChunk();
+    void moveFrom(Payload &payload);
+
+    uint8_t *data_;
+    size_t size_;
+    size_t capacity_;
+    uint8_t inlineData_[kInlineCapacity];
+};
+
+}
+}
+}
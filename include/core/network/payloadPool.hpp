@@ -0,0 +1,43 @@
+#pragma once
+
+#include <vector>
+#include <stdint.h>
+#include <cstdlib>
+
+namespace eMU
+{
+namespace core
+{
+namespace network
+{
+
+class PayloadPool
+{
+public:
+    static PayloadPool& getThreadInstance();
+    static void release(uint8_t *chunk);
+
+    ~PayloadPool();
+
+    static size_t getChunkSize();
+    static size_t getMaxNumberOfCachedChunks();
+
+    uint8_t* acquire();
+
+    size_t getNumberOfCachedChunks() const;
+    size_t getNumberOfAllocatedChunks() const;
+
+private:
+    PayloadPool();
+    PayloadPool(const PayloadPool&);
+    PayloadPool& operator=(const PayloadPool&);
+
+    void cache(uint8_t *chunk);
+
+    std::vector<uint8_t*> chunks_;
+    size_t numberOfAllocatedChunks_;
+};
+
+}
+}
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <core/network/payload.hpp>
+
+namespace eMU
+{
+namespace core
+{
+namespace network
+{
+
+class ReadBuffer
+{
+public:
+    ReadBuffer();
+
+    static size_t getStreamHeaderSize();
+
+    uint8_t* getFreeSpace();
+    size_t getFreeSpaceSize() const;
+
+    bool insert(size_t bytesTransferred);
+    void compact();
+    void clear();
+
+    size_t getPendingSize() const;
+
+    Payload& getPayload();
+    const Payload& getPayload() const;
+
+private:
+    size_t calculateStreamSize(size_t offset) const;
+
+    Payload payload_;
+    size_t receivedSize_;
+};
+
+}
+}
+}
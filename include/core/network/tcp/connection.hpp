@@ -1,65 +1,69 @@
-#pragma once
-
-#include <core/network/writeBuffer.hpp>
-#include <core/common/mockable.hpp>
-#include <core/common/asio.hpp>
-
-#include <boost/noncopyable.hpp>
-#include <functional>
-
-namespace eMU
-{
-namespace core
-{
-namespace network
-{
-namespace tcp
-{
-
-class Protocol;
-
-class Connection: boost::noncopyable, public std::enable_shared_from_this<Connection>
-{
-public:
-    typedef std::shared_ptr<Connection> Pointer;
-
-    Connection(asio::io_service &ioService, Protocol& protocol);
-    virtual ~Connection();
-
-    Payload& getReadPayload();
-    void accept();
-
-    MOCKABLE void disconnect();
-    MOCKABLE void close();
-    MOCKABLE void send(const Payload &payload);
-    MOCKABLE void queueReceive();
-    MOCKABLE bool connect(const boost::asio::ip::tcp::endpoint &endpoint);
-    MOCKABLE bool isOpen() const;
-
-    asio::ip::tcp::socket& getSocket();
-
-    void receiveHandler(const boost::system::error_code &errorCode, size_t bytesTransferred);
-    void sendHandler(const boost::system::error_code &errorCode, size_t bytesTransferred);
-
-    bool operator==(const Connection &connection) const;
-
-private:
-    Connection();
-
-    void queueSend();
-    void errorHandler(const boost::system::error_code &errorCode, const std::string &operationName);
-
-    Protocol &protocol_;
-    asio::ip::tcp::socket socket_;
-
-    Payload readPayload_;
-    WriteBuffer writeBuffer_;
-
-    asio::io_service::strand strand_;
-    bool closeOngoing_;
-};
-
-}
-}
-}
-}
+#pragma once
+
+#include <core/network/readBuffer.hpp>
+#include <core/network/writeQueue.hpp>
+#include <core/common/mockable.hpp>
+#include <core/common/asio.hpp>
+
+#include <boost/noncopyable.hpp>
+#include <functional>
+
+namespace eMU
+{
+namespace core
+{
+namespace network
+{
+namespace tcp
+{
+
+class Protocol;
+
+class Connection: boost::noncopyable, public std::enable_shared_from_this<Connection>
+{
+public:
+    typedef std::shared_ptr<Connection> Pointer;
+
+    Connection(asio::io_service &ioService, Protocol& protocol);
+    virtual ~Connection();
+
+    Payload& getReadPayload();
+    void accept();
+
+    MOCKABLE void disconnect();
+    MOCKABLE void close();
+    MOCKABLE void send(const Payload &payload);
+    MOCKABLE void queueReceive();
+    MOCKABLE bool connect(const boost::asio::ip::tcp::endpoint &endpoint);
+    MOCKABLE bool isOpen() const;
+    bool isWriteQueueCongested() const;
+
+    asio::ip::tcp::socket& getSocket();
+
+    void receiveHandler(const boost::system::error_code &errorCode, size_t bytesTransferred);
+    void sendHandler(const boost::system::error_code &errorCode, size_t bytesTransferred);
+
+    bool operator==(const Connection &connection) const;
+
+private:
+    Connection();
+
+    void enqueue(const Payload &payload);
+    void queueSend();
+    void errorHandler(const boost::system::error_code &errorCode, const std::string &operationName);
+
+    Protocol &protocol_;
+    asio::ip::tcp::socket socket_;
+
+    ReadBuffer readBuffer_;
+    WriteQueue writeQueue_;
+
+    asio::io_service::strand strand_;
+    bool closeOngoing_;
+    bool writeQueueCongested_;
+};
+
+}
+}
+}
+}
@@ -1,39 +1,56 @@
-#pragma once
-
-#include <core/common/factory.hpp>
-#include <core/network/tcp/connection.hpp>
-#include <core/network/tcp/protocol.hpp>
-#include <core/common/asio.hpp>
-
-#include <functional>
-
-namespace eMU
-{
-namespace core
-{
-namespace network
-{
-namespace tcp
-{
-
-class ConnectionsAcceptor
-{
-public:
-    ConnectionsAcceptor(asio::io_service &ioService, uint16_t port, Protocol &protocol);
-    virtual ~ConnectionsAcceptor();
-
-    void queueAccept();
-    asio::ip::tcp::acceptor& getAcceptor();
-
-private:
-    void acceptHandler(Connection::Pointer connection, const boost::system::error_code &errorCode);
-
-    asio::ip::tcp::acceptor acceptor_;
-    asio::io_service::strand strand_;
-    Protocol &protocol_;
-};
-
-}
-}
-}
-}
+#pragma once
+
+#include <core/common/factory.hpp>
+#include <core/network/tcp/connection.hpp>
+#include <core/network/tcp/protocol.hpp>
+#include <core/common/asio.hpp>
+
+#include <functional>
+#include <atomic>
+
+namespace eMU
+{
+namespace core
+{
+namespace network
+{
+namespace tcp
+{
+
+class ConnectionsAcceptor
+{
+public:
+    typedef std::function<asio::io_service&()> IoServiceSelector;
+
+    ConnectionsAcceptor(asio::io_service &ioService, uint16_t port, Protocol &protocol);
+
+    // Several acceptors may listen on the same port when reusePort is set, kernel spreads incoming connections among them.
+    ConnectionsAcceptor(asio::io_service &ioService, uint16_t port, Protocol &protocol, bool reusePort, size_t numberOfPendingAccepts);
+    virtual ~ConnectionsAcceptor();
+
+    void queueAccept();
+    void setIoServiceSelector(const IoServiceSelector &ioServiceSelector);
+    asio::ip::tcp::acceptor& getAcceptor();
+
+    uint64_t getNumberOfAcceptedConnections() const;
+    uint64_t getNumberOfAcceptErrors() const;
+
+private:
+    void listen(uint16_t port, bool reusePort);
+    void queueSingleAccept();
+    void acceptHandler(Connection::Pointer connection, const boost::system::error_code &errorCode);
+
+    asio::ip::tcp::acceptor acceptor_;
+    asio::io_service::strand strand_;
+    Protocol &protocol_;
+    IoServiceSelector ioServiceSelector_;
+    size_t numberOfPendingAccepts_;
+
+    std::atomic<uint64_t> numberOfAcceptedConnections_;
+    std::atomic<uint64_t> numberOfAcceptErrors_;
+};
+
+}
+}
+}
+}
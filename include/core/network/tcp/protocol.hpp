@@ -1,29 +1,41 @@
-#pragma once
-
-#include <core/network/tcp/connection.hpp>
-#include <boost/noncopyable.hpp>
-
-namespace eMU
-{
-namespace core
-{
-namespace network
-{
-namespace tcp
-{
-
-class Protocol: boost::noncopyable
-{
-public:
-    virtual ~Protocol();
-    virtual bool attach(Connection::Pointer connection);
-    virtual void detach(Connection::Pointer connection);
-    virtual bool dispatch(Connection::Pointer connection);
-
-    virtual void shutdown();
-};
-
-}
-}
-}
-}
+#pragma once
+
+#include <core/network/tcp/connection.hpp>
+#include <boost/noncopyable.hpp>
+
+namespace eMU
+{
+namespace core
+{
+namespace network
+{
+namespace tcp
+{
+
+class Protocol: boost::noncopyable
+{
+public:
+    Protocol();
+    virtual ~Protocol();
+    virtual bool attach(Connection::Pointer connection);
+    virtual void detach(Connection::Pointer connection);
+    virtual bool dispatch(Connection::Pointer connection);
+
+    virtual void writeQueueCongested(Connection::Pointer connection);
+    virtual void writeQueueDrained(Connection::Pointer connection);
+
+    virtual void shutdown();
+
+    void setWriteQueueWatermarks(size_t highWatermark, size_t lowWatermark);
+    size_t getWriteQueueHighWatermark() const;
+    size_t getWriteQueueLowWatermark() const;
+
+private:
+    size_t writeQueueHighWatermark_;
+    size_t writeQueueLowWatermark_;
+};
+
+}
+}
+}
+}
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <core/network/tcp/networkUser.hpp>
+#include <core/common/exception.hpp>
+
+#include <boost/noncopyable.hpp>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <mutex>
+
+namespace eMU
+{
+namespace core
+{
+namespace network
+{
+namespace tcp
+{
+
+// Users are indexed by hash and by connection, each index split into shards guarded by their own lock.
+// References returned by find() stay valid until the user is destroyed, which happens on its connection strand.
+template<typename UserType>
+class UsersFactory: boost::noncopyable
+{
+public:
+    typedef std::vector<UserType*> ObjectsContainer;
+
+    class ObjectNotFoundException: public common::Exception {};
+
+    UsersFactory():
+        numberOfUsers_(0) {}
+
+    static size_t getNumberOfShards()
+    {
+        return kNumberOfShards;
+    }
+
+    UserType& create(Connection::Pointer connection)
+    {
+        std::unique_ptr<UserType> user(new UserType(connection));
+        UserType &userReference = *user;
+
+        HashShard &hashShard = this->getShard(hashShards_, userReference.getHash());
+        {
+            std::lock_guard<std::mutex> lock(hashShard.mutex_);
+            hashShard.users_[userReference.getHash()] = std::move(user);
+        }
+
+        ConnectionShard &connectionShard = this->getShard(connectionShards_, connection.get());
+        {
+            std::lock_guard<std::mutex> lock(connectionShard.mutex_);
+            connectionShard.users_[connection.get()] = &userReference;
+        }
+
+        ++numberOfUsers_;
+
+        return userReference;
+    }
+
+    void destroy(const UserType &user)
+    {
+        NetworkUser::Hash hash = user.getHash();
+        std::unique_ptr<UserType> destroyedUser;
+
+        HashShard &hashShard = this->getShard(hashShards_, hash);
+        {
+            std::lock_guard<std::mutex> lock(hashShard.mutex_);
+
+            typename HashShard::Container::iterator it = hashShard.users_.find(hash);
+
+            if(it == hashShard.users_.end() || it->second.get() != &user)
+            {
+                throw ObjectNotFoundException();
+            }
+
+            destroyedUser = std::move(it->second);
+            hashShard.users_.erase(it);
+        }
+
+        Connection *connection = &destroyedUser->getConnection();
+        ConnectionShard &connectionShard = this->getShard(connectionShards_, connection);
+        {
+            std::lock_guard<std::mutex> lock(connectionShard.mutex_);
+            connectionShard.users_.erase(connection);
+        }
+
+        --numberOfUsers_;
+    }
+
+    UserType& find(NetworkUser::Hash hash)
+    {
+        HashShard &shard = this->getShard(hashShards_, hash);
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+
+        typename HashShard::Container::iterator it = shard.users_.find(hash);
+
+        if(it == shard.users_.end())
+        {
+            throw ObjectNotFoundException();
+        }
+
+        return *(it->second);
+    }
+
+    UserType& find(const Connection::Pointer &connection)
+    {
+        ConnectionShard &shard = this->getShard(connectionShards_, connection.get());
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+
+        typename ConnectionShard::Container::iterator it = shard.users_.find(connection.get());
+
+        if(it == shard.users_.end())
+        {
+            throw ObjectNotFoundException();
+        }
+
+        return *(it->second);
+    }
+
+    bool exists(NetworkUser::Hash hash) const
+    {
+        const HashShard &shard = this->getShard(hashShards_, hash);
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+
+        return shard.users_.count(hash) > 0;
+    }
+
+    bool exists(const Connection::Pointer &connection) const
+    {
+        const ConnectionShard &shard = this->getShard(connectionShards_, connection.get());
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+
+        return shard.users_.count(connection.get()) > 0;
+    }
+
+    size_t size() const
+    {
+        return numberOfUsers_;
+    }
+
+    bool empty() const
+    {
+        return numberOfUsers_ == 0;
+    }
+
+    // snapshot in no particular order, intended for diagnostics and tests
+    ObjectsContainer getObjects() const
+    {
+        ObjectsContainer objects;
+        objects.reserve(numberOfUsers_);
+
+        for(const HashShard &shard : hashShards_)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex_);
+
+            for(const auto &entry : shard.users_)
+            {
+                objects.push_back(entry.second.get());
+            }
+        }
+
+        return objects;
+    }
+
+private:
+    static const size_t kNumberOfShards = 16;
+
+    struct KeyHasher
+    {
+        size_t operator()(NetworkUser::Hash hash) const
+        {
+            return mix(static_cast<size_t>(hash));
+        }
+
+        size_t operator()(const Connection *connection) const
+        {
+            return mix(reinterpret_cast<size_t>(connection));
+        }
+
+        static size_t mix(size_t value)
+        {
+            // keys are heap addresses, so low bits carry no entropy
+            value ^= value >> 33;
+            value *= 0xff51afd7ed558ccdULL;
+            value ^= value >> 33;
+
+            return value;
+        }
+    };
+
+    template<typename KeyType, typename ValueType>
+    struct Shard
+    {
+        typedef std::unordered_map<KeyType, ValueType, KeyHasher> Container;
+
+        mutable std::mutex mutex_;
+        Container users_;
+    };
+
+    typedef Shard<NetworkUser::Hash, std::unique_ptr<UserType>> HashShard;
+    typedef Shard<const Connection*, UserType*> ConnectionShard;
+
+    template<typename ShardType, typename KeyType>
+    static ShardType& getShard(ShardType (&shards)[kNumberOfShards], const KeyType &key)
+    {
+        return shards[KeyHasher()(key) % kNumberOfShards];
+    }
+
+    template<typename ShardType, typename KeyType>
+    static const ShardType& getShard(const ShardType (&shards)[kNumberOfShards], const KeyType &key)
+    {
+        return shards[KeyHasher()(key) % kNumberOfShards];
+    }
+
+    HashShard hashShards_[kNumberOfShards];
+    ConnectionShard connectionShards_[kNumberOfShards];
+    std::atomic<size_t> numberOfUsers_;
+};
+
+}
+}
+}
+}
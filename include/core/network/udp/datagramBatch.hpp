@@ -0,0 +1,55 @@
+#pragma once
+
+#include <core/network/payload.hpp>
+
+#include <boost/asio/ip/udp.hpp>
+#include <boost/noncopyable.hpp>
+#include <sys/socket.h>
+#include <vector>
+
+namespace eMU
+{
+namespace core
+{
+namespace network
+{
+namespace udp
+{
+
+// Moves up to kMaxNumberOfDatagrams datagrams through single recvmmsg/sendmmsg call on nonblocking socket.
+// Calls never wait, datagrams which could not be moved at once are left to asio. Invalid socket moves nothing.
+class DatagramBatch: boost::noncopyable
+{
+public:
+    static const size_t kMaxNumberOfDatagrams = 32;
+
+    DatagramBatch();
+
+    // number of received datagrams, 0 when nothing was queued
+    size_t receive(int socket);
+    Payload& getPayload(size_t index);
+    const boost::asio::ip::udp::endpoint& getEndpoint(size_t index) const;
+
+    // payload is not copied and has to stay untouched until send() returns, false when batch is full
+    bool add(const boost::asio::ip::udp::endpoint &endpoint, const Payload &payload);
+    // number of leading datagrams handed to kernel, batch is cleared afterwards
+    size_t send(int socket);
+
+    size_t size() const;
+    bool empty() const;
+
+private:
+    void prepareHeader(size_t index, void *data, size_t size);
+
+    std::vector<Payload> payloads_;
+    std::vector<boost::asio::ip::udp::endpoint> endpoints_;
+    mmsghdr headers_[kMaxNumberOfDatagrams];
+    iovec vectors_[kMaxNumberOfDatagrams];
+    sockaddr_storage addresses_[kMaxNumberOfDatagrams];
+    size_t size_;
+};
+
+}
+}
+}
+}
@@ -1,30 +1,63 @@
-#pragma once
-
-#include <core/network/writeBuffer.hpp>
-
-#include <boost/asio/ip/udp.hpp>
-#include <map>
-
-namespace eMU
-{
-namespace core
-{
-namespace network
-{
-namespace udp
-{
-
-class WriteBufferFactory
-{
-public:
-    WriteBuffer& get(const boost::asio::ip::udp::endpoint &endpoint);
-    bool erase(const boost::asio::ip::udp::endpoint &endpoint);
-
-private:
-    std::map<boost::asio::ip::udp::endpoint, WriteBuffer> buffers_;
-};
-
-}
-}
-}
-}
+#pragma once
+
+#include <core/network/writeBuffer.hpp>
+
+#include <boost/asio/ip/udp.hpp>
+#include <memory>
+#include <vector>
+#include <stdint.h>
+
+namespace eMU
+{
+namespace core
+{
+namespace network
+{
+namespace udp
+{
+
+// Open addressing table of endpoints with linear probing, buffers live in pool indexed from slots.
+// Erased buffers are cleared and handed to the next endpoint, so their payload chunks are not returned
+// and taken again on every datagram. Returned references stay valid until the endpoint is erased.
+class WriteBufferFactory
+{
+public:
+    WriteBufferFactory();
+
+    WriteBuffer& get(const boost::asio::ip::udp::endpoint &endpoint);
+    bool erase(const boost::asio::ip::udp::endpoint &endpoint);
+
+    size_t size() const;
+    size_t getNumberOfPooledBuffers() const;
+
+private:
+    static const uint32_t kEmptySlot = ~static_cast<uint32_t>(0);
+
+    struct Slot
+    {
+        Slot():
+            hash_(0),
+            bufferIndex_(kEmptySlot) {}
+
+        size_t hash_;
+        uint32_t bufferIndex_;
+    };
+
+    static size_t getHash(const boost::asio::ip::udp::endpoint &endpoint);
+
+    size_t find(const boost::asio::ip::udp::endpoint &endpoint, size_t hash) const;
+    uint32_t acquireBuffer(const boost::asio::ip::udp::endpoint &endpoint);
+    void insertSlot(const Slot &slot);
+    void grow();
+
+    std::vector<Slot> slots_;
+    std::vector<std::unique_ptr<WriteBuffer>> buffers_;
+    std::vector<boost::asio::ip::udp::endpoint> endpoints_;
+    std::vector<uint32_t> freeBuffers_;
+    size_t size_;
+};
+
+}
+}
+}
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <core/network/payload.hpp>
+
+#include <boost/asio/buffer.hpp>
+#include <deque>
+#include <vector>
+
+namespace eMU
+{
+namespace core
+{
+namespace network
+{
+
+class WriteQueue
+{
+public:
+    typedef std::vector<boost::asio::const_buffer> BufferSequence;
+
+    WriteQueue();
+
+    static size_t getMaxNumberOfBuffersPerSend();
+
+    void push(const Payload &payload);
+    const BufferSequence& getBuffers();
+    void consume(size_t bytesTransferred);
+    void clear();
+
+    size_t getSize() const;
+    bool empty() const;
+
+    bool isPending() const;
+    void setPendingState();
+    void clearPendingState();
+
+private:
+    Payload& appendSegment();
+
+    std::deque<Payload> segments_;
+    size_t frontOffset_;
+    size_t size_;
+    bool pending_;
+    BufferSequence buffers_;
+};
+
+}
+}
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <streaming/common/characterListInfo.hpp>
+
+#include <boost/noncopyable.hpp>
+#include <unordered_map>
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include <list>
+
+namespace eMU
+{
+namespace dataserver
+{
+
+// Characters lists of recently seen accounts, evicted in LRU order when memory cap is exceeded and dropped after TTL.
+// Lists are inserted only when no invalidation happened since the generation read before query was executed,
+// so list selected concurrently with character create never overwrites the invalidation.
+class CharactersCache: boost::noncopyable
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    CharactersCache();
+
+    void configure(size_t maxMemorySize, std::chrono::milliseconds timeToLive);
+    bool isEnabled() const;
+
+    bool find(const std::string &accountId, streaming::common::CharacterInfoContainer &characters);
+    uint64_t getGeneration() const;
+    void insert(const std::string &accountId, const streaming::common::CharacterInfoContainer &characters, uint64_t generation);
+    void invalidate(const std::string &accountId);
+
+    size_t size() const;
+    size_t getMemorySize() const;
+
+    uint64_t getNumberOfHits() const;
+    uint64_t getNumberOfMisses() const;
+    uint64_t getNumberOfEvictions() const;
+    uint64_t getNumberOfInvalidations() const;
+
+private:
+    struct Entry
+    {
+        std::string accountId_;
+        streaming::common::CharacterInfoContainer characters_;
+        Clock::time_point expirationTime_;
+        size_t memorySize_;
+    };
+
+    typedef std::list<Entry> EntriesList;
+    typedef std::unordered_map<std::string, EntriesList::iterator> EntriesIndex;
+
+    static std::string makeKey(const std::string &accountId);
+    static size_t calculateMemorySize(const Entry &entry);
+
+    void erase(EntriesIndex::iterator it);
+    void evict();
+
+    mutable std::mutex mutex_;
+    EntriesList entries_;
+    EntriesIndex index_;
+    size_t maxMemorySize_;
+    size_t memorySize_;
+    std::chrono::milliseconds timeToLive_;
+    std::atomic<uint64_t> generation_;
+
+    std::atomic<uint64_t> numberOfHits_;
+    std::atomic<uint64_t> numberOfMisses_;
+    std::atomic<uint64_t> numberOfEvictions_;
+    std::atomic<uint64_t> numberOfInvalidations_;
+};
+
+}
+}
@@ -1,27 +1,35 @@
-#pragma once
-
-#include <protocols/contexts/server.hpp>
-
-#include <dataserver/user.hpp>
-#include <dataserver/database/sqlInterface.hpp>
-
-namespace eMU
-{
-namespace dataserver
-{
-
-class Context: public protocols::contexts::Server<User>
-{
-public:
-    Context(database::SqlInterface &sqlInterface, size_t maxNumberOfUsers);
-
-    database::SqlInterface& getSqlInterface();
-
-private:
-    Context();
-
-    database::SqlInterface &sqlInterface_;
-};
-
-}
-}
+#pragma once
+
+#include <protocols/contexts/server.hpp>
+
+#include <dataserver/user.hpp>
+#include <dataserver/database/sqlInterface.hpp>
+#include <dataserver/database/workersPool.hpp>
+#include <dataserver/charactersCache.hpp>
+#include <dataserver/transactions/charactersListBatchRequest.hpp>
+
+namespace eMU
+{
+namespace dataserver
+{
+
+class Context: public protocols::contexts::Server<User>
+{
+public:
+    Context(database::SqlInterface &sqlInterface, size_t maxNumberOfUsers);
+    Context(const database::WorkersPool::SqlInterfacesContainer &sqlInterfaces, size_t maxNumberOfUsers);
+
+    database::WorkersPool& getDatabaseWorkers();
+    CharactersCache& getCharactersCache();
+    transactions::CharactersListBatchRequest::Batcher& getCharactersListBatcher();
+
+private:
+    Context();
+
+    database::WorkersPool databaseWorkers_;
+    CharactersCache charactersCache_;
+    transactions::CharactersListBatchRequest::Batcher charactersListBatcher_;
+};
+
+}
+}
@@ -23,17 +23,41 @@ public:
     std::string getErrorMessage();
 
     bool executeQuery(std::string query);
+    bool executeStatement(Statement::Id statementId, const Statement::Parameters &parameters);
     QueryResult fetchQueryResult();
 
     void releaseQuery();
     bool isAlive();
+    bool isConnected();
+    bool reconnect();
+
+    void attachThread();
+    void detachThread();
 
 private:
+    bool establishConnection();
+    void handleFailure(unsigned int errorCode);
+
     Row::Fields fetchFields();
-    void fetchRows(QueryResult &queryResult);
+    QueryResult fetchRows();
+
+    MYSQL_STMT* getStatement(Statement::Id statementId);
+    void closeStatement(Statement::Id statementId);
+    QueryResult fetchStatementRows(MYSQL_STMT *statement);
 
     MYSQL handle_;
     MYSQL_RES *queryResult_;
+
+    MYSQL_STMT *statements_[Statement::NUMBER_OF_STATEMENTS];
+    MYSQL_STMT *executedStatement_;
+    std::string errorMessage_;
+
+    std::string hostname_;
+    uint16_t port_;
+    std::string userName_;
+    std::string password_;
+    std::string databaseName_;
+    bool connected_;
 };
 
 }
@@ -2,10 +2,8 @@
 
 #include <dataserver/database/row.hpp>
 
-#include <map>
 #include <vector>
 #include <string>
-#include <boost/lexical_cast.hpp>
 
 namespace eMU
 {
@@ -14,13 +12,64 @@ namespace dataserver
 namespace database
 {
 
-class QueryResult {
+class Rows;
+
+// Values of all rows are stored one after another in single buffer, field names are kept once per result.
+// Rows returned by getRow() and getRows() are views valid as long as result is alive and not modified.
+class QueryResult
+{
 public:
-    Row& createRow(const Row::Fields &fields);
-    const Rows& getRows() const;
+    QueryResult();
+    QueryResult(const Row::Fields &fields);
+
+    void reserve(size_t numberOfRows, size_t numberOfValues, size_t dataSize);
+
+    void createRow();
+    void insert(const char *data, size_t size);
+    void insert(const std::string &value);
+
+    const Row::Fields& getFields() const;
+    size_t getFieldIndex(const std::string &field) const;
+
+    size_t getNumberOfRows() const;
+    Row getRow(size_t index) const;
+    Rows getRows() const;
+
+private:
+    Row::Fields fields_;
+    std::vector<char> data_;
+    std::vector<Row::Offset> offsets_;
+    std::vector<size_t> rowsBegins_;
+};
+
+class Rows
+{
+public:
+    class Iterator
+    {
+    public:
+        Iterator(const QueryResult &queryResult, size_t index);
+
+        Row operator*() const;
+        Iterator& operator++();
+        bool operator!=(const Iterator &iterator) const;
+
+    private:
+        const QueryResult *queryResult_;
+        size_t index_;
+    };
+
+    Rows(const QueryResult &queryResult);
+
+    size_t size() const;
+    bool empty() const;
+    Row operator[](size_t index) const;
+
+    Iterator begin() const;
+    Iterator end() const;
 
 private:
-    Rows rows_;
+    const QueryResult &queryResult_;
 };
 
 }
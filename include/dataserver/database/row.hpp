@@ -1,9 +1,9 @@
 #pragma once
 
 #include <map>
-#include <vector>
+#include <stdint.h>
 #include <string>
-#include <boost/lexical_cast.hpp>
+#include <type_traits>
 
 namespace eMU
 {
@@ -12,30 +12,31 @@ namespace dataserver
 namespace database
 {
 
+// Lightweight view of single row owned by QueryResult, values are parsed directly from result buffer.
 class Row
 {
 public:
-    typedef std::string Value;
-    typedef std::vector<Value> Values;
     typedef std::map<std::string, size_t> Fields;
+    typedef uint32_t Offset;
 
-    Row(const Fields &fields);
+    Row(const char *data, const Offset *offsets, size_t numberOfValues, const Fields &fields);
 
-    void insert(const Value &value);
+    size_t getNumberOfValues() const;
 
     template<typename T>
     T getValue(const std::string &field) const
     {
-        return this->getValue<T>(fields_.at(field));
+        return this->getValue<T>(fields_->at(field));
     }
 
     template<typename T>
     T getValue(size_t index) const
     {
-        if(index < values_.size())
+        static_assert(std::is_integral<T>::value, "Only integral and string values are supported");
+
+        if(index < numberOfValues_)
         {
-            Value v = values_[index];
-            return boost::lexical_cast<T>(v);
+            return parseInteger<T>(data_ + offsets_[index], offsets_[index + 1] - offsets_[index]);
         }
         else
         {
@@ -46,11 +47,36 @@ public:
 private:
     Row();
 
-    Values values_;
-    Fields fields_;
+    // malformed or empty value (NULL) is parsed as zero
+    template<typename T>
+    static T parseInteger(const char *data, size_t size)
+    {
+        typedef typename std::make_unsigned<T>::type UnsignedType;
+
+        bool negative = size > 0 && data[0] == '-';
+        UnsignedType value = 0;
+
+        for(size_t i = negative ? 1 : 0; i < size; ++i)
+        {
+            if(data[i] < '0' || data[i] > '9')
+            {
+                return T();
+            }
+
+            value = value * 10 + static_cast<UnsignedType>(data[i] - '0');
+        }
+
+        return static_cast<T>(negative ? 0 - value : value);
+    }
+
+    const char *data_;
+    const Offset *offsets_;
+    size_t numberOfValues_;
+    const Fields *fields_;
 };
 
-typedef std::vector<Row> Rows;
+template<>
+std::string Row::getValue(size_t index) const;
 
 }
 }
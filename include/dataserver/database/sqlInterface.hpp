@@ -1,6 +1,7 @@
 #pragma once
 
 #include <dataserver/database/queryResult.hpp>
+#include <dataserver/database/statement.hpp>
 
 #include <string>
 #include <boost/noncopyable.hpp>
@@ -25,9 +26,17 @@ public:
     virtual std::string getErrorMessage() = 0;
 
     virtual bool executeQuery(std::string query) = 0;
+    virtual bool executeStatement(Statement::Id statementId, const Statement::Parameters &parameters) = 0;
     virtual QueryResult fetchQueryResult() = 0;
 
+    // isAlive() costs a round trip to database, request path should rely on isConnected()
     virtual bool isAlive() = 0;
+    virtual bool isConnected() = 0;
+    virtual bool reconnect() = 0;
+    bool checkHealth();
+
+    virtual void attachThread();
+    virtual void detachThread();
 };
 
 }
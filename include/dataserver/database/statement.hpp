@@ -0,0 +1,39 @@
+#pragma once
+
+#include <boost/variant.hpp>
+#include <string>
+#include <vector>
+
+namespace eMU
+{
+namespace dataserver
+{
+namespace database
+{
+
+class Statement
+{
+public:
+    enum Id
+    {
+        CHECK_ACCOUNT,
+        CHARACTERS_LIST,
+        CHARACTER_CREATE,
+        CHARACTERS_LIST_BATCH,
+
+        NUMBER_OF_STATEMENTS
+    };
+
+    typedef boost::variant<uint32_t, std::string> Parameter;
+    typedef std::vector<Parameter> Parameters;
+
+    // batched statements take exactly this many parameters, unused ones repeat the first
+    static const size_t kMaxBatchSize = 32;
+
+    static const std::string& getText(Id id);
+    static size_t getNumberOfParameters(Id id);
+};
+
+}
+}
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <dataserver/database/sqlInterface.hpp>
+
+#include <boost/noncopyable.hpp>
+#include <boost/thread.hpp>
+#include <condition_variable>
+#include <functional>
+#include <chrono>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace eMU
+{
+namespace dataserver
+{
+namespace database
+{
+
+// Runs database jobs on dedicated threads, each worker owns exclusively one connection to database.
+// Until start() is called jobs are executed in place on the first connection.
+// Workers check health of their connections periodically, so jobs do not need to ping database.
+class WorkersPool: boost::noncopyable
+{
+public:
+    typedef std::vector<SqlInterface*> SqlInterfacesContainer;
+    typedef std::function<void(SqlInterface&)> Job;
+
+    WorkersPool(const SqlInterfacesContainer &sqlInterfaces);
+    ~WorkersPool();
+
+    void setHealthCheckInterval(std::chrono::milliseconds interval);
+
+    void start();
+    void stop();
+    void post(const Job &job);
+
+    size_t getNumberOfWorkers() const;
+    size_t getQueueDepth() const;
+    size_t getMaxQueueDepth() const;
+    uint64_t getNumberOfExecutedJobs() const;
+    uint64_t getTotalWaitTime() const;
+    uint64_t getNumberOfHealthChecks() const;
+    uint64_t getNumberOfFailedHealthChecks() const;
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    struct QueuedJob
+    {
+        Job job_;
+        Clock::time_point enqueueTime_;
+    };
+
+    WorkersPool();
+
+    void work(SqlInterface &sqlInterface);
+    void execute(const Job &job, SqlInterface &sqlInterface);
+    void checkHealth(SqlInterface &sqlInterface);
+
+    SqlInterfacesContainer sqlInterfaces_;
+    boost::thread_group workers_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable jobQueued_;
+    std::deque<QueuedJob> queue_;
+    bool running_;
+    size_t maxQueueDepth_;
+    std::chrono::milliseconds healthCheckInterval_;
+
+    std::atomic<uint64_t> numberOfExecutedJobs_;
+    std::atomic<uint64_t> totalWaitTime_;
+    std::atomic<uint64_t> numberOfHealthChecks_;
+    std::atomic<uint64_t> numberOfFailedHealthChecks_;
+};
+
+}
+}
+}
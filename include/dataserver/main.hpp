@@ -1,3 +1,3 @@
-#pragma once
-
-int main(int argsCount, char *args[]);
+#pragma once
+
+int main(int argsCount, char *args[]);
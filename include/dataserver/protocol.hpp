@@ -1,24 +1,32 @@
-#pragma once
-
-#include <protocols/server.hpp>
-#include <streaming/readStream.hpp>
-#include <dataserver/context.hpp>
-
-namespace eMU
-{
-namespace dataserver
-{
-
-class Protocol: public protocols::Server<User>
-{
-public:
-    Protocol(Context &context);
-
-private:
-    bool handleReadStream(User &user, const streaming::ReadStream &stream);
-
-    Context &context_;
-};
-
-}
-}
+#pragma once
+
+#include <protocols/server.hpp>
+#include <streaming/readStreamView.hpp>
+#include <dataserver/context.hpp>
+#include <streaming/dataserver/charactersListRequest.hpp>
+
+namespace eMU
+{
+namespace dataserver
+{
+
+class Protocol: public protocols::Server<User>
+{
+public:
+    Protocol(Context &context);
+
+private:
+    void handleCheckAccountRequest(User &user, const streaming::ReadStreamView &stream);
+    void handleCharactersListRequest(User &user, const streaming::ReadStreamView &stream);
+    void handleCharacterCreateRequest(User &user, const streaming::ReadStreamView &stream);
+
+    bool sendCachedCharactersList(User &user, const streaming::dataserver::CharactersListRequest &request);
+
+    template<typename TransactionType, typename RequestType, typename... Arguments>
+    void postTransaction(User &user, const RequestType &request, Arguments&... arguments);
+
+    Context &context_;
+};
+
+}
+}
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <dataserver/database/workersPool.hpp>
+#include <core/network/tcp/connection.hpp>
+
+#include <boost/noncopyable.hpp>
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
+#include <iterator>
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace eMU
+{
+namespace dataserver
+{
+
+// Coalesces requests of one type into batches handled by single database job.
+// Batch is flushed when it reaches max size or when its oldest request waited max latency,
+// with zero latency only requests which queued up while flush job was waiting for worker are coalesced.
+template<typename RequestType>
+class RequestsBatcher: boost::noncopyable
+{
+public:
+    struct Entry
+    {
+        core::network::tcp::Connection::Pointer connection_;
+        RequestType request_;
+        std::chrono::steady_clock::time_point arrivalTime_;
+    };
+
+    typedef std::vector<Entry> Batch;
+    typedef std::function<void(database::SqlInterface&, const Batch&)> Handler;
+
+    RequestsBatcher(database::WorkersPool &databaseWorkers, const Handler &handler):
+        databaseWorkers_(databaseWorkers),
+        handler_(handler),
+        maxBatchSize_(1),
+        maxLatency_(0),
+        scheduledFlushes_(0),
+        numberOfRequests_(0),
+        numberOfBatches_(0),
+        largestBatchSize_(0) {}
+
+    void configure(size_t maxBatchSize, std::chrono::microseconds maxLatency)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        maxBatchSize_ = std::max<size_t>(maxBatchSize, 1);
+        maxLatency_ = maxLatency;
+    }
+
+    bool isEnabled() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return maxBatchSize_ > 1;
+    }
+
+    void add(const core::network::tcp::Connection::Pointer &connection, const RequestType &request)
+    {
+        bool flushNeeded = false;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            pending_.push_back(Entry{connection, request, std::chrono::steady_clock::now()});
+            flushNeeded = this->scheduleFlush();
+
+            if(pending_.size() >= maxBatchSize_)
+            {
+                batchFilled_.notify_one();
+            }
+        }
+
+        if(flushNeeded)
+        {
+            this->postFlush();
+        }
+    }
+
+    uint64_t getNumberOfRequests() const
+    {
+        return numberOfRequests_;
+    }
+
+    uint64_t getNumberOfBatches() const
+    {
+        return numberOfBatches_;
+    }
+
+    size_t getLargestBatchSize() const
+    {
+        return largestBatchSize_;
+    }
+
+private:
+    RequestsBatcher();
+
+    // called under lock, every maxBatchSize_ pending requests get their own flush job so batches run in parallel
+    bool scheduleFlush()
+    {
+        if(pending_.size() > scheduledFlushes_ * maxBatchSize_)
+        {
+            ++scheduledFlushes_;
+            return true;
+        }
+
+        return false;
+    }
+
+    void postFlush()
+    {
+        databaseWorkers_.post(std::bind(&RequestsBatcher::flush, this, std::placeholders::_1));
+    }
+
+    void flush(database::SqlInterface &sqlInterface)
+    {
+        Batch batch;
+        bool flushNeeded = false;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+
+            if(maxLatency_.count() > 0 && !pending_.empty())
+            {
+                batchFilled_.wait_until(lock, pending_.front().arrivalTime_ + maxLatency_,
+                                        [this]() { return pending_.size() >= maxBatchSize_; });
+            }
+
+            --scheduledFlushes_;
+
+            size_t batchSize = std::min(pending_.size(), maxBatchSize_);
+            batch.reserve(batchSize);
+            std::move(pending_.begin(), pending_.begin() + batchSize, std::back_inserter(batch));
+            pending_.erase(pending_.begin(), pending_.begin() + batchSize);
+
+            flushNeeded = !pending_.empty() && this->scheduleFlush();
+        }
+
+        if(flushNeeded)
+        {
+            this->postFlush();
+        }
+
+        if(batch.empty())
+        {
+            return;
+        }
+
+        ++numberOfBatches_;
+        numberOfRequests_ += batch.size();
+
+        size_t largestBatchSize = largestBatchSize_;
+        while(batch.size() > largestBatchSize && !largestBatchSize_.compare_exchange_weak(largestBatchSize, batch.size()));
+
+        handler_(sqlInterface, batch);
+    }
+
+    database::WorkersPool &databaseWorkers_;
+    Handler handler_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable batchFilled_;
+    std::vector<Entry> pending_;
+    size_t maxBatchSize_;
+    std::chrono::microseconds maxLatency_;
+    size_t scheduledFlushes_;
+
+    std::atomic<uint64_t> numberOfRequests_;
+    std::atomic<uint64_t> numberOfBatches_;
+    std::atomic<size_t> largestBatchSize_;
+};
+
+}
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <dataserver/transactions/databaseTransaction.hpp>
+#include <dataserver/charactersCache.hpp>
 #include <streaming/dataserver/characterCreateRequest.hpp>
 
 namespace eMU
@@ -15,12 +16,14 @@ class CharacterCreateRequest: public DatabaseTransaction
 public:
     CharacterCreateRequest(User &user,
                            database::SqlInterface &sqlInterface,
-                           const streaming::dataserver::CharacterCreateRequest &request);
+                           const streaming::dataserver::CharacterCreateRequest &request,
+                           CharactersCache &charactersCache);
 
 private:
     void handleValid();
 
     streaming::dataserver::CharacterCreateRequest request_;
+    CharactersCache &charactersCache_;
 };
 
 }
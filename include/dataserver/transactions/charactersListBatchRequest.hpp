@@ -0,0 +1,38 @@
+#pragma once
+
+#include <dataserver/requestsBatcher.hpp>
+#include <dataserver/charactersCache.hpp>
+#include <core/common/transaction.hpp>
+#include <dataserver/database/sqlInterface.hpp>
+#include <streaming/dataserver/charactersListRequest.hpp>
+
+namespace eMU
+{
+namespace dataserver
+{
+namespace transactions
+{
+
+// Characters of all accounts in batch are selected by single query and fanned out to requesting users.
+class CharactersListBatchRequest: public core::common::Transaction
+{
+public:
+    typedef RequestsBatcher<streaming::dataserver::CharactersListRequest> Batcher;
+
+    CharactersListBatchRequest(database::SqlInterface &sqlInterface, const Batcher::Batch &batch, CharactersCache &charactersCache);
+
+private:
+    bool isValid() const;
+    void handleInvalid();
+    void handleValid();
+
+    void sendFaultIndications(const std::string &message);
+
+    database::SqlInterface &sqlInterface_;
+    const Batcher::Batch &batch_;
+    CharactersCache &charactersCache_;
+};
+
+}
+}
+}
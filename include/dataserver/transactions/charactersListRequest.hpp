@@ -1,6 +1,7 @@
 #pragma once
 
 #include <dataserver/transactions/databaseTransaction.hpp>
+#include <dataserver/charactersCache.hpp>
 #include <streaming/dataserver/charactersListRequest.hpp>
 
 namespace eMU
@@ -15,12 +16,14 @@ class CharactersListRequest: public DatabaseTransaction
 public:
     CharactersListRequest(User &user,
                           database::SqlInterface &sqlInterface,
-                          const streaming::dataserver::CharactersListRequest &request);
+                          const streaming::dataserver::CharactersListRequest &request,
+                          CharactersCache &charactersCache);
 
 private:
     void handleValid();
 
     streaming::dataserver::CharactersListRequest request_;
+    CharactersCache &charactersCache_;
 };
 
 }
@@ -1,23 +1,25 @@
-#pragma once
-
-#include <protocols/client.hpp>
-#include <gameserver/context.hpp>
-
-namespace eMU
-{
-namespace gameserver
-{
-
-class DataserverProtocol: public protocols::Client
-{
-public:
-    DataserverProtocol(Context &context);
-
-private:
-    bool handleReadStream(const streaming::ReadStream &stream);
-
-    Context &context_;
-};
-
-}
-}
+#pragma once
+
+#include <protocols/client.hpp>
+#include <gameserver/context.hpp>
+
+namespace eMU
+{
+namespace gameserver
+{
+
+class DataserverProtocol: public protocols::Client
+{
+public:
+    DataserverProtocol(Context &context);
+
+private:
+    void handleCharactersListResponse(const streaming::ReadStreamView &stream);
+    void handleCharacterCreateResponse(const streaming::ReadStreamView &stream);
+    void handleFaultIndication(const streaming::ReadStreamView &stream);
+
+    Context &context_;
+};
+
+}
+}
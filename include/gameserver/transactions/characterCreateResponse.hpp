@@ -1,6 +1,6 @@
 #pragma once
 
-#include <core/common/factory.hpp>
+#include <core/network/tcp/usersFactory.hpp>
 #include <core/common/transaction.hpp>
 #include <gameserver/user.hpp>
 #include <streaming/dataserver/characterCreateResponse.hpp>
@@ -15,7 +15,7 @@ namespace transactions
 class CharacterCreateResponse: public core::common::Transaction
 {
 public:
-    CharacterCreateResponse(core::common::Factory<User> &usersFactory,
+    CharacterCreateResponse(core::network::tcp::UsersFactory<User> &usersFactory,
                             const streaming::dataserver::CharacterCreateResponse &response);
 
 private:
@@ -23,7 +23,7 @@ private:
     void handleValid();
     void handleInvalid();
 
-    core::common::Factory<User> &usersFactory_;
+    core::network::tcp::UsersFactory<User> &usersFactory_;
     streaming::dataserver::CharacterCreateResponse response_;
 };
 
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <core/common/factory.hpp>
+#include <core/network/tcp/usersFactory.hpp>
 #include <core/common/transaction.hpp>
 #include <gameserver/user.hpp>
 #include <streaming/dataserver/charactersListResponse.hpp>
@@ -15,7 +15,7 @@ namespace transactions
 class CharactersListResponse: public core::common::Transaction
 {
 public:
-    CharactersListResponse(core::common::Factory<User> &usersFactory,
+    CharactersListResponse(core::network::tcp::UsersFactory<User> &usersFactory,
                            const streaming::dataserver::CharactersListResponse &response);
 
 private:
@@ -23,7 +23,7 @@ private:
     void handleValid();
     void handleInvalid();
 
-    core::common::Factory<User> &usersFactory_;
+    core::network::tcp::UsersFactory<User> &usersFactory_;
     streaming::dataserver::CharactersListResponse response_;
 };
 
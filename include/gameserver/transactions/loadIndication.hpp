@@ -0,0 +1,36 @@
+#pragma once
+
+#include <core/common/transaction.hpp>
+#include <core/network/udp/connection.hpp>
+
+namespace eMU
+{
+namespace gameserver
+{
+namespace transactions
+{
+
+class LoadIndication: public core::common::Transaction
+{
+public:
+    LoadIndication(const boost::asio::ip::udp::endpoint &loginserverEndpoint,
+                   core::network::udp::Connection::Pointer udpConnection,
+                   uint16_t gameserverCode,
+                   size_t numberOfUsers,
+                   size_t maxNumberOfUsers);
+
+private:
+    bool isValid() const;
+    void handleValid();
+    void handleInvalid();
+
+    const boost::asio::ip::udp::endpoint &loginserverEndpoint_;
+    core::network::udp::Connection::Pointer udpConnection_;
+    uint16_t gameserverCode_;
+    size_t numberOfUsers_;
+    size_t maxNumberOfUsers_;
+};
+
+}
+}
+}
@@ -1,23 +1,24 @@
-#pragma once
-
-#include <protocols/client.hpp>
-#include <loginserver/context.hpp>
-
-namespace eMU
-{
-namespace loginserver
-{
-
-class DataserverProtocol: public protocols::Client
-{
-public:
-    DataserverProtocol(Context &context);
-
-private:
-    bool handleReadStream(const streaming::ReadStream &stream);
-
-    Context &context_;
-};
-
-}
-}
+#pragma once
+
+#include <protocols/client.hpp>
+#include <loginserver/context.hpp>
+
+namespace eMU
+{
+namespace loginserver
+{
+
+class DataserverProtocol: public protocols::Client
+{
+public:
+    DataserverProtocol(Context &context);
+
+private:
+    void handleCheckAccountResponse(const streaming::ReadStreamView &stream);
+    void handleFaultIndication(const streaming::ReadStreamView &stream);
+
+    Context &context_;
+};
+
+}
+}
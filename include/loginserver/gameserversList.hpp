@@ -3,29 +3,79 @@
 #include <core/common/xmlReader.hpp>
 #include <core/common/mockable.hpp>
 #include <streaming/loginserver/gameserverInfo.hpp>
+#include <core/network/payload.hpp>
 
+#include <unordered_map>
 #include <stdint.h>
 #include <string>
+#include <memory>
+#include <chrono>
+#include <atomic>
+#include <mutex>
 
 namespace eMU
 {
 namespace loginserver
 {
 
+// Servers, their load and pre-encoded list response are kept in immutable snapshot replaced with atomic_store,
+// readers never lock. Reloads and load reports copy current snapshot under writers lock and publish the copy.
 class GameserversList
 {
-public:  
+public:
+    typedef std::shared_ptr<const core::network::Payload> PayloadPointer;
+    typedef std::chrono::steady_clock Clock;
 
+    GameserversList();
     virtual ~GameserversList();
+
+    // may be called again to reload the list, current list is kept when new one is invalid
     bool initialize(eMU::core::common::XmlReader &xmlReader);
-    MOCKABLE const streaming::loginserver::GameserversInfoContainer& getServers() const;
+    void setLoadTimeout(std::chrono::milliseconds loadTimeout);
+
+    MOCKABLE streaming::loginserver::GameserversInfoContainer getServers() const;
+    MOCKABLE PayloadPointer getListResponse() const;
     MOCKABLE bool hasGameserver(uint16_t code) const;
-    MOCKABLE const streaming::loginserver::GameserverInfo& getGameserverInfo(uint16_t code) const;
+    MOCKABLE bool findGameserverInfo(uint16_t code, streaming::loginserver::GameserverInfo &info) const;
+    MOCKABLE bool selectGameserver(uint16_t requestedCode, streaming::loginserver::GameserverInfo &info) const;
+    MOCKABLE bool updateLoad(uint16_t code, uint32_t numberOfUsers, uint32_t maxNumberOfUsers);
+
+    uint64_t getNumberOfLoads() const;
+    uint64_t getNumberOfRedirections() const;
 
 private:
-    streaming::loginserver::GameserversInfoContainer::const_iterator findGameserverInfo(uint16_t code) const;
+    struct Load
+    {
+        uint32_t numberOfUsers_;
+        uint32_t maxNumberOfUsers_;
+        Clock::time_point reportTime_;
+    };
+
+    struct Snapshot
+    {
+        streaming::loginserver::GameserversInfoContainer servers_;
+        std::vector<Load> loads_;
+        std::unordered_map<uint16_t, size_t> indexes_;
+        PayloadPointer listResponse_;
+    };
+
+    typedef std::shared_ptr<const Snapshot> SnapshotPointer;
+
+    SnapshotPointer getSnapshot() const;
+    void publish(const std::shared_ptr<Snapshot> &snapshot);
+
+    bool isLoadKnown(const Load &load, Clock::time_point now) const;
+    static bool isFull(const Load &load);
+    static bool isLessOccupied(const Load &left, const Load &right);
+    static uint8_t calculateLoad(uint32_t numberOfUsers, uint32_t maxNumberOfUsers);
+    static PayloadPointer encodeListResponse(const streaming::loginserver::GameserversInfoContainer &servers);
+
+    SnapshotPointer snapshot_; // accessed only through atomic_load/atomic_store
+    std::mutex writersMutex_;
+    std::chrono::milliseconds loadTimeout_;
 
-    streaming::loginserver::GameserversInfoContainer servers_;
+    std::atomic<uint64_t> numberOfLoads_;
+    mutable std::atomic<uint64_t> numberOfRedirections_;
 };
 
 }
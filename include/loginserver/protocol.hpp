@@ -1,24 +1,26 @@
-#pragma once
-
-#include <protocols/server.hpp>
-#include <streaming/readStream.hpp>
-#include <loginserver/context.hpp>
-
-namespace eMU
-{
-namespace loginserver
-{
-
-class Protocol: public protocols::Server<User>
-{
-public:
-    Protocol(Context &context);
-
-private:
-    bool handleReadStream(User &user, const streaming::ReadStream &stream);
-
-    Context &context_;
-};
-
-}
-}
+#pragma once
+
+#include <protocols/server.hpp>
+#include <streaming/readStreamView.hpp>
+#include <loginserver/context.hpp>
+
+namespace eMU
+{
+namespace loginserver
+{
+
+class Protocol: public protocols::Server<User>
+{
+public:
+    Protocol(Context &context);
+
+private:
+    void handleLoginRequest(User &user, const streaming::ReadStreamView &stream);
+    void handleGameserversListRequest(User &user, const streaming::ReadStreamView &stream);
+    void handleGameserverDetailsRequest(User &user, const streaming::ReadStreamView &stream);
+
+    Context &context_;
+};
+
+}
+}
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <core/common/factory.hpp>
+#include <core/network/tcp/usersFactory.hpp>
 #include <core/common/transaction.hpp>
 #include <loginserver/user.hpp>
 #include <streaming/dataserver/checkAccountResponse.hpp>
@@ -15,7 +15,7 @@ namespace transactions
 class CheckAccountResponse: public core::common::Transaction
 {
 public:
-    CheckAccountResponse(core::common::Factory<User> &usersFactory,
+    CheckAccountResponse(core::network::tcp::UsersFactory<User> &usersFactory,
                          const streaming::dataserver::CheckAccountResponse &response);
 
 private:
@@ -23,7 +23,7 @@ private:
     void handleValid();
     void handleInvalid();
 
-    core::common::Factory<User> &usersFactory_;
+    core::network::tcp::UsersFactory<User> &usersFactory_;
     streaming::dataserver::CheckAccountResponse response_;
 };
 
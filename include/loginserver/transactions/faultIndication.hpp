@@ -3,7 +3,7 @@
 #include <core/common/transaction.hpp>
 #include <loginserver/user.hpp>
 #include <streaming/dataserver/faultIndication.hpp>
-#include <core/common/factory.hpp>
+#include <core/network/tcp/usersFactory.hpp>
 
 namespace eMU
 {
@@ -15,7 +15,7 @@ namespace transactions
 class FaultIndication: public core::common::Transaction
 {
 public:
-    FaultIndication(core::common::Factory<User> &usersFactory,
+    FaultIndication(core::network::tcp::UsersFactory<User> &usersFactory,
                     const streaming::dataserver::FaultIndication &indication);
 
 private:
@@ -23,7 +23,7 @@ private:
     void handleValid();
     void handleInvalid();
 
-    core::common::Factory<User> &usersFactory_;
+    core::network::tcp::UsersFactory<User> &usersFactory_;
     streaming::dataserver::FaultIndication indication_;
 };
 
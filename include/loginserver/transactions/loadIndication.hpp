@@ -0,0 +1,31 @@
+#pragma once
+
+#include <core/common/transaction.hpp>
+#include <loginserver/gameserversList.hpp>
+#include <streaming/gameserver/loadIndication.hpp>
+
+namespace eMU
+{
+namespace loginserver
+{
+namespace transactions
+{
+
+class LoadIndication: public core::common::Transaction
+{
+public:
+    LoadIndication(GameserversList &gameserversList,
+                   const streaming::gameserver::LoadIndication &indication);
+
+private:
+    bool isValid() const;
+    void handleValid();
+    void handleInvalid();
+
+    GameserversList &gameserversList_;
+    streaming::gameserver::LoadIndication indication_;
+};
+
+}
+}
+}
@@ -1,7 +1,7 @@
 #pragma once
 
 #include <core/common/transaction.hpp>
-#include <core/common/factory.hpp>
+#include <core/network/tcp/usersFactory.hpp>
 #include <loginserver/user.hpp>
 #include <loginserver/gameserversList.hpp>
 #include <streaming/gameserver/registerUserResponse.hpp>
@@ -16,7 +16,7 @@ namespace transactions
 class RegisterUserResponse: public core::common::Transaction
 {
 public:
-    RegisterUserResponse(core::common::Factory<User> &usersFactory,
+    RegisterUserResponse(core::network::tcp::UsersFactory<User> &usersFactory,
                          GameserversList &gameserversList,
                          const streaming::gameserver::RegisterUserResponse &response);
 
@@ -25,7 +25,7 @@ private:
     void handleValid();
     void handleInvalid();
 
-    core::common::Factory<User> &usersFactory_;
+    core::network::tcp::UsersFactory<User> &usersFactory_;
     GameserversList &gameserversList_;
     streaming::gameserver::RegisterUserResponse response_;
 };
@@ -1,23 +1,24 @@
-#pragma once
-
-#include <protocols/udp.hpp>
-#include <loginserver/context.hpp>
-
-namespace eMU
-{
-namespace loginserver
-{
-
-class UdpProtocol: public protocols::Udp
-{
-public:
-    UdpProtocol(Context &context);
-
-private:
-    void handleReadStream(const streaming::ReadStream &stream, const boost::asio::ip::udp::endpoint &senderEndpoint);
-
-    Context &context_;
-};
-
-}
-}
+#pragma once
+
+#include <protocols/udp.hpp>
+#include <loginserver/context.hpp>
+
+namespace eMU
+{
+namespace loginserver
+{
+
+class UdpProtocol: public protocols::Udp
+{
+public:
+    UdpProtocol(Context &context);
+
+private:
+    void handleRegisterUserResponse(const streaming::ReadStreamView &stream);
+    void handleLoadIndication(const streaming::ReadStreamView &stream);
+
+    Context &context_;
+};
+
+}
+}
@@ -1,42 +1,50 @@
-#pragma once
-
-#include <mt/asioStub/ioService.hpp>
-
-#include <boost/asio.hpp>
-#include <gmock/gmock.h>
-
-namespace eMU
-{
-namespace mt
-{
-namespace env
-{
-namespace asioStub
-{
-namespace ip
-{
-namespace tcp
-{
-
-class socket;
-
-class acceptor
-{
-public:
-    typedef std::function<void(const boost::system::error_code&)> AcceptHandler;
-
-    acceptor(io_service &ioService, const boost::asio::ip::tcp::endpoint &endpoint);
-    void async_accept(socket &socket, const AcceptHandler &handler);
-
-    io_service& get_io_service();
-
-private:
-    io_service& ioService_;
-};
-
-}
-}
-}
-}
-}
-}
+#pragma once
+
+#include <mt/asioStub/ioService.hpp>
+
+#include <boost/asio.hpp>
+#include <gmock/gmock.h>
+
+namespace eMU
+{
+namespace mt
+{
+namespace env
+{
+namespace asioStub
+{
+namespace ip
+{
+namespace tcp
+{
+
+class socket;
+
+class acceptor
+{
+public:
+    typedef std::function<void(const boost::system::error_code&)> AcceptHandler;
+
+    acceptor(io_service &ioService, const boost::asio::ip::tcp::endpoint &endpoint);
+    acceptor(io_service &ioService);
+
+    void open(const boost::asio::ip::tcp &protocol);
+    void bind(const boost::asio::ip::tcp::endpoint &endpoint);
+    void listen();
+
+    template<typename SettableSocketOption>
+    void set_option(const SettableSocketOption &option) {}
+    void async_accept(socket &socket, const AcceptHandler &handler);
+
+    io_service& get_io_service();
+
+private:
+    io_service& ioService_;
+};
+
+}
+}
+}
+}
+}
+}
@@ -1,40 +1,41 @@
-#pragma once
-
-#include <mt/asioStub/baseSocket.hpp>
-
-namespace eMU
-{
-namespace mt
-{
-namespace env
-{
-namespace asioStub
-{
-namespace ip
-{
-namespace tcp
-{
-
-class socket: public BaseSocket
-{
-public:
-    socket(io_service &ioService);
-
-    void close();
-    bool is_open() const;
-    void shutdown(boost::asio::ip::tcp::socket::shutdown_type type);
-    void async_receive(const boost::asio::mutable_buffers_1 &buffer, const io_service::IoHandler &handler);
-    void async_send(const boost::asio::mutable_buffers_1 &buffer, const io_service::IoHandler &handler);
-    void connect(const boost::asio::ip::tcp::endpoint &endpoint, boost::system::error_code& errorCode);
-    void disconnect();
-
-private:
-    bool opened_;
-};
-
-}
-}
-}
-}
-}
-}
+#pragma once
+
+#include <mt/asioStub/baseSocket.hpp>
+
+namespace eMU
+{
+namespace mt
+{
+namespace env
+{
+namespace asioStub
+{
+namespace ip
+{
+namespace tcp
+{
+
+class socket: public BaseSocket
+{
+public:
+    socket(io_service &ioService);
+
+    void close();
+    bool is_open() const;
+    void shutdown(boost::asio::ip::tcp::socket::shutdown_type type);
+    void async_receive(const boost::asio::mutable_buffers_1 &buffer, const io_service::IoHandler &handler);
+    void async_send(const std::vector<boost::asio::const_buffer> &buffers, const io_service::IoHandler &handler);
+    void connect(const boost::asio::ip::tcp::endpoint &endpoint, boost::system::error_code& errorCode);
+    void disconnect();
+
+private:
+    bool opened_;
+    std::vector<uint8_t> gatheredSendData_;
+};
+
+}
+}
+}
+}
+}
+}
@@ -1,60 +1,73 @@
-#pragma once
-
-#include <dataserver/database/sqlInterface.hpp>
-
-#include <gmock/gmock.h>
-#include <queue>
-
-namespace eMU
-{
-namespace mt
-{
-namespace env
-{
-namespace dataserver
-{
-namespace database
-{
-
-class SqlInterfaceStub: public eMU::dataserver::database::SqlInterface
-{
-public:
-    struct Query
-    {
-        bool queryStatus_;
-        eMU::dataserver::database::QueryResult queryResult_;
-    };
-
-    SqlInterfaceStub();
-
-    typedef std::queue<bool> QueryStatusContainer;
-    typedef std::queue<eMU::dataserver::database::QueryResult> QueryResultContainer;
-
-    bool initialize();
-    bool connect(const std::string &hostname, uint16_t port, const std::string &userName,
-                 const std::string &password, const std::string &databaseName);
-
-    void cleanup();
-    std::string getErrorMessage();
-
-    bool executeQuery(std::string query);
-    eMU::dataserver::database::QueryResult fetchQueryResult();
-    bool isAlive();
-
-    void pushQueryStatus(bool status);
-    void pushQueryResult(const eMU::dataserver::database::QueryResult &queryResult);
-
-    void setAlive();
-    void setDied();
-
-private:
-    QueryStatusContainer queriesStatus_;
-    QueryResultContainer queriesResult_;
-    bool isAlive_;
-};
-
-}
-}
-}
-}
-}
+#pragma once
+
+#include <dataserver/database/sqlInterface.hpp>
+
+#include <gmock/gmock.h>
+#include <chrono>
+#include <queue>
+
+namespace eMU
+{
+namespace mt
+{
+namespace env
+{
+namespace dataserver
+{
+namespace database
+{
+
+class SqlInterfaceStub: public eMU::dataserver::database::SqlInterface
+{
+public:
+    struct Query
+    {
+        bool queryStatus_;
+        eMU::dataserver::database::QueryResult queryResult_;
+    };
+
+    SqlInterfaceStub();
+
+    typedef std::queue<bool> QueryStatusContainer;
+    typedef std::queue<eMU::dataserver::database::QueryResult> QueryResultContainer;
+
+    bool initialize();
+    bool connect(const std::string &hostname, uint16_t port, const std::string &userName,
+                 const std::string &password, const std::string &databaseName);
+
+    void cleanup();
+    std::string getErrorMessage();
+
+    bool executeQuery(std::string query);
+    bool executeStatement(eMU::dataserver::database::Statement::Id statementId,
+                          const eMU::dataserver::database::Statement::Parameters &parameters);
+    eMU::dataserver::database::QueryResult fetchQueryResult();
+    bool isAlive();
+    bool isConnected();
+    bool reconnect();
+
+    void pushQueryStatus(bool status);
+    void pushQueryResult(const eMU::dataserver::database::QueryResult &queryResult);
+
+    void setAlive();
+    void setDied();
+
+    // every call reaching database (query, statement, ping) is delayed by given round trip time
+    void setLatency(std::chrono::microseconds latency);
+    size_t getNumberOfRoundTrips() const;
+
+private:
+    void roundTrip();
+
+    QueryStatusContainer queriesStatus_;
+    QueryResultContainer queriesResult_;
+    bool isAlive_;
+    std::chrono::microseconds latency_;
+    size_t numberOfRoundTrips_;
+};
+
+}
+}
+}
+}
+}
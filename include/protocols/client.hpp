@@ -1,29 +1,35 @@
-#pragma once
-
-#include <core/network/tcp/protocol.hpp>
-#include <streaming/readStream.hpp>
-#include <protocols/contexts/client.hpp>
-
-namespace eMU
-{
-namespace protocols
-{
-
-class Client: public core::network::tcp::Protocol
-{
-public:
-    Client(contexts::Client &context);
-
-    bool attach(core::network::tcp::Connection::Pointer connection);
-    void detach(core::network::tcp::Connection::Pointer connection);
-    bool dispatch(core::network::tcp::Connection::Pointer connection);
-
-protected:
-    virtual bool handleReadStream(const streaming::ReadStream &stream) = 0;
-
-private:
-    contexts::Client &context_;
-};
-
-}
-}
+#pragma once
+
+#include <core/network/tcp/protocol.hpp>
+#include <streaming/readStreamView.hpp>
+#include <protocols/contexts/client.hpp>
+#include <protocols/streamDispatcher.hpp>
+
+namespace eMU
+{
+namespace protocols
+{
+
+class Client: public core::network::tcp::Protocol
+{
+public:
+    typedef StreamDispatcher<const streaming::ReadStreamView&> Dispatcher;
+
+    Client(contexts::Client &context, uint16_t streamIdBase);
+
+    bool attach(core::network::tcp::Connection::Pointer connection);
+    void detach(core::network::tcp::Connection::Pointer connection);
+    bool dispatch(core::network::tcp::Connection::Pointer connection);
+
+    const Dispatcher& getDispatcher() const;
+
+protected:
+    void registerHandler(uint16_t streamId, const Dispatcher::Handler &handler);
+
+private:
+    contexts::Client &context_;
+    Dispatcher dispatcher_;
+};
+
+}
+}
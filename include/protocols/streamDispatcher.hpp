@@ -0,0 +1,107 @@
+#pragma once
+
+#include <core/metrics/registry.hpp>
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace eMU
+{
+namespace protocols
+{
+
+// Handlers are registered at startup in dense table indexed by streamId - streamIdBase, so lookup is single
+// bounds check regardless of number of handled streams. Ids below base wrap around and end up out of range.
+// Number of handled streams and handling latency go to metrics registry labelled with stream id, they are shared
+// by dispatchers of the same stream id and safe to update from many threads.
+template<typename... Arguments>
+class StreamDispatcher
+{
+public:
+    typedef std::function<void(Arguments...)> Handler;
+
+    StreamDispatcher(uint16_t streamIdBase):
+        streamIdBase_(streamIdBase),
+        unknownStreams_(core::metrics::Registry::getInstance().getCounter("emu_unknown_streams_total",
+                                                                          "Received streams without registered handler.")) {}
+
+    void registerHandler(uint16_t streamId, const Handler &handler)
+    {
+        size_t index = this->getIndex(streamId);
+
+        if(index >= entries_.size())
+        {
+            entries_.resize(index + 1);
+        }
+
+        std::string labels = "stream_id=\"" + std::to_string(streamId) + "\"";
+        core::metrics::Registry &registry = core::metrics::Registry::getInstance();
+
+        entries_[index].handler_ = handler;
+        entries_[index].streams_ = &registry.getCounter("emu_streams_total", "Handled streams.", labels);
+        entries_[index].latency_ = &registry.getHistogram("emu_stream_latency_nanoseconds", "Time spent in stream handler.", labels);
+    }
+
+    bool dispatch(uint16_t streamId, Arguments... arguments)
+    {
+        size_t index = this->getIndex(streamId);
+
+        if(index >= entries_.size() || !entries_[index].handler_)
+        {
+            unknownStreams_.increment();
+            return false;
+        }
+
+        Entry &entry = entries_[index];
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        entry.handler_(arguments...);
+
+        entry.streams_->increment();
+        entry.latency_->record(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+
+        return true;
+    }
+
+    uint64_t getNumberOfHandledStreams(uint16_t streamId) const
+    {
+        size_t index = this->getIndex(streamId);
+
+        return index < entries_.size() && entries_[index].handler_ ? entries_[index].streams_->getValue() : 0;
+    }
+
+    // nullptr for streams without handler
+    const core::metrics::Histogram* getLatency(uint16_t streamId) const
+    {
+        size_t index = this->getIndex(streamId);
+
+        return index < entries_.size() && entries_[index].handler_ ? entries_[index].latency_ : nullptr;
+    }
+
+private:
+    struct Entry
+    {
+        Entry():
+            streams_(nullptr),
+            latency_(nullptr) {}
+
+        Handler handler_;
+        core::metrics::Counter *streams_;
+        core::metrics::Histogram *latency_;
+    };
+
+    size_t getIndex(uint16_t streamId) const
+    {
+        return static_cast<uint16_t>(streamId - streamIdBase_);
+    }
+
+    uint16_t streamIdBase_;
+    std::vector<Entry> entries_;
+    core::metrics::Counter &unknownStreams_;
+};
+
+}
+}
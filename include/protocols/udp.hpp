@@ -1,29 +1,35 @@
-#pragma once
-
-#include <core/network/udp/protocol.hpp>
-#include <streaming/readStream.hpp>
-#include <protocols/contexts/udp.hpp>
-
-namespace eMU
-{
-namespace protocols
-{
-
-class Udp: public core::network::udp::Protocol
-{
-public:
-    Udp(contexts::Udp &context);
-
-    void attach(core::network::udp::Connection::Pointer connection);
-    void dispatch(core::network::udp::Connection::Pointer connection, const boost::asio::ip::udp::endpoint &senderEndpoint);
-    void detach(core::network::udp::Connection::Pointer connection);
-
-protected:
-    virtual void handleReadStream(const streaming::ReadStream &stream, const boost::asio::ip::udp::endpoint &senderEndpoint) = 0;
-
-private:
-    contexts::Udp  &context_;
-};
-
-}
-}
+#pragma once
+
+#include <core/network/udp/protocol.hpp>
+#include <streaming/readStreamView.hpp>
+#include <protocols/contexts/udp.hpp>
+#include <protocols/streamDispatcher.hpp>
+
+namespace eMU
+{
+namespace protocols
+{
+
+class Udp: public core::network::udp::Protocol
+{
+public:
+    typedef StreamDispatcher<const streaming::ReadStreamView&, const boost::asio::ip::udp::endpoint&> Dispatcher;
+
+    Udp(contexts::Udp &context, uint16_t streamIdBase);
+
+    void attach(core::network::udp::Connection::Pointer connection);
+    void dispatch(core::network::udp::Connection::Pointer connection, const boost::asio::ip::udp::endpoint &senderEndpoint);
+    void detach(core::network::udp::Connection::Pointer connection);
+
+    const Dispatcher& getDispatcher() const;
+
+protected:
+    void registerHandler(uint16_t streamId, const Dispatcher::Handler &handler);
+
+private:
+    contexts::Udp  &context_;
+    Dispatcher dispatcher_;
+};
+
+}
+}
@@ -1,20 +1,20 @@
-#pragma once
-
-namespace eMU
-{
-namespace streaming
-{
-namespace dataserver
-{
-
-enum class CharacterCreateResult
-{
-    Succeed = 0,
-    CharactersCountExceeded,
-    AlreadyExists
-};
-
-
-}
-}
-}
+#pragma once
+
+namespace eMU
+{
+namespace streaming
+{
+namespace dataserver
+{
+
+enum class CharacterCreateResult
+{
+    Succeed = 0,
+    CharactersCountExceeded,
+    AlreadyExists
+};
+
+
+}
+}
+}
@@ -1,22 +1,22 @@
-#pragma once
-
-#include <stdint.h>
-
-namespace eMU
-{
-namespace streaming
-{
-namespace gameserver
-{
-
-enum class CharacterCreateResult
-{
-    Succeed,
-    AlreadyExists,
-    CharactersCountExceeded,
-    UnknownError,
-};
-
-}
-}
-}
+#pragma once
+
+#include <stdint.h>
+
+namespace eMU
+{
+namespace streaming
+{
+namespace gameserver
+{
+
+enum class CharacterCreateResult
+{
+    Succeed,
+    AlreadyExists,
+    CharactersCountExceeded,
+    UnknownError,
+};
+
+}
+}
+}
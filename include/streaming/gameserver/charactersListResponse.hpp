@@ -1,33 +1,33 @@
-#pragma once
-
-#include <streaming/readStream.hpp>
-#include <streaming/writeStream.hpp>
-#include <streaming/common/characterListInfo.hpp>
-
-#include <string>
-
-namespace eMU
-{
-namespace streaming
-{
-namespace gameserver
-{
-
-class CharactersListResponse
-{
-public:
-    CharactersListResponse(const ReadStream &readStream);
-    CharactersListResponse(const common::CharacterInfoContainer &characters);
-
-    const WriteStream& getWriteStream() const;
-    const common::CharacterInfoContainer& getCharacters() const;
-
-private:
-    ReadStream readStream_;
-    WriteStream writeStream_;
-    common::CharacterInfoContainer characters_;
-};
-
-}
-}
-}
+#pragma once
+
+#include <streaming/readStreamView.hpp>
+#include <streaming/writeStream.hpp>
+#include <streaming/common/characterListInfo.hpp>
+
+#include <string>
+
+namespace eMU
+{
+namespace streaming
+{
+namespace gameserver
+{
+
+class CharactersListResponse
+{
+public:
+    CharactersListResponse(const ReadStreamView &readStream);
+    CharactersListResponse(const common::CharacterInfoContainer &characters);
+
+    const WriteStream& getWriteStream() const;
+    const common::CharacterInfoContainer& getCharacters() const;
+
+private:
+    ReadStreamView readStream_;
+    WriteStream writeStream_;
+    common::CharacterInfoContainer characters_;
+};
+
+}
+}
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <streaming/readStreamView.hpp>
+#include <streaming/writeStream.hpp>
+
+namespace eMU
+{
+namespace streaming
+{
+namespace gameserver
+{
+
+class LoadIndication
+{
+public:
+    LoadIndication(const ReadStreamView &readStream);
+    LoadIndication(uint16_t gameserverCode, uint32_t numberOfUsers, uint32_t maxNumberOfUsers);
+
+    const WriteStream& getWriteStream() const;
+
+    uint16_t getGameserverCode() const;
+    uint32_t getNumberOfUsers() const;
+    uint32_t getMaxNumberOfUsers() const;
+
+private:
+    ReadStreamView readStream_;
+    WriteStream writeStream_;
+
+    uint16_t gameserverCode_;
+    uint32_t numberOfUsers_;
+    uint32_t maxNumberOfUsers_;
+};
+
+}
+}
+}
@@ -1,18 +1,18 @@
-#pragma once
-
-namespace eMU
-{
-namespace streaming
-{
-namespace gameserver
-{
-
-enum class UserRegistrationResult
-{
-    Succeed,
-    Failed
-};
-
-}
-}
-}
+#pragma once
+
+namespace eMU
+{
+namespace streaming
+{
+namespace gameserver
+{
+
+enum class UserRegistrationResult
+{
+    Succeed,
+    Failed
+};
+
+}
+}
+}
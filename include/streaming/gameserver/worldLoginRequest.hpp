@@ -1,30 +1,30 @@
-#pragma once
-
-#include <streaming/readStream.hpp>
-#include <streaming/writeStream.hpp>
-
-#include <string>
-
-namespace eMU
-{
-namespace streaming
-{
-namespace gameserver
-{
-
-class WorldLoginRequest
-{
-public:
-    WorldLoginRequest(const ReadStream &readStream);
-    WorldLoginRequest();
-
-    const WriteStream& getWriteStream() const;
-
-private:
-    ReadStream readStream_;
-    WriteStream writeStream_;
-};
-
-}
-}
-}
+#pragma once
+
+#include <streaming/readStreamView.hpp>
+#include <streaming/writeStream.hpp>
+
+#include <string>
+
+namespace eMU
+{
+namespace streaming
+{
+namespace gameserver
+{
+
+class WorldLoginRequest
+{
+public:
+    WorldLoginRequest(const ReadStreamView &readStream);
+    WorldLoginRequest();
+
+    const WriteStream& getWriteStream() const;
+
+private:
+    ReadStreamView readStream_;
+    WriteStream writeStream_;
+};
+
+}
+}
+}
@@ -1,30 +1,30 @@
-#pragma once
-
-#include <streaming/readStream.hpp>
-#include <streaming/writeStream.hpp>
-
-#include <string>
-
-namespace eMU
-{
-namespace streaming
-{
-namespace loginserver
-{
-
-class GameserversListRequest
-{
-public:
-    GameserversListRequest(const ReadStream &readStream);
-    GameserversListRequest();
-
-    const WriteStream& getWriteStream() const;
-
-private:
-    ReadStream readStream_;
-    WriteStream writeStream_;
-};
-
-}
-}
-}
+#pragma once
+
+#include <streaming/readStreamView.hpp>
+#include <streaming/writeStream.hpp>
+
+#include <string>
+
+namespace eMU
+{
+namespace streaming
+{
+namespace loginserver
+{
+
+class GameserversListRequest
+{
+public:
+    GameserversListRequest(const ReadStreamView &readStream);
+    GameserversListRequest();
+
+    const WriteStream& getWriteStream() const;
+
+private:
+    ReadStreamView readStream_;
+    WriteStream writeStream_;
+};
+
+}
+}
+}
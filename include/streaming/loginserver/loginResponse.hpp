@@ -1,34 +1,34 @@
-#pragma once
-
-#include <streaming/readStream.hpp>
-#include <streaming/writeStream.hpp>
-#include <streaming/loginserver/loginResult.hpp>
-
-#include <string>
-
-namespace eMU
-{
-namespace streaming
-{
-namespace loginserver
-{
-
-class LoginResponse
-{
-public:
-    LoginResponse(const ReadStream &readStream);
-    LoginResponse(LoginResult result);
-
-    const WriteStream& getWriteStream() const;
-    LoginResult getResult() const;
-
-private:
-    ReadStream readStream_;
-    WriteStream writeStream_;
-
-    LoginResult result_;
-};
-
-}
-}
-}
+#pragma once
+
+#include <streaming/readStreamView.hpp>
+#include <streaming/writeStream.hpp>
+#include <streaming/loginserver/loginResult.hpp>
+
+#include <string>
+
+namespace eMU
+{
+namespace streaming
+{
+namespace loginserver
+{
+
+class LoginResponse
+{
+public:
+    LoginResponse(const ReadStreamView &readStream);
+    LoginResponse(LoginResult result);
+
+    const WriteStream& getWriteStream() const;
+    LoginResult getResult() const;
+
+private:
+    ReadStreamView readStream_;
+    WriteStream writeStream_;
+
+    LoginResult result_;
+};
+
+}
+}
+}
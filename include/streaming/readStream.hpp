@@ -1,54 +1,49 @@
-#pragma once
-
-#include <core/network/payload.hpp>
-#include <core/common/exception.hpp>
-
-#include <stdint.h>
-
-namespace eMU
-{
-namespace streaming
-{
-
-class ReadStream
-{
-public:
-    class OverflowException: public core::common::Exception {};
-
-    ReadStream(const core::network::Payload &payload);
-    ReadStream();
-
-    uint16_t getId() const;
-    size_t getSize() const;
-
-    template<typename T>
-    T readNext()
-    {
-        size_t offset = currentOffset_;
-        currentOffset_ += sizeof(T);
-
-        return readFromOffset<T>(offset);
-    }
-
-    std::string readNextString(size_t length);
-    std::wstring readNextWideString(size_t length);
-    const core::network::Payload& getPayload() const;
-
-private:
-    template<typename T>
-    T readFromOffset(size_t offset) const
-    {
-        if(sizeof(T) + offset > payload_.getSize())
-        {
-            throw OverflowException();
-        }
-
-        return *(reinterpret_cast<const T*>(&payload_[offset]));
-    }
-
-    core::network::Payload payload_;
-    size_t currentOffset_;
-};
-
-}
-}
+#pragma once
+
+#include <core/network/payload.hpp>
+#include <streaming/readStreamView.hpp>
+
+#include <stdint.h>
+
+namespace eMU
+{
+namespace streaming
+{
+
+class ReadStream
+{
+public:
+    typedef ReadStreamView::OverflowException OverflowException;
+
+    ReadStream(const core::network::Payload &payload);
+    ReadStream(const ReadStreamView &view);
+    ReadStream(const ReadStream &readStream);
+    ReadStream();
+
+    ReadStream& operator=(const ReadStream &readStream);
+
+    uint16_t getId() const;
+    size_t getSize() const;
+
+    template<typename T>
+    T readNext()
+    {
+        return view_.readNext<T>();
+    }
+
+    std::string readNextString(size_t length);
+    std::wstring readNextWideString(size_t length);
+    std::string readNextWideStringAsUtf8(size_t length);
+    const core::network::Payload& getPayload() const;
+
+    operator const ReadStreamView&() const;
+
+private:
+    void bindView(size_t currentOffset);
+
+    core::network::Payload payload_;
+    ReadStreamView view_;
+};
+
+}
+}
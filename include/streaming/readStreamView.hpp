@@ -0,0 +1,79 @@
+#pragma once
+
+#include <core/common/exception.hpp>
+#include <core/network/payload.hpp>
+
+#include <string>
+#include <stdint.h>
+#include <string.h>
+
+namespace eMU
+{
+namespace streaming
+{
+
+class ReadStream;
+
+class ReadStreamView
+{
+public:
+    class OverflowException: public core::common::Exception {};
+
+    ReadStreamView(const uint8_t *data, size_t size);
+    ReadStreamView(const core::network::Payload &payload);
+    ReadStreamView();
+
+    uint16_t getId() const;
+    size_t getSize() const;
+    const uint8_t* getData() const;
+
+    template<typename T>
+    T readNext()
+    {
+        size_t offset = currentOffset_;
+        currentOffset_ += sizeof(T);
+
+        return readFromOffset<T>(offset);
+    }
+
+    std::string readNextString(size_t length);
+    std::wstring readNextWideString(size_t length);
+    std::string readNextWideStringAsUtf8(size_t length);
+
+    const uint8_t* readNextBlock(size_t size)
+    {
+        if(currentOffset_ + size > size_)
+        {
+            throw OverflowException();
+        }
+
+        const uint8_t *data = data_ + currentOffset_;
+        currentOffset_ += size;
+
+        return data;
+    }
+
+private:
+    friend class ReadStream;
+
+    template<typename T>
+    T readFromOffset(size_t offset) const
+    {
+        if(sizeof(T) + offset > size_)
+        {
+            throw OverflowException();
+        }
+
+        T value;
+        memcpy(&value, data_ + offset, sizeof(T));
+
+        return value;
+    }
+
+    const uint8_t *data_;
+    size_t size_;
+    size_t currentOffset_;
+};
+
+}
+}
@@ -0,0 +1,346 @@
+#pragma once
+
+#include <streaming/writeStream.hpp>
+#include <streaming/readStreamView.hpp>
+#include <streaming/wideStringCodec.hpp>
+
+#include <algorithm>
+#include <string>
+#include <stdint.h>
+#include <string.h>
+
+namespace eMU
+{
+namespace streaming
+{
+namespace schema
+{
+
+// Message layout is described as list of fields, e.g.
+//     typedef Message<Padding<8>, Value<uint16_t>, WideString<uint32_t>> Layout;
+//     Layout::encode(writeStream, code, name);
+//     Layout::decode(readStream, code, name);
+// Fixed size fields up to and including length of next string form a run which is bounds checked once
+// and copied in place. Values are passed in field order, padding and constants take no value.
+// Decoded values are bound to references of exact field type, so layout mismatches do not compile.
+
+template<typename T>
+struct Value
+{
+    static const bool kVariable = false;
+    static const bool kHasValue = true;
+    static const size_t kSize = sizeof(T);
+
+    static void write(uint8_t *data, const T &value)
+    {
+        memcpy(data, &value, sizeof(T));
+    }
+
+    static void read(const uint8_t *data, T &value)
+    {
+        memcpy(&value, data, sizeof(T));
+    }
+};
+
+template<size_t N>
+struct Padding
+{
+    static const bool kVariable = false;
+    static const bool kHasValue = false;
+    static const size_t kSize = N;
+
+    static void write(uint8_t *data)
+    {
+        memset(data, 0, N);
+    }
+};
+
+template<typename T, T kValue>
+struct Constant
+{
+    static const bool kVariable = false;
+    static const bool kHasValue = false;
+    static const size_t kSize = sizeof(T);
+
+    static void write(uint8_t *data)
+    {
+        T value = kValue;
+        memcpy(data, &value, sizeof(T));
+    }
+};
+
+// zero padded, longer values are truncated
+template<size_t N>
+struct FixedString
+{
+    static const bool kVariable = false;
+    static const bool kHasValue = true;
+    static const size_t kSize = N;
+
+    static void write(uint8_t *data, const std::string &value)
+    {
+        size_t length = std::min(value.length(), N);
+
+        memcpy(data, value.data(), length);
+        memset(data + length, 0, N - length);
+    }
+
+    static void read(const uint8_t *data, std::string &value)
+    {
+        value.clear();
+
+        for(size_t i = 0; i < N; ++i)
+        {
+            if(data[i] != 0)
+            {
+                value.push_back(static_cast<std::string::value_type>(data[i]));
+            }
+        }
+    }
+};
+
+// length prefixed, single byte characters
+template<typename LengthType>
+struct String
+{
+    static const bool kVariable = true;
+    static const bool kHasValue = true;
+    static const size_t kSize = sizeof(LengthType);
+
+    static void write(uint8_t *prefix, WriteStream &writeStream, const std::string &value)
+    {
+        LengthType length = value.length();
+        memcpy(prefix, &length, sizeof(length));
+        memcpy(writeStream.reserveNext(value.length()), value.data(), value.length());
+    }
+
+    static void read(const uint8_t *prefix, ReadStreamView &readStream, std::string &value)
+    {
+        LengthType length;
+        memcpy(&length, prefix, sizeof(length));
+        value = readStream.readNextString(length);
+    }
+};
+
+// length prefixed, UTF-16LE on the wire and UTF-8 in memory, length is counted in UTF-16 units
+template<typename LengthType>
+struct WideString
+{
+    static const bool kVariable = true;
+    static const bool kHasValue = true;
+    static const size_t kSize = sizeof(LengthType);
+
+    static void write(uint8_t *prefix, WriteStream &writeStream, const std::string &value)
+    {
+        LengthType length = WideStringCodec::getEncodedLength(value);
+        memcpy(prefix, &length, sizeof(length));
+        WideStringCodec::encode(value, writeStream.reserveNext(length * sizeof(char16_t)));
+    }
+
+    static void write(uint8_t *prefix, WriteStream &writeStream, const std::wstring &value)
+    {
+        LengthType length = value.length();
+        memcpy(prefix, &length, sizeof(length));
+        writeStream.writeNextWideString(value);
+    }
+
+    static void read(const uint8_t *prefix, ReadStreamView &readStream, std::string &value)
+    {
+        LengthType length;
+        memcpy(&length, prefix, sizeof(length));
+        value = readStream.readNextWideStringAsUtf8(length);
+    }
+};
+
+namespace detail
+{
+
+// size of fixed fields preceding first variable field, together with its length prefix
+template<typename... Fields>
+struct Run;
+
+template<>
+struct Run<>
+{
+    static const size_t kSize = 0;
+};
+
+template<typename Field, typename... Fields>
+struct Run<Field, Fields...>
+{
+    static const size_t kSize = Field::kSize + (Field::kVariable ? 0 : Run<Fields...>::kSize);
+};
+
+template<typename... Fields>
+struct Encoder;
+
+template<typename... Fields>
+struct Decoder;
+
+template<bool kVariable, bool kHasValue, typename... Fields>
+struct RunWriter;
+
+template<bool kVariable, bool kHasValue, typename... Fields>
+struct RunReader;
+
+template<typename... Fields>
+struct NextRunWriter
+{
+    template<typename... Arguments>
+    static void write(uint8_t*, WriteStream&, const Arguments&...)
+    {
+        static_assert(sizeof...(Arguments) == 0, "More values given than message schema has fields.");
+    }
+};
+
+template<typename Field, typename... Fields>
+struct NextRunWriter<Field, Fields...>: RunWriter<Field::kVariable, Field::kHasValue, Field, Fields...> {};
+
+template<typename... Fields>
+struct NextRunReader
+{
+    template<typename... Arguments>
+    static void read(const uint8_t*, ReadStreamView&, Arguments&...)
+    {
+        static_assert(sizeof...(Arguments) == 0, "More values given than message schema has fields.");
+    }
+};
+
+template<typename Field, typename... Fields>
+struct NextRunReader<Field, Fields...>: RunReader<Field::kVariable, Field::kHasValue, Field, Fields...> {};
+
+template<typename Field, typename... Fields>
+struct RunWriter<false, true, Field, Fields...>
+{
+    template<typename Argument, typename... Arguments>
+    static void write(uint8_t *data, WriteStream &writeStream, const Argument &argument, const Arguments&... arguments)
+    {
+        Field::write(data, argument);
+        NextRunWriter<Fields...>::write(data + Field::kSize, writeStream, arguments...);
+    }
+};
+
+template<typename Field, typename... Fields>
+struct RunWriter<false, false, Field, Fields...>
+{
+    template<typename... Arguments>
+    static void write(uint8_t *data, WriteStream &writeStream, const Arguments&... arguments)
+    {
+        Field::write(data);
+        NextRunWriter<Fields...>::write(data + Field::kSize, writeStream, arguments...);
+    }
+};
+
+// length prefix is written before body reservation, which may move payload into bigger buffer
+template<typename Field, typename... Fields>
+struct RunWriter<true, true, Field, Fields...>
+{
+    template<typename Argument, typename... Arguments>
+    static void write(uint8_t *data, WriteStream &writeStream, const Argument &argument, const Arguments&... arguments)
+    {
+        Field::write(data, writeStream, argument);
+        Encoder<Fields...>::encode(writeStream, arguments...);
+    }
+};
+
+template<typename Field, typename... Fields>
+struct RunReader<false, true, Field, Fields...>
+{
+    template<typename Argument, typename... Arguments>
+    static void read(const uint8_t *data, ReadStreamView &readStream, Argument &argument, Arguments&... arguments)
+    {
+        Field::read(data, argument);
+        NextRunReader<Fields...>::read(data + Field::kSize, readStream, arguments...);
+    }
+};
+
+template<typename Field, typename... Fields>
+struct RunReader<false, false, Field, Fields...>
+{
+    template<typename... Arguments>
+    static void read(const uint8_t *data, ReadStreamView &readStream, Arguments&... arguments)
+    {
+        NextRunReader<Fields...>::read(data + Field::kSize, readStream, arguments...);
+    }
+};
+
+template<typename Field, typename... Fields>
+struct RunReader<true, true, Field, Fields...>
+{
+    template<typename Argument, typename... Arguments>
+    static void read(const uint8_t *data, ReadStreamView &readStream, Argument &argument, Arguments&... arguments)
+    {
+        Field::read(data, readStream, argument);
+        Decoder<Fields...>::decode(readStream, arguments...);
+    }
+};
+
+template<typename... Fields>
+struct Encoder
+{
+    template<typename... Arguments>
+    static void encode(WriteStream &writeStream, const Arguments&... arguments)
+    {
+        uint8_t *data = writeStream.reserveNext(Run<Fields...>::kSize);
+        NextRunWriter<Fields...>::write(data, writeStream, arguments...);
+    }
+};
+
+template<>
+struct Encoder<>
+{
+    template<typename... Arguments>
+    static void encode(WriteStream&, const Arguments&...)
+    {
+        static_assert(sizeof...(Arguments) == 0, "More values given than message schema has fields.");
+    }
+};
+
+template<typename... Fields>
+struct Decoder
+{
+    template<typename... Arguments>
+    static void decode(ReadStreamView &readStream, Arguments&... arguments)
+    {
+        const uint8_t *data = readStream.readNextBlock(Run<Fields...>::kSize);
+        NextRunReader<Fields...>::read(data, readStream, arguments...);
+    }
+};
+
+template<>
+struct Decoder<>
+{
+    template<typename... Arguments>
+    static void decode(ReadStreamView&, Arguments&...)
+    {
+        static_assert(sizeof...(Arguments) == 0, "More values given than message schema has fields.");
+    }
+};
+
+}
+
+template<typename... Fields>
+struct Message
+{
+    // bytes covered by the first bounds check, whole message size when all fields are fixed
+    static const size_t kFixedPrefixSize = detail::Run<Fields...>::kSize;
+
+    template<typename... Arguments>
+    static void encode(WriteStream &writeStream, const Arguments&... arguments)
+    {
+        detail::Encoder<Fields...>::encode(writeStream, arguments...);
+    }
+
+    template<typename... Arguments>
+    static void decode(ReadStreamView &readStream, Arguments&... arguments)
+    {
+        detail::Decoder<Fields...>::decode(readStream, arguments...);
+    }
+};
+
+template<typename... Fields>
+const size_t Message<Fields...>::kFixedPrefixSize;
+
+}
+}
+}
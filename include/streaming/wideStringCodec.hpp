@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+#include <stdint.h>
+#include <cstdlib>
+
+namespace eMU
+{
+namespace streaming
+{
+
+// Converts UTF-8 strings to UTF-16LE and back without intermediate std::wstring.
+// Runs of ASCII are converted in blocks, invalid sequences are skipped.
+class WideStringCodec
+{
+public:
+    static size_t getEncodedLength(const std::string &value);
+    static void encode(const std::string &value, uint8_t *destination);
+    static void decode(const uint8_t *source, size_t length, std::string &value);
+};
+
+}
+}
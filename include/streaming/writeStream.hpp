@@ -1,51 +1,57 @@
-#pragma once
-
-#include <core/network/payload.hpp>
-#include <core/common/exception.hpp>
-
-#include <stdint.h>
-
-namespace eMU
-{
-namespace streaming
-{
-
-class WriteStream
-{
-public:
-    class OverflowException: public core::common::Exception {};
-
-    WriteStream(uint16_t id);
-    WriteStream();
-
-    const core::network::Payload& getPayload() const;
-
-    template<typename T>
-    void writeNext(const T &value)
-    {
-        size_t typeSize = sizeof(T);
-
-        if(typeSize + currentOffset_ > payload_.getMaxSize())
-        {
-            throw OverflowException();
-        }
-
-        T &destination = reinterpret_cast<T&>(payload_[currentOffset_]);
-        destination = value;
-
-        currentOffset_ += typeSize;
-        size_ += typeSize;
-        payload_.setSize(size_ + sizeof(uint32_t));
-    }
-
-    void writeNextWideString(const std::wstring &value);
-    void writeNextString(const std::string &value);
-
-private:
-    core::network::Payload payload_;
-    uint32_t currentOffset_;
-    uint32_t &size_;
-};
-
-}
-}
+#pragma once
+
+#include <core/network/payload.hpp>
+#include <core/common/exception.hpp>
+
+#include <stdint.h>
+#include <string.h>
+#include <string>
+
+namespace eMU
+{
+namespace streaming
+{
+
+class WriteStream
+{
+public:
+    class OverflowException: public core::common::Exception {};
+
+    WriteStream(uint16_t id);
+    WriteStream();
+
+    const core::network::Payload& getPayload() const;
+
+    template<typename T>
+    void writeNext(const T &value)
+    {
+        size_t typeSize = sizeof(T);
+
+        if(typeSize + currentOffset_ > payload_.getMaxSize())
+        {
+            throw OverflowException();
+        }
+
+        payload_.setSize(currentOffset_ + typeSize);
+        memcpy(&payload_[currentOffset_], &value, typeSize);
+
+        currentOffset_ += typeSize;
+        this->writeSize();
+    }
+
+    void writeNextWideString(const std::wstring &value);
+    void writeNextWideString(const std::string &value); // UTF-8 value is written as UTF-16LE
+    void writeNextString(const std::string &value);
+
+    // bounds checks and appends size bytes at once, returned memory is valid until next write
+    uint8_t* reserveNext(size_t size);
+
+private:
+    void writeSize();
+
+    core::network::Payload payload_;
+    uint32_t currentOffset_;
+};
+
+}
+}
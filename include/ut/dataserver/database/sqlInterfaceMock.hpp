@@ -1,35 +1,39 @@
-#pragma once
-
-#include <dataserver/database/sqlInterface.hpp>
-
-#include <gmock/gmock.h>
-
-namespace eMU
-{
-namespace ut
-{
-namespace env
-{
-namespace dataserver
-{
-namespace database
-{
-
-class SqlInterfaceMock: public eMU::dataserver::database::SqlInterface
-{
-public:
-    MOCK_METHOD0(initialize, bool());
-    MOCK_METHOD5(connect, bool(const std::string &hostname, uint16_t port, const std::string &userName,
-                               const std::string &password, const std::string &databaseName));
-    MOCK_METHOD0(cleanup, void());
-    MOCK_METHOD0(getErrorMessage, std::string());
-    MOCK_METHOD1(executeQuery, bool(std::string query));
-    MOCK_METHOD0(fetchQueryResult, eMU::dataserver::database::QueryResult());
-    MOCK_METHOD0(isAlive, bool());
-};
-
-}
-}
-}
-}
-}
+#pragma once
+
+#include <dataserver/database/sqlInterface.hpp>
+
+#include <gmock/gmock.h>
+
+namespace eMU
+{
+namespace ut
+{
+namespace env
+{
+namespace dataserver
+{
+namespace database
+{
+
+class SqlInterfaceMock: public eMU::dataserver::database::SqlInterface
+{
+public:
+    MOCK_METHOD0(initialize, bool());
+    MOCK_METHOD5(connect, bool(const std::string &hostname, uint16_t port, const std::string &userName,
+                               const std::string &password, const std::string &databaseName));
+    MOCK_METHOD0(cleanup, void());
+    MOCK_METHOD0(getErrorMessage, std::string());
+    MOCK_METHOD1(executeQuery, bool(std::string query));
+    MOCK_METHOD2(executeStatement, bool(eMU::dataserver::database::Statement::Id statementId,
+                                        const eMU::dataserver::database::Statement::Parameters &parameters));
+    MOCK_METHOD0(fetchQueryResult, eMU::dataserver::database::QueryResult());
+    MOCK_METHOD0(isAlive, bool());
+    MOCK_METHOD0(isConnected, bool());
+    MOCK_METHOD0(reconnect, bool());
+};
+
+}
+}
+}
+}
+}
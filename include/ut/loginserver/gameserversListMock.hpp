@@ -1,26 +1,29 @@
-#pragma once
-
-#include <gmock/gmock.h>
-#include <loginserver/gameserversList.hpp>
-
-namespace eMU
-{
-namespace ut
-{
-namespace env
-{
-namespace loginserver
-{
-
-class GameserversListMock: public eMU::loginserver::GameserversList
-{
-public:
-    MOCK_CONST_METHOD0(getServers, const streaming::loginserver::GameserversInfoContainer&());
-    MOCK_CONST_METHOD1(hasGameserver, bool(uint16_t code));
-    MOCK_CONST_METHOD1(getGameserverInfo, const streaming::loginserver::GameserverInfo&(uint16_t code));
-};
-
-}
-}
-}
-}
+#pragma once
+
+#include <gmock/gmock.h>
+#include <loginserver/gameserversList.hpp>
+
+namespace eMU
+{
+namespace ut
+{
+namespace env
+{
+namespace loginserver
+{
+
+class GameserversListMock: public eMU::loginserver::GameserversList
+{
+public:
+    MOCK_CONST_METHOD0(getServers, streaming::loginserver::GameserversInfoContainer());
+    MOCK_CONST_METHOD0(getListResponse, eMU::loginserver::GameserversList::PayloadPointer());
+    MOCK_CONST_METHOD1(hasGameserver, bool(uint16_t code));
+    MOCK_CONST_METHOD2(findGameserverInfo, bool(uint16_t code, streaming::loginserver::GameserverInfo &info));
+    MOCK_CONST_METHOD2(selectGameserver, bool(uint16_t requestedCode, streaming::loginserver::GameserverInfo &info));
+    MOCK_METHOD3(updateLoad, bool(uint16_t code, uint32_t numberOfUsers, uint32_t maxNumberOfUsers));
+};
+
+}
+}
+}
+}
@@ -1 +1 @@
-#include <analyzer/gui/gui.hpp>
+#include <analyzer/gui/gui.hpp>
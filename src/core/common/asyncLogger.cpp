@@ -0,0 +1,330 @@
+#include <core/common/asyncLogger.hpp>
+
+#include <cstdlib>
+#include <string.h>
+#include <stdio.h>
+#include <thread>
+
+namespace eMU
+{
+namespace core
+{
+namespace common
+{
+
+// Head is advanced only by owning thread, tail only by writer.
+class LogRing: boost::noncopyable
+{
+public:
+    static const size_t kCapacity = 1024;
+
+    LogRing():
+        head_(0),
+        acquired_(false),
+        tail_(0),
+        closed_(false) {}
+
+    LogSlot slots_[kCapacity];
+
+    std::atomic<size_t> head_;
+    bool acquired_;
+    char padding_[64];
+    std::atomic<size_t> tail_;
+    std::atomic<bool> closed_;
+};
+
+namespace
+{
+
+// Ring of exited thread is released by writer once drained.
+struct ThreadRing
+{
+    ~ThreadRing()
+    {
+        if(ring_)
+        {
+            ring_->closed_.store(true, std::memory_order_release);
+        }
+    }
+
+    std::shared_ptr<LogRing> ring_;
+};
+
+thread_local ThreadRing threadRing;
+
+void appendNumber(std::string &text, uint64_t value)
+{
+    char digits[20];
+    size_t count = 0;
+
+    do
+    {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    while(value > 0);
+
+    while(count > 0)
+    {
+        text.push_back(digits[--count]);
+    }
+}
+
+}
+
+AsyncLogger& AsyncLogger::getInstance()
+{
+    // never destroyed, statics destroyed after exit handlers may still log
+    static AsyncLogger *instance = createInstance();
+    return *instance;
+}
+
+AsyncLogger* AsyncLogger::createInstance()
+{
+    AsyncLogger *instance = new AsyncLogger();
+    std::atexit([]() { AsyncLogger::getInstance().stop(); });
+
+    return instance;
+}
+
+std::string AsyncLogger::format(const LogSlot &slot)
+{
+    std::string text;
+    text.reserve(2 * LogSlot::kDataSize);
+
+    text.append("[").append(slot.file_).append(":");
+    appendNumber(text, static_cast<uint64_t>(slot.line_));
+    text.append("] ");
+
+    const uint8_t *data = slot.data_;
+    const uint8_t *end = data + slot.size_;
+
+    while(data < end)
+    {
+        LogArgumentType type = static_cast<LogArgumentType>(*data++);
+
+        if(type == LogArgumentType::SIGNED)
+        {
+            int64_t value = 0;
+            memcpy(&value, data, sizeof(value));
+            data += sizeof(value);
+
+            if(value < 0)
+            {
+                text.push_back('-');
+            }
+
+            appendNumber(text, value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value));
+        }
+        else if(type == LogArgumentType::UNSIGNED)
+        {
+            uint64_t value = 0;
+            memcpy(&value, data, sizeof(value));
+            data += sizeof(value);
+            appendNumber(text, value);
+        }
+        else if(type == LogArgumentType::FLOATING)
+        {
+            double value = 0;
+            memcpy(&value, data, sizeof(value));
+            data += sizeof(value);
+
+            // same as default stream formatting
+            char buffer[32];
+            text.append(buffer, snprintf(buffer, sizeof(buffer), "%g", value));
+        }
+        else if(type == LogArgumentType::CHARACTER)
+        {
+            text.push_back(static_cast<char>(*data++));
+        }
+        else
+        {
+            uint16_t length = 0;
+            memcpy(&length, data, sizeof(length));
+            data += sizeof(length);
+            text.append(reinterpret_cast<const char*>(data), length);
+            data += length;
+        }
+    }
+
+    if(slot.truncated_)
+    {
+        text.append("...");
+    }
+
+    return text;
+}
+
+void AsyncLogger::write(const LogSlot &slot)
+{
+    BOOST_LOG_SEV(::boost::log::trivial::logger::get(), slot.severity_) << format(slot);
+}
+
+AsyncLogger::AsyncLogger():
+    running_(true),
+    numberOfWrittenRecords_(0),
+    numberOfSynchronousRecords_(0)
+{
+    writer_ = boost::thread(&AsyncLogger::work, this);
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    this->stop();
+}
+
+LogSlot* AsyncLogger::acquire()
+{
+    if(!running_.load(std::memory_order_relaxed))
+    {
+        return nullptr;
+    }
+
+    LogRing &ring = this->getThreadRing();
+
+    // record logged while another one of this thread is being built
+    if(ring.acquired_)
+    {
+        return nullptr;
+    }
+
+    size_t head = ring.head_.load(std::memory_order_relaxed);
+
+    if(head - ring.tail_.load(std::memory_order_acquire) == LogRing::kCapacity)
+    {
+        return nullptr;
+    }
+
+    ring.acquired_ = true;
+
+    return &ring.slots_[head % LogRing::kCapacity];
+}
+
+void AsyncLogger::commit()
+{
+    LogRing &ring = this->getThreadRing();
+
+    ring.head_.store(ring.head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    ring.acquired_ = false;
+}
+
+void AsyncLogger::flush()
+{
+    while(running_)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            bool empty = true;
+
+            for(const auto &ring : rings_)
+            {
+                empty = empty && ring->tail_.load(std::memory_order_acquire) == ring->head_.load(std::memory_order_acquire);
+            }
+
+            if(empty)
+            {
+                return;
+            }
+        }
+
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    this->drain();
+}
+
+void AsyncLogger::stop()
+{
+    if(!running_.exchange(false))
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_.notify_one();
+    }
+
+    writer_.join();
+    this->drain();
+}
+
+uint64_t AsyncLogger::getNumberOfWrittenRecords() const
+{
+    return numberOfWrittenRecords_;
+}
+
+uint64_t AsyncLogger::getNumberOfSynchronousRecords() const
+{
+    return numberOfSynchronousRecords_;
+}
+
+void AsyncLogger::countSynchronousRecord()
+{
+    ++numberOfSynchronousRecords_;
+}
+
+LogRing& AsyncLogger::getThreadRing()
+{
+    if(!threadRing.ring_)
+    {
+        threadRing.ring_ = std::make_shared<LogRing>();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        rings_.push_back(threadRing.ring_);
+    }
+
+    return *threadRing.ring_;
+}
+
+void AsyncLogger::work()
+{
+    while(running_)
+    {
+        if(this->drain() > 0)
+        {
+            continue;
+        }
+
+        // producers do not signal new records, short sleep keeps syscalls out of their path
+        std::unique_lock<std::mutex> lock(mutex_);
+        stopped_.wait_for(lock, std::chrono::milliseconds(1), [this]() { return !running_; });
+    }
+}
+
+size_t AsyncLogger::drain()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t numberOfRecords = 0;
+
+    for(auto ring = rings_.begin(); ring != rings_.end();)
+    {
+        // closed flag is read first, records committed before thread exit are then visible
+        bool closed = (*ring)->closed_.load(std::memory_order_acquire);
+        size_t head = (*ring)->head_.load(std::memory_order_acquire);
+
+        for(size_t tail = (*ring)->tail_.load(std::memory_order_relaxed); tail != head; ++tail)
+        {
+            write((*ring)->slots_[tail % LogRing::kCapacity]);
+            (*ring)->tail_.store(tail + 1, std::memory_order_release);
+            ++numberOfRecords;
+        }
+
+        if(closed)
+        {
+            ring = rings_.erase(ring);
+        }
+        else
+        {
+            ++ring;
+        }
+    }
+
+    numberOfWrittenRecords_ += numberOfRecords;
+
+    return numberOfRecords;
+}
+
+}
+}
+}
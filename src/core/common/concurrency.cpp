@@ -1,29 +1,107 @@
-#include <core/common/concurrency.hpp>
-
-namespace eMU
-{
-namespace core
-{
-namespace common
-{
-
-Concurrency::Concurrency(asio::io_service &ioService, size_t maxNumberOfThreads):
-    ioService_(ioService),
-    maxNumberOfThreads_(maxNumberOfThreads) {}
-
-void Concurrency::start()
-{
-    for(size_t i = 0; i < maxNumberOfThreads_; ++i)
-    {
-        threads_.create_thread(std::bind(static_cast<size_t (asio::io_service::*)()>(&asio::io_service::run), &ioService_));
-    }
-}
-
-void Concurrency::join()
-{
-    threads_.join_all();
-}
-
-}
-}
-}
+#include <core/common/concurrency.hpp>
+#include <core/common/logging.hpp>
+
+#include <pthread.h>
+
+namespace eMU
+{
+namespace core
+{
+namespace common
+{
+
+Concurrency::Concurrency(asio::io_service &ioService, size_t maxNumberOfThreads):
+    Concurrency(ioService, maxNumberOfThreads, Model::SHARED_IO_SERVICE) {}
+
+Concurrency::Concurrency(asio::io_service &ioService, size_t maxNumberOfThreads, Model model):
+    ioService_(ioService),
+    maxNumberOfThreads_(maxNumberOfThreads),
+    model_(model),
+    nextIoService_(0)
+{
+    ioServices_.push_back(&ioService_);
+
+    if(model_ == Model::IO_SERVICE_PER_THREAD)
+    {
+        for(size_t i = 1; i < maxNumberOfThreads_; ++i)
+        {
+            ownedIoServices_.push_back(std::unique_ptr<asio::io_service>(new asio::io_service()));
+            ioServices_.push_back(ownedIoServices_.back().get());
+        }
+
+        for(asio::io_service *ioService : ioServices_)
+        {
+            works_.push_back(std::unique_ptr<asio::io_service::work>(new asio::io_service::work(*ioService)));
+        }
+    }
+}
+
+Concurrency::~Concurrency() {}
+
+void Concurrency::start()
+{
+    for(size_t i = 0; i < maxNumberOfThreads_; ++i)
+    {
+        if(model_ == Model::IO_SERVICE_PER_THREAD)
+        {
+            boost::thread *thread = threads_.create_thread(std::bind(&Concurrency::run, this, i));
+
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            CPU_SET(i % boost::thread::hardware_concurrency(), &cpuSet);
+
+            if(pthread_setaffinity_np(thread->native_handle(), sizeof(cpuSet), &cpuSet) != 0)
+            {
+                eMU_LOG(warning) << "Could not pin event loop " << i << " to cpu.";
+            }
+        }
+        else
+        {
+            threads_.create_thread(std::bind(&Concurrency::run, this, 0));
+        }
+    }
+}
+
+void Concurrency::join()
+{
+    threads_.join_all();
+}
+
+void Concurrency::stop()
+{
+    works_.clear();
+
+    for(asio::io_service *ioService : ioServices_)
+    {
+        ioService->stop();
+    }
+}
+
+Concurrency::Model Concurrency::getModel() const
+{
+    return model_;
+}
+
+size_t Concurrency::getNumberOfIoServices() const
+{
+    return ioServices_.size();
+}
+
+asio::io_service& Concurrency::getIoService(size_t index)
+{
+    return *ioServices_[index];
+}
+
+asio::io_service& Concurrency::getNextIoService()
+{
+    return *ioServices_[nextIoService_++ % ioServices_.size()];
+}
+
+void Concurrency::run(size_t index)
+{
+    ioServices_[index]->run();
+}
+
+}
+}
+}
@@ -1,12 +1,12 @@
-#include <core/common/factory.hpp>
-
-namespace eMU
-{
-namespace core
-{
-namespace common
-{
-
-}
-}
-}
+#include <core/common/factory.hpp>
+
+namespace eMU
+{
+namespace core
+{
+namespace common
+{
+
+}
+}
+}
@@ -0,0 +1,98 @@
+#include <core/common/logging.hpp>
+#include <core/common/asyncLogger.hpp>
+
+#include <string.h>
+
+namespace eMU
+{
+namespace core
+{
+namespace common
+{
+
+LogRecord::LogRecord(boost::log::trivial::severity_level severity, const char *file, int line):
+    slot_(AsyncLogger::getInstance().acquire())
+{
+    if(slot_ == nullptr)
+    {
+        slot_ = &localSlot_;
+    }
+
+    slot_->severity_ = severity;
+    slot_->file_ = file;
+    slot_->line_ = line;
+    slot_->size_ = 0;
+    slot_->truncated_ = false;
+}
+
+LogRecord::~LogRecord()
+{
+    if(slot_ == &localSlot_)
+    {
+        AsyncLogger::getInstance().countSynchronousRecord();
+        AsyncLogger::write(localSlot_);
+    }
+    else
+    {
+        AsyncLogger::getInstance().commit();
+    }
+}
+
+LogRecord& LogRecord::operator<<(const char *value)
+{
+    this->appendString(value, value != nullptr ? strlen(value) : 0);
+    return *this;
+}
+
+LogRecord& LogRecord::operator<<(const std::string &value)
+{
+    this->appendString(value.data(), value.length());
+    return *this;
+}
+
+void LogRecord::appendValue(LogArgumentType type, const void *value, size_t size)
+{
+    if(slot_->truncated_ || slot_->size_ + 1 + size > LogSlot::kDataSize)
+    {
+        slot_->truncated_ = true;
+        return;
+    }
+
+    uint8_t *data = slot_->data_ + slot_->size_;
+    *data = static_cast<uint8_t>(type);
+    memcpy(data + 1, value, size);
+
+    slot_->size_ += 1 + size;
+}
+
+void LogRecord::appendString(const char *value, size_t length)
+{
+    const size_t kHeaderSize = 1 + sizeof(uint16_t);
+
+    if(slot_->truncated_ || slot_->size_ + kHeaderSize > LogSlot::kDataSize)
+    {
+        slot_->truncated_ = true;
+        return;
+    }
+
+    size_t available = LogSlot::kDataSize - slot_->size_ - kHeaderSize;
+
+    if(length > available)
+    {
+        length = available;
+        slot_->truncated_ = true;
+    }
+
+    uint8_t *data = slot_->data_ + slot_->size_;
+    uint16_t storedLength = static_cast<uint16_t>(length);
+
+    *data = static_cast<uint8_t>(LogArgumentType::STRING);
+    memcpy(data + 1, &storedLength, sizeof(storedLength));
+    memcpy(data + kHeaderSize, value, length);
+
+    slot_->size_ += kHeaderSize + length;
+}
+
+}
+}
+}
@@ -0,0 +1,39 @@
+#include <core/metrics/counter.hpp>
+
+namespace eMU
+{
+namespace core
+{
+namespace metrics
+{
+
+namespace
+{
+std::atomic<size_t> nextThreadShard(0);
+}
+
+const size_t Counter::kNumberOfShards;
+
+Counter::Counter() {}
+
+uint64_t Counter::getValue() const
+{
+    uint64_t value = 0;
+
+    for(const auto &shard : shards_)
+    {
+        value += shard.value_.load(std::memory_order_relaxed);
+    }
+
+    return value;
+}
+
+size_t Counter::getThreadShard()
+{
+    static thread_local size_t shard = nextThreadShard++ % kNumberOfShards;
+    return shard;
+}
+
+}
+}
+}
@@ -0,0 +1,86 @@
+#include <core/metrics/exporter.hpp>
+
+#include <core/common/logging.hpp>
+
+namespace eMU
+{
+namespace core
+{
+namespace metrics
+{
+
+struct Exporter::Scrape
+{
+    Scrape(boost::asio::io_service &ioService):
+        socket_(ioService) {}
+
+    boost::asio::ip::tcp::socket socket_;
+    boost::asio::streambuf request_;
+    std::string response_;
+};
+
+Exporter::Exporter(boost::asio::io_service &ioService, uint16_t port, Registry &registry):
+    ioService_(ioService),
+    acceptor_(ioService, boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), port)),
+    registry_(registry),
+    numberOfScrapes_(0) {}
+
+void Exporter::queueAccept()
+{
+    std::shared_ptr<Scrape> scrape = std::make_shared<Scrape>(ioService_);
+
+    acceptor_.async_accept(scrape->socket_, std::bind(&Exporter::acceptHandler, this, scrape, std::placeholders::_1));
+}
+
+uint64_t Exporter::getNumberOfScrapes() const
+{
+    return numberOfScrapes_;
+}
+
+void Exporter::acceptHandler(std::shared_ptr<Scrape> scrape, const boost::system::error_code &errorCode)
+{
+    if(errorCode)
+    {
+        eMU_LOG(error) << "Metrics exporter, accept failed, error: " << errorCode.message();
+    }
+    else
+    {
+        boost::asio::async_read_until(scrape->socket_, scrape->request_, "\r\n\r\n",
+                                      std::bind(&Exporter::requestHandler, this, scrape, std::placeholders::_1));
+    }
+
+    if(errorCode != boost::asio::error::operation_aborted)
+    {
+        this->queueAccept();
+    }
+}
+
+void Exporter::requestHandler(std::shared_ptr<Scrape> scrape, const boost::system::error_code &errorCode)
+{
+    // scraper may close its side right after request, response is sent anyway
+    if(errorCode && errorCode != boost::asio::error::eof)
+    {
+        eMU_LOG(warning) << "Metrics exporter, reading request failed, error: " << errorCode.message();
+        return;
+    }
+
+    std::string body = registry_.format();
+
+    scrape->response_ = "HTTP/1.0 200 OK\r\n"
+                        "Content-Type: text/plain; version=0.0.4\r\n"
+                        "Content-Length: " + std::to_string(body.length()) + "\r\n"
+                        "\r\n" + body;
+
+    ++numberOfScrapes_;
+
+    boost::asio::async_write(scrape->socket_, boost::asio::buffer(scrape->response_), [scrape](const boost::system::error_code&, size_t)
+    {
+        boost::system::error_code ignoredError;
+        scrape->socket_.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ignoredError);
+        scrape->socket_.close(ignoredError);
+    });
+}
+
+}
+}
+}
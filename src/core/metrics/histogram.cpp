@@ -0,0 +1,111 @@
+#include <core/metrics/histogram.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace eMU
+{
+namespace core
+{
+namespace metrics
+{
+
+const size_t Histogram::kSubBucketBits;
+const size_t Histogram::kSubBucketCount;
+const size_t Histogram::kNumberOfBuckets;
+
+Histogram::Histogram():
+    count_(0),
+    sum_(0),
+    max_(0)
+{
+    for(auto &bucket : buckets_)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+void Histogram::record(uint64_t value)
+{
+    buckets_[getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t max = max_.load(std::memory_order_relaxed);
+
+    while(value > max && !max_.compare_exchange_weak(max, value, std::memory_order_relaxed));
+}
+
+uint64_t Histogram::getCount() const
+{
+    return count_.load(std::memory_order_relaxed);
+}
+
+uint64_t Histogram::getSum() const
+{
+    return sum_.load(std::memory_order_relaxed);
+}
+
+uint64_t Histogram::getMax() const
+{
+    return max_.load(std::memory_order_relaxed);
+}
+
+uint64_t Histogram::getValueAtPercentile(double percentile) const
+{
+    uint64_t count = 0;
+
+    for(const auto &bucket : buckets_)
+    {
+        count += bucket.load(std::memory_order_relaxed);
+    }
+
+    if(count == 0)
+    {
+        return 0;
+    }
+
+    uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / 100 * count)));
+    uint64_t cumulativeCount = 0;
+
+    for(size_t i = 0; i < kNumberOfBuckets; ++i)
+    {
+        cumulativeCount += buckets_[i].load(std::memory_order_relaxed);
+
+        if(cumulativeCount >= rank)
+        {
+            return std::min(getBucketUpperBound(i), this->getMax());
+        }
+    }
+
+    return this->getMax();
+}
+
+size_t Histogram::getBucketIndex(uint64_t value)
+{
+    if(value < kSubBucketCount)
+    {
+        return value;
+    }
+
+    size_t shift = 63 - __builtin_clzll(value) - kSubBucketBits;
+
+    return (shift + 1) * kSubBucketCount + ((value >> shift) & (kSubBucketCount - 1));
+}
+
+uint64_t Histogram::getBucketUpperBound(size_t index)
+{
+    if(index < kSubBucketCount)
+    {
+        return index;
+    }
+
+    size_t shift = index / kSubBucketCount - 1;
+    uint64_t lowerBound = static_cast<uint64_t>(kSubBucketCount + index % kSubBucketCount) << shift;
+
+    return lowerBound + ((static_cast<uint64_t>(1) << shift) - 1);
+}
+
+}
+}
+}
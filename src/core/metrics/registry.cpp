@@ -0,0 +1,156 @@
+#include <core/metrics/registry.hpp>
+
+#include <sstream>
+
+namespace eMU
+{
+namespace core
+{
+namespace metrics
+{
+
+namespace
+{
+
+const double kQuantiles[] = {0.5, 0.9, 0.99, 0.999};
+
+std::string joinLabels(const std::string &labels, const std::string &extraLabel)
+{
+    if(labels.empty() && extraLabel.empty())
+    {
+        return "";
+    }
+
+    return "{" + labels + (!labels.empty() && !extraLabel.empty() ? "," : "") + extraLabel + "}";
+}
+
+}
+
+Registry& Registry::getInstance()
+{
+    static Registry registry;
+    return registry;
+}
+
+Registry::Registry() {}
+
+Counter& Registry::getCounter(const std::string &name, const std::string &help, const std::string &labels)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_ptr<Counter> &counter = this->getFamily(name, help, Type::COUNTER).counters_[labels];
+
+    if(!counter)
+    {
+        counter.reset(new Counter());
+    }
+
+    return *counter;
+}
+
+Gauge& Registry::getGauge(const std::string &name, const std::string &help, const std::string &labels)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_ptr<Gauge> &gauge = this->getFamily(name, help, Type::GAUGE).gauges_[labels];
+
+    if(!gauge)
+    {
+        gauge.reset(new Gauge());
+    }
+
+    return *gauge;
+}
+
+Histogram& Registry::getHistogram(const std::string &name, const std::string &help, const std::string &labels)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_ptr<Histogram> &histogram = this->getFamily(name, help, Type::SUMMARY).histograms_[labels];
+
+    if(!histogram)
+    {
+        histogram.reset(new Histogram());
+    }
+
+    return *histogram;
+}
+
+void Registry::addGaugeCallback(const std::string &name, const std::string &help, const Callback &callback, const std::string &labels)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    this->getFamily(name, help, Type::GAUGE).callbacks_[labels] = callback;
+}
+
+std::string Registry::format() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::ostringstream stream;
+
+    for(const auto &family : families_)
+    {
+        const std::string &name = family.first;
+
+        stream << "# HELP " << name << " " << family.second.help_ << "\n";
+
+        if(family.second.type_ == Type::COUNTER)
+        {
+            stream << "# TYPE " << name << " counter\n";
+
+            for(const auto &counter : family.second.counters_)
+            {
+                stream << name << joinLabels(counter.first, "") << " " << counter.second->getValue() << "\n";
+            }
+        }
+        else if(family.second.type_ == Type::GAUGE)
+        {
+            stream << "# TYPE " << name << " gauge\n";
+
+            for(const auto &gauge : family.second.gauges_)
+            {
+                stream << name << joinLabels(gauge.first, "") << " " << gauge.second->getValue() << "\n";
+            }
+
+            for(const auto &callback : family.second.callbacks_)
+            {
+                stream << name << joinLabels(callback.first, "") << " " << callback.second() << "\n";
+            }
+        }
+        else
+        {
+            stream << "# TYPE " << name << " summary\n";
+
+            for(const auto &histogram : family.second.histograms_)
+            {
+                for(double quantile : kQuantiles)
+                {
+                    std::ostringstream quantileLabel;
+                    quantileLabel << "quantile=\"" << quantile << "\"";
+
+                    stream << name << joinLabels(histogram.first, quantileLabel.str()) << " "
+                           << histogram.second->getValueAtPercentile(quantile * 100) << "\n";
+                }
+
+                stream << name << "_sum" << joinLabels(histogram.first, "") << " " << histogram.second->getSum() << "\n";
+                stream << name << "_count" << joinLabels(histogram.first, "") << " " << histogram.second->getCount() << "\n";
+            }
+        }
+    }
+
+    return stream.str();
+}
+
+Registry::Family& Registry::getFamily(const std::string &name, const std::string &help, Type type)
+{
+    auto family = families_.find(name);
+
+    if(family == families_.end())
+    {
+        family = families_.insert(std::make_pair(name, Family())).first;
+        family->second.type_ = type;
+        family->second.help_ = help;
+    }
+
+    return family->second;
+}
+
+}
+}
+}
@@ -1,70 +1,183 @@
-#include <core/network/payload.hpp>
-
-#include <iomanip>
-
-namespace eMU
-{
-namespace core
-{
-namespace network
-{
-
-Payload::Payload():
-    data_(getMaxSize(), 0),
-    size_(0) {}
-
-size_t Payload::getMaxSize()
-{
-    return 4096;
-}
-
-size_t Payload::getSize() const
-{
-    return size_;
-}
-
-void Payload::setSize(size_t newSize)
-{
-    if(newSize > getMaxSize())
-    {
-        throw SizeOutOfBoundException();
-    }
-
-    size_ = newSize;
-}
-
-void Payload::clear()
-{
-    data_.clear();
-    data_.resize(getMaxSize(), 0);
-    size_ = 0;
-}
-
-bool Payload::empty() const
-{
-    return size_ == 0;
-}
-
-uint8_t& Payload::operator[](size_t offset)
-{
-    return data_[offset];
-}
-
-const uint8_t& Payload::operator[](size_t offset) const
-{
-    return data_[offset];
-}
-
-std::ostream& operator<<(std::ostream &out, const Payload &payload)
-{
-    for(size_t i = 0; i < payload.getSize(); ++i)
-    {
-        out << std::hex << std::setfill('0') << std::setw(2) << static_cast<uint32_t>(payload[i]) << " ";
-    }
-
-    return out;
-}
-
-}
-}
-}
+#include <core/network/payload.hpp>
+#include <core/network/payloadPool.hpp>
+
+#include <iomanip>
+#include <string.h>
+
+namespace eMU
+{
+namespace core
+{
+namespace network
+{
+
+Payload::Payload():
+    data_(inlineData_),
+    size_(0),
+    capacity_(kInlineCapacity) {}
+
+Payload::Payload(const Payload &payload):
+    data_(inlineData_),
+    size_(0),
+    capacity_(kInlineCapacity)
+{
+    this->setSize(payload.size_);
+    memcpy(data_, payload.data_, size_);
+}
+
+Payload::Payload(Payload &&payload):
+    data_(inlineData_),
+    size_(0),
+    capacity_(kInlineCapacity)
+{
+    this->moveFrom(payload);
+}
+
+Payload::~Payload()
+{
+    this->releaseChunk();
+}
+
+Payload& Payload::operator=(const Payload &payload)
+{
+    if(this != &payload)
+    {
+        this->setSize(payload.size_);
+        memcpy(data_, payload.data_, size_);
+    }
+
+    return *this;
+}
+
+Payload& Payload::operator=(Payload &&payload)
+{
+    if(this != &payload)
+    {
+        this->releaseChunk();
+        this->moveFrom(payload);
+    }
+
+    return *this;
+}
+
+size_t Payload::getMaxSize()
+{
+    return PayloadPool::getChunkSize();
+}
+
+size_t Payload::getInlineCapacity()
+{
+    return kInlineCapacity;
+}
+
+size_t Payload::getSize() const
+{
+    return size_;
+}
+
+void Payload::setSize(size_t newSize)
+{
+    this->reserve(newSize);
+    size_ = newSize;
+}
+
+size_t Payload::getCapacity() const
+{
+    return capacity_;
+}
+
+void Payload::reserve(size_t capacity)
+{
+    if(capacity <= capacity_)
+    {
+        return;
+    }
+
+    if(capacity > getMaxSize())
+    {
+        throw SizeOutOfBoundException();
+    }
+
+    // bytes past size_ may already be written by callers which set size afterwards
+    uint8_t *chunk = PayloadPool::getThreadInstance().acquire();
+    memcpy(chunk, data_, capacity_);
+
+    data_ = chunk;
+    capacity_ = getMaxSize();
+}
+
+void Payload::clear()
+{
+    size_ = 0;
+}
+
+bool Payload::empty() const
+{
+    return size_ == 0;
+}
+
+uint8_t& Payload::operator[](size_t offset)
+{
+    if(offset >= capacity_)
+    {
+        this->reserve(offset + 1);
+    }
+
+    return data_[offset];
+}
+
+const uint8_t& Payload::operator[](size_t offset) const
+{
+    return data_[offset];
+}
+
+bool Payload::isInline() const
+{
+    return data_ == inlineData_;
+}
+
+void Payload::releaseChunk()
+{
+    if(!this->isInline())
+    {
+        PayloadPool::release(data_);
+
+        data_ = inlineData_;
+        capacity_ = kInlineCapacity;
+    }
+
+    size_ = 0;
+}
+
+void Payload::moveFrom(Payload &payload)
+{
+    if(payload.isInline())
+    {
+        memcpy(inlineData_, payload.inlineData_, payload.size_);
+    }
+    else
+    {
+        data_ = payload.data_;
+        capacity_ = payload.capacity_;
+
+        payload.data_ = payload.inlineData_;
+        payload.capacity_ = kInlineCapacity;
+    }
+
+    size_ = payload.size_;
+    payload.size_ = 0;
+}
+
+std::ostream& operator<<(std::ostream &out, const Payload &payload)
+{
+    for(size_t i = 0; i < payload.getSize(); ++i)
+    {
+        out << std::hex << std::setfill('0') << std::setw(2) << static_cast<uint32_t>(payload[i]) << " ";
+    }
+
+    return out;
+}
+
+}
+}
+}
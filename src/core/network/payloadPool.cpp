@@ -0,0 +1,97 @@
+#include <core/network/payloadPool.hpp>
+
+namespace eMU
+{
+namespace core
+{
+namespace network
+{
+
+namespace
+{
+// Payloads may outlive the pool of the thread which releases them (e.g. statics destroyed at exit).
+thread_local bool threadPoolDestroyed = false;
+}
+
+PayloadPool& PayloadPool::getThreadInstance()
+{
+    static thread_local PayloadPool pool;
+    return pool;
+}
+
+void PayloadPool::release(uint8_t *chunk)
+{
+    if(threadPoolDestroyed)
+    {
+        delete[] chunk;
+        return;
+    }
+
+    getThreadInstance().cache(chunk);
+}
+
+PayloadPool::PayloadPool():
+    numberOfAllocatedChunks_(0)
+{
+    chunks_.reserve(getMaxNumberOfCachedChunks());
+}
+
+PayloadPool::~PayloadPool()
+{
+    for(uint8_t *chunk : chunks_)
+    {
+        delete[] chunk;
+    }
+
+    threadPoolDestroyed = true;
+}
+
+size_t PayloadPool::getChunkSize()
+{
+    return 4096;
+}
+
+size_t PayloadPool::getMaxNumberOfCachedChunks()
+{
+    return 256;
+}
+
+uint8_t* PayloadPool::acquire()
+{
+    if(chunks_.empty())
+    {
+        ++numberOfAllocatedChunks_;
+        return new uint8_t[getChunkSize()];
+    }
+
+    uint8_t *chunk = chunks_.back();
+    chunks_.pop_back();
+
+    return chunk;
+}
+
+void PayloadPool::cache(uint8_t *chunk)
+{
+    if(chunks_.size() < getMaxNumberOfCachedChunks())
+    {
+        chunks_.push_back(chunk);
+    }
+    else
+    {
+        delete[] chunk;
+    }
+}
+
+size_t PayloadPool::getNumberOfCachedChunks() const
+{
+    return chunks_.size();
+}
+
+size_t PayloadPool::getNumberOfAllocatedChunks() const
+{
+    return numberOfAllocatedChunks_;
+}
+
+}
+}
+}
@@ -0,0 +1,104 @@
+#include <core/common/logging.hpp>
+#include <core/network/readBuffer.hpp>
+#include <string.h>
+
+namespace eMU
+{
+namespace core
+{
+namespace network
+{
+
+ReadBuffer::ReadBuffer():
+    receivedSize_(0) {}
+
+size_t ReadBuffer::getStreamHeaderSize()
+{
+    return sizeof(uint32_t);
+}
+
+uint8_t* ReadBuffer::getFreeSpace()
+{
+    payload_.reserve(Payload::getMaxSize()); // idle connections keep only the inline buffer until first receive
+    return &payload_[receivedSize_];
+}
+
+size_t ReadBuffer::getFreeSpaceSize() const
+{
+    return Payload::getMaxSize() - receivedSize_;
+}
+
+bool ReadBuffer::insert(size_t bytesTransferred)
+{
+    receivedSize_ += bytesTransferred; // we should trust ASIO and belive that bytesTransfered never will be greater than free space
+
+    size_t completeSize = 0;
+
+    while(receivedSize_ - completeSize >= getStreamHeaderSize())
+    {
+        size_t streamSize = this->calculateStreamSize(completeSize);
+
+        if(streamSize > Payload::getMaxSize())
+        {
+            eMU_LOG(error) << "Stream size out of bound! size: " << streamSize;
+            return false;
+        }
+
+        if(completeSize + streamSize > receivedSize_)
+        {
+            break;
+        }
+
+        completeSize += streamSize;
+    }
+
+    payload_.setSize(completeSize);
+
+    return true;
+}
+
+void ReadBuffer::compact()
+{
+    size_t pendingSize = this->getPendingSize();
+
+    if(pendingSize > 0 && !payload_.empty())
+    {
+        memmove(&payload_[0], &payload_[payload_.getSize()], pendingSize);
+    }
+
+    receivedSize_ = pendingSize;
+    payload_.setSize(0);
+}
+
+void ReadBuffer::clear()
+{
+    receivedSize_ = 0;
+    payload_.setSize(0);
+}
+
+size_t ReadBuffer::getPendingSize() const
+{
+    return receivedSize_ - payload_.getSize();
+}
+
+Payload& ReadBuffer::getPayload()
+{
+    return payload_;
+}
+
+const Payload& ReadBuffer::getPayload() const
+{
+    return payload_;
+}
+
+size_t ReadBuffer::calculateStreamSize(size_t offset) const
+{
+    uint32_t size = 0;
+    memcpy(&size, &payload_[offset], sizeof(size));
+
+    return size + getStreamHeaderSize();
+}
+
+}
+}
+}
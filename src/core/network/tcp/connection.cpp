@@ -1,208 +1,289 @@
-#include <core/common/logging.hpp>
-#include <core/network/tcp/connection.hpp>
-#include <core/network/tcp/protocol.hpp>
-
-namespace eMU
-{
-namespace core
-{
-namespace network
-{
-namespace tcp
-{
-
-Connection::Connection(asio::io_service &ioService, Protocol &protocol):
-    protocol_(protocol),
-    socket_(ioService),
-    strand_(ioService),
-    closeOngoing_(false) {}
-
-Connection::~Connection() {}
-
-Payload& Connection::getReadPayload()
-{
-    return readPayload_;
-}
-
-void Connection::disconnect()
-{
-    if(this->isOpen())
-    {
-        closeOngoing_ = true;
-
-        asio::io_service &service = socket_.get_io_service();
-        service.post(strand_.wrap(std::bind(&Protocol::detach, &protocol_, shared_from_this())));
-    }
-}
-
-void Connection::close()
-{
-    try
-    {
-        socket_.shutdown(boost::asio::ip::tcp::socket::shutdown_both);
-        socket_.close();
-    }
-    catch(const boost::system::system_error &error)
-    {
-        eMU_LOG(warning) << "Error during closing socket, error: " << error.what()
-            << ", code: " << error.code();
-    }
-}
-
-void Connection::send(const Payload &payload)
-{
-    bool result = writeBuffer_.insert(payload);
-
-    if(!result)
-    {
-        this->errorHandler(boost::asio::error::no_buffer_space, "send");
-        return;
-    }
-
-    if(!writeBuffer_.isPending())
-    {
-        writeBuffer_.setPendingState();
-        this->queueSend();
-    }
-}
-
-void Connection::queueReceive()
-{
-    socket_.async_receive(boost::asio::buffer(&readPayload_[0], Payload::getMaxSize()),
-                          strand_.wrap(std::bind(&Connection::receiveHandler,
-                                       this,
-                                       std::placeholders::_1,
-                                       std::placeholders::_2)));
-}
-
-bool Connection::connect(const boost::asio::ip::tcp::endpoint &endpoint)
-{
-    boost::system::error_code errorCode;
-    socket_.connect(endpoint, errorCode);
-
-    if(!errorCode)
-    {
-        if(protocol_.attach(shared_from_this()))
-        {
-            this->queueReceive();
-            return true;
-        }
-        else
-        {
-            eMU_LOG(error) << "Connect, attach to protocol failed! Closing connection.";
-
-            this->close();
-            return false;
-        }
-    }
-    else
-    {
-        eMU_LOG(error) << "Error during connect, address: " << endpoint.address().to_string() << ", port: " <<  endpoint.port()
-            << ", error: " << errorCode.message() << ", code: " << errorCode.value();
-
-        if(this->isOpen())
-        {
-            this->close();
-        }
-
-        return false;
-    }
-}
-
-void Connection::queueSend()
-{
-    socket_.async_send(boost::asio::buffer(&writeBuffer_.getPayload()[0], writeBuffer_.getPayload().getSize()),
-                       strand_.wrap(std::bind(&Connection::sendHandler,
-                                    this,
-                                    std::placeholders::_1,
-                                    std::placeholders::_2)));
-}
-
-void Connection::receiveHandler(const boost::system::error_code &errorCode, size_t bytesTransferred)
-{
-    if(boost::asio::error::eof == errorCode)
-    {
-        this->disconnect();
-        return;
-    }
-    else if(errorCode)
-    {
-        this->errorHandler(errorCode, "receive");
-        return;
-    }
-
-    readPayload_.setSize(bytesTransferred); // we should trust ASIO and belive that bytesTransfered never will be greater than maxSize
-
-    if(!protocol_.dispatch(shared_from_this()))
-    {
-        eMU_LOG(error) << "Dispatch data failed. Disconnecting.";
-        this->disconnect();
-    }
-
-    if(!closeOngoing_)
-    {
-        this->queueReceive();
-    }
-}
-
-void Connection::sendHandler(const boost::system::error_code& errorCode, size_t bytesTransferred)
-{
-    if(errorCode)
-    {
-        this->errorHandler(errorCode, "send");
-        return;
-    }
-
-    if(writeBuffer_.getSecondPayload().getSize() > 0)
-    {
-        writeBuffer_.swap();
-        this->queueSend();
-    }
-    else
-        writeBuffer_.clear();
-}
-
-void Connection::errorHandler(const boost::system::error_code &errorCode, const std::string &operationName)
-{
-    eMU_LOG(error) << "Error during handling async operation: " << operationName
-        << ", error: " << errorCode.message()
-        << ", code: " << errorCode.value();
-
-    if(boost::asio::error::operation_aborted != errorCode)
-    {
-        this->disconnect();
-    }
-}
-
-bool Connection::isOpen() const
-{
-    return socket_.is_open();
-}
-
-asio::ip::tcp::socket& Connection::getSocket()
-{
-    return socket_;
-}
-
-void Connection::accept()
-{
-    if(protocol_.attach(shared_from_this()))
-    {
-        this->queueReceive();
-    }
-    else
-    {
-        eMU_LOG(error) << "Accept, attach to protocol failed! Closing connection.";
-        this->close();
-    }
-}
-
-bool Connection::operator==(const Connection &connection) const
-{
-    return reinterpret_cast<size_t>(this) == reinterpret_cast<size_t>(&connection);
-}
-
-}
-}
-}
-}
+#include <core/common/logging.hpp>
+#include <core/network/tcp/connection.hpp>
+#include <core/network/tcp/protocol.hpp>
+#include <core/metrics/registry.hpp>
+
+namespace eMU
+{
+namespace core
+{
+namespace network
+{
+namespace tcp
+{
+
+namespace
+{
+
+struct Metrics
+{
+    Metrics():
+        connections_(metrics::Registry::getInstance().getGauge("emu_tcp_connections", "Open tcp connections.")),
+        receivedBytes_(metrics::Registry::getInstance().getCounter("emu_tcp_received_bytes_total", "Bytes received over tcp.")),
+        sentBytes_(metrics::Registry::getInstance().getCounter("emu_tcp_sent_bytes_total", "Bytes sent over tcp.")),
+        writeQueueCongestions_(metrics::Registry::getInstance().getCounter("emu_tcp_write_queue_congestions_total",
+                                                                           "Write queues which reached high watermark.")),
+        errors_(metrics::Registry::getInstance().getCounter("emu_tcp_errors_total", "Failed tcp async operations.")) {}
+
+    metrics::Gauge &connections_;
+    metrics::Counter &receivedBytes_;
+    metrics::Counter &sentBytes_;
+    metrics::Counter &writeQueueCongestions_;
+    metrics::Counter &errors_;
+};
+
+Metrics& getMetrics()
+{
+    static Metrics metrics;
+    return metrics;
+}
+
+}
+
+Connection::Connection(asio::io_service &ioService, Protocol &protocol):
+    protocol_(protocol),
+    socket_(ioService),
+    strand_(ioService),
+    closeOngoing_(false),
+    writeQueueCongested_(false)
+{
+    getMetrics().connections_.increment();
+}
+
+Connection::~Connection()
+{
+    getMetrics().connections_.decrement();
+}
+
+Payload& Connection::getReadPayload()
+{
+    return readBuffer_.getPayload();
+}
+
+void Connection::disconnect()
+{
+    if(this->isOpen())
+    {
+        closeOngoing_ = true;
+
+        asio::io_service &service = socket_.get_io_service();
+        service.post(strand_.wrap(std::bind(&Protocol::detach, &protocol_, shared_from_this())));
+    }
+}
+
+void Connection::close()
+{
+    try
+    {
+        socket_.shutdown(boost::asio::ip::tcp::socket::shutdown_both);
+        socket_.close();
+    }
+    catch(const boost::system::system_error &error)
+    {
+        eMU_LOG(warning) << "Error during closing socket, error: " << error.what()
+            << ", code: " << error.code();
+    }
+}
+
+void Connection::send(const Payload &payload)
+{
+    if(!strand_.running_in_this_thread())
+    {
+        // sender lives on another strand or event loop, e.g. user transaction writing to dataserver connection
+        strand_.post(std::bind(&Connection::enqueue, shared_from_this(), payload));
+        return;
+    }
+
+    this->enqueue(payload);
+}
+
+void Connection::enqueue(const Payload &payload)
+{
+    writeQueue_.push(payload);
+
+    if(!writeQueueCongested_ && writeQueue_.getSize() >= protocol_.getWriteQueueHighWatermark())
+    {
+        eMU_LOG(warning) << "Write queue reached high watermark, queued bytes: " << writeQueue_.getSize();
+
+        writeQueueCongested_ = true;
+        getMetrics().writeQueueCongestions_.increment();
+        protocol_.writeQueueCongested(shared_from_this());
+    }
+
+    if(!writeQueue_.isPending())
+    {
+        writeQueue_.setPendingState();
+        this->queueSend();
+    }
+}
+
+void Connection::queueReceive()
+{
+    socket_.async_receive(boost::asio::buffer(readBuffer_.getFreeSpace(), readBuffer_.getFreeSpaceSize()),
+                          strand_.wrap(std::bind(&Connection::receiveHandler,
+                                       shared_from_this(),
+                                       std::placeholders::_1,
+                                       std::placeholders::_2)));
+}
+
+bool Connection::connect(const boost::asio::ip::tcp::endpoint &endpoint)
+{
+    boost::system::error_code errorCode;
+    socket_.connect(endpoint, errorCode);
+
+    if(!errorCode)
+    {
+        if(protocol_.attach(shared_from_this()))
+        {
+            this->queueReceive();
+            return true;
+        }
+        else
+        {
+            eMU_LOG(error) << "Connect, attach to protocol failed! Closing connection.";
+
+            this->close();
+            return false;
+        }
+    }
+    else
+    {
+        eMU_LOG(error) << "Error during connect, address: " << endpoint.address().to_string() << ", port: " <<  endpoint.port()
+            << ", error: " << errorCode.message() << ", code: " << errorCode.value();
+
+        if(this->isOpen())
+        {
+            this->close();
+        }
+
+        return false;
+    }
+}
+
+void Connection::queueSend()
+{
+    socket_.async_send(writeQueue_.getBuffers(),
+                       strand_.wrap(std::bind(&Connection::sendHandler,
+                                    shared_from_this(),
+                                    std::placeholders::_1,
+                                    std::placeholders::_2)));
+}
+
+void Connection::receiveHandler(const boost::system::error_code &errorCode, size_t bytesTransferred)
+{
+    if(boost::asio::error::eof == errorCode)
+    {
+        this->disconnect();
+        return;
+    }
+    else if(errorCode)
+    {
+        this->errorHandler(errorCode, "receive");
+        return;
+    }
+
+    getMetrics().receivedBytes_.increment(bytesTransferred);
+
+    if(!readBuffer_.insert(bytesTransferred))
+    {
+        eMU_LOG(error) << "Invalid stream received. Disconnecting.";
+        this->disconnect();
+        return;
+    }
+
+    if(!readBuffer_.getPayload().empty())
+    {
+        if(!protocol_.dispatch(shared_from_this()))
+        {
+            eMU_LOG(error) << "Dispatch data failed. Disconnecting.";
+            this->disconnect();
+        }
+
+        readBuffer_.compact();
+    }
+
+    if(!closeOngoing_)
+    {
+        this->queueReceive();
+    }
+}
+
+void Connection::sendHandler(const boost::system::error_code& errorCode, size_t bytesTransferred)
+{
+    if(errorCode)
+    {
+        this->errorHandler(errorCode, "send");
+        return;
+    }
+
+    getMetrics().sentBytes_.increment(bytesTransferred);
+
+    writeQueue_.consume(bytesTransferred);
+
+    if(writeQueueCongested_ && writeQueue_.getSize() <= protocol_.getWriteQueueLowWatermark())
+    {
+        writeQueueCongested_ = false;
+        protocol_.writeQueueDrained(shared_from_this());
+    }
+
+    if(!writeQueue_.empty())
+    {
+        this->queueSend();
+    }
+    else
+    {
+        writeQueue_.clearPendingState();
+    }
+}
+
+void Connection::errorHandler(const boost::system::error_code &errorCode, const std::string &operationName)
+{
+    eMU_LOG(error) << "Error during handling async operation: " << operationName
+        << ", error: " << errorCode.message()
+        << ", code: " << errorCode.value();
+
+    getMetrics().errors_.increment();
+
+    if(boost::asio::error::operation_aborted != errorCode)
+    {
+        this->disconnect();
+    }
+}
+
+bool Connection::isOpen() const
+{
+    return socket_.is_open();
+}
+
+bool Connection::isWriteQueueCongested() const
+{
+    return writeQueueCongested_;
+}
+
+asio::ip::tcp::socket& Connection::getSocket()
+{
+    return socket_;
+}
+
+void Connection::accept()
+{
+    if(protocol_.attach(shared_from_this()))
+    {
+        this->queueReceive();
+    }
+    else
+    {
+        eMU_LOG(error) << "Accept, attach to protocol failed! Closing connection.";
+        this->close();
+    }
+}
+
+bool Connection::operator==(const Connection &connection) const
+{
+    return reinterpret_cast<size_t>(this) == reinterpret_cast<size_t>(&connection);
+}
+
+}
+}
+}
+}
@@ -1,57 +1,110 @@
-#include <core/network/tcp/connectionsAcceptor.hpp>
-#include <core/common/logging.hpp>
-
-namespace eMU
-{
-namespace core
-{
-namespace network
-{
-namespace tcp
-{
-
-ConnectionsAcceptor::ConnectionsAcceptor(asio::io_service &ioService, uint16_t port, Protocol &protocol):
-    acceptor_(ioService, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)),
-    strand_(ioService),
-    protocol_(protocol) {}
-
-ConnectionsAcceptor::~ConnectionsAcceptor() {}
-
-void ConnectionsAcceptor::queueAccept()
-{
-    Connection::Pointer connection = Connection::Pointer(new Connection(acceptor_.get_io_service(), protocol_));
-
-    acceptor_.async_accept(connection->getSocket(),
-                           strand_.wrap(std::bind(&ConnectionsAcceptor::acceptHandler,
-                                                  this,
-                                                  connection,
-                                                  std::placeholders::_1)));
-}
-
-void ConnectionsAcceptor::acceptHandler(Connection::Pointer connection, const boost::system::error_code &errorCode)
-{
-    if(!errorCode)
-    {
-        connection->accept();
-    }
-    else if(errorCode != boost::asio::error::operation_aborted)
-    {
-        eMU_LOG(error) << "Error during establishing connection, error: " << errorCode.message();
-    }
-    else
-    {
-        return;
-    }
-
-    this->queueAccept();
-}
-
-asio::ip::tcp::acceptor& ConnectionsAcceptor::getAcceptor()
-{
-    return acceptor_;
-}
-
-}
-}
-}
-}
+#include <core/network/tcp/connectionsAcceptor.hpp>
+#include <core/common/logging.hpp>
+
+namespace eMU
+{
+namespace core
+{
+namespace network
+{
+namespace tcp
+{
+
+typedef boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT> ReusePort;
+
+ConnectionsAcceptor::ConnectionsAcceptor(asio::io_service &ioService, uint16_t port, Protocol &protocol):
+    ConnectionsAcceptor(ioService, port, protocol, false, 1) {}
+
+ConnectionsAcceptor::ConnectionsAcceptor(asio::io_service &ioService, uint16_t port, Protocol &protocol, bool reusePort, size_t numberOfPendingAccepts):
+    acceptor_(ioService),
+    strand_(ioService),
+    protocol_(protocol),
+    numberOfPendingAccepts_(numberOfPendingAccepts),
+    numberOfAcceptedConnections_(0),
+    numberOfAcceptErrors_(0)
+{
+    this->listen(port, reusePort);
+}
+
+ConnectionsAcceptor::~ConnectionsAcceptor() {}
+
+void ConnectionsAcceptor::listen(uint16_t port, bool reusePort)
+{
+    boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::tcp::v4(), port);
+
+    acceptor_.open(endpoint.protocol());
+    acceptor_.set_option(boost::asio::socket_base::reuse_address(true));
+
+    if(reusePort)
+    {
+        acceptor_.set_option(ReusePort(true));
+    }
+
+    acceptor_.bind(endpoint);
+    acceptor_.listen();
+}
+
+void ConnectionsAcceptor::queueAccept()
+{
+    for(size_t i = 0; i < numberOfPendingAccepts_; ++i)
+    {
+        this->queueSingleAccept();
+    }
+}
+
+void ConnectionsAcceptor::queueSingleAccept()
+{
+    asio::io_service &ioService = ioServiceSelector_ ? ioServiceSelector_() : acceptor_.get_io_service();
+    Connection::Pointer connection = Connection::Pointer(new Connection(ioService, protocol_));
+
+    acceptor_.async_accept(connection->getSocket(),
+                           strand_.wrap(std::bind(&ConnectionsAcceptor::acceptHandler,
+                                                  this,
+                                                  connection,
+                                                  std::placeholders::_1)));
+}
+
+void ConnectionsAcceptor::setIoServiceSelector(const IoServiceSelector &ioServiceSelector)
+{
+    ioServiceSelector_ = ioServiceSelector;
+}
+
+void ConnectionsAcceptor::acceptHandler(Connection::Pointer connection, const boost::system::error_code &errorCode)
+{
+    if(!errorCode)
+    {
+        ++numberOfAcceptedConnections_;
+        connection->accept();
+    }
+    else if(errorCode != boost::asio::error::operation_aborted)
+    {
+        ++numberOfAcceptErrors_;
+        eMU_LOG(error) << "Error during establishing connection, error: " << errorCode.message();
+    }
+    else
+    {
+        return;
+    }
+
+    this->queueSingleAccept();
+}
+
+asio::ip::tcp::acceptor& ConnectionsAcceptor::getAcceptor()
+{
+    return acceptor_;
+}
+
+uint64_t ConnectionsAcceptor::getNumberOfAcceptedConnections() const
+{
+    return numberOfAcceptedConnections_;
+}
+
+uint64_t ConnectionsAcceptor::getNumberOfAcceptErrors() const
+{
+    return numberOfAcceptErrors_;
+}
+
+}
+}
+}
+}
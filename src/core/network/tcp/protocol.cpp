@@ -1,40 +1,70 @@
-#include <core/network/tcp/protocol.hpp>
-
-namespace eMU
-{
-namespace core
-{
-namespace network
-{
-namespace tcp
-{
-
-Protocol::~Protocol()
-{
-
-}
-
-bool Protocol::attach(Connection::Pointer)
-{
-    return true;
-}
-
-void Protocol::detach(Connection::Pointer)
-{
-
-}
-
-bool Protocol::dispatch(Connection::Pointer)
-{
-    return true;
-}
-
-void Protocol::shutdown()
-{
-
-}
-
-}
-}
-}
-}
+#include <core/network/tcp/protocol.hpp>
+
+namespace eMU
+{
+namespace core
+{
+namespace network
+{
+namespace tcp
+{
+
+Protocol::Protocol():
+    writeQueueHighWatermark_(64 * 1024),
+    writeQueueLowWatermark_(16 * 1024) {}
+
+Protocol::~Protocol()
+{
+
+}
+
+bool Protocol::attach(Connection::Pointer)
+{
+    return true;
+}
+
+void Protocol::detach(Connection::Pointer)
+{
+
+}
+
+bool Protocol::dispatch(Connection::Pointer)
+{
+    return true;
+}
+
+void Protocol::writeQueueCongested(Connection::Pointer)
+{
+
+}
+
+void Protocol::writeQueueDrained(Connection::Pointer)
+{
+
+}
+
+void Protocol::shutdown()
+{
+
+}
+
+void Protocol::setWriteQueueWatermarks(size_t highWatermark, size_t lowWatermark)
+{
+    writeQueueHighWatermark_ = highWatermark;
+    writeQueueLowWatermark_ = lowWatermark;
+}
+
+size_t Protocol::getWriteQueueHighWatermark() const
+{
+    return writeQueueHighWatermark_;
+}
+
+size_t Protocol::getWriteQueueLowWatermark() const
+{
+    return writeQueueLowWatermark_;
+}
+
+}
+}
+}
+}
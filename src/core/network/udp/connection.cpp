@@ -1,127 +1,308 @@
-#include <core/network/udp/connection.hpp>
-#include <core/network/udp/protocol.hpp>
-
-#include <core/common/logging.hpp>
-
-namespace eMU
-{
-namespace core
-{
-namespace network
-{
-namespace udp
-{
-
-Connection::Connection(asio::io_service &ioService, uint16_t port, Protocol &protocol):
-    socket_(ioService, boost::asio::ip::udp::endpoint(boost::asio::ip::udp::v4(), port)),
-    strand_(ioService),
-    protocol_(protocol) {}
-
-Connection::~Connection() {}
-
-void Connection::registerConnection()
-{
-    protocol_.attach(shared_from_this());
-}
-
-void Connection::unregisterConnection()
-{
-    protocol_.detach(shared_from_this());
-}
-
-Payload& Connection::getReadPayload()
-{
-    return readPayload_;
-}
-
-void Connection::queueReceiveFrom()
-{
-    socket_.async_receive_from(boost::asio::buffer(&readPayload_[0], Payload::getMaxSize()),
-                                senderEndpoint_,
-                                strand_.wrap(std::bind(&Connection::receiveFromHandler,
-                                        this,
-                                        std::placeholders::_1,
-                                        std::placeholders::_2)));
-}
-
-void Connection::sendTo(const boost::asio::ip::udp::endpoint &endpoint, const Payload &payload)
-{
-    WriteBuffer &writeBuffer = writeBufferFactory_.get(endpoint);
-
-    bool result = writeBuffer.insert(payload);
-
-    if(!result)
-    {
-        this->errorHandler(boost::asio::error::no_buffer_space, "sendTo");
-        return;
-    }
-
-    if(!writeBuffer.isPending())
-    {
-        writeBuffer.setPendingState();
-        this->queueSendTo(endpoint, writeBuffer);
-    }
-}
-
-void Connection::receiveFromHandler(const boost::system::error_code &errorCode, size_t bytesTransferred)
-{
-    if(errorCode)
-    {
-        this->errorHandler(errorCode, "receiveFrom");
-    }
-    else
-    {
-        readPayload_.setSize(bytesTransferred); // we should trust ASIO and belive that bytesTransfered never will be greater than maxSize
-        protocol_.dispatch(shared_from_this(), senderEndpoint_);
-    }
-
-    this->queueReceiveFrom();
-}
-
-void Connection::queueSendTo(const boost::asio::ip::udp::endpoint &endpoint, WriteBuffer &writeBuffer)
-{
-    socket_.async_send_to(boost::asio::buffer(&writeBuffer.getPayload()[0], writeBuffer.getPayload().getSize()),
-                          endpoint,
-                          strand_.wrap(std::bind(&Connection::sendToHandler,
-                                       this,
-                                       endpoint,
-                                       std::placeholders::_1,
-                                       std::placeholders::_2)));
-}
-
-void Connection::sendToHandler(const boost::asio::ip::udp::endpoint &endpoint, const boost::system::error_code& errorCode, size_t bytesTransferred)
-{
-    if(errorCode)
-    {
-        this->errorHandler(errorCode, "sendTo");
-    }
-
-    WriteBuffer &writeBuffer = writeBufferFactory_.get(endpoint);
-
-    if(writeBuffer.getSecondPayload().getSize() > 0)
-    {
-        writeBuffer.swap();
-        this->queueSendTo(endpoint, writeBuffer);
-    }
-    else
-    {
-        writeBufferFactory_.erase(endpoint);
-    }
-}
-
-void Connection::errorHandler(const boost::system::error_code &errorCode, const std::string &operationName)
-{
-    eMU_LOG(error) << "Error during handling async operation: " << operationName
-        << ", error: " << errorCode.message()
-        << ", code: " << errorCode.value() << std::endl;
-}
-
-asio::ip::udp::socket& Connection::getSocket()
-{
-    return socket_;
-}
-
-}
-}
-}
-}
+#include <core/network/udp/connection.hpp>
+#include <core/network/udp/protocol.hpp>
+
+#include <core/common/logging.hpp>
+#include <core/metrics/registry.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace eMU
+{
+namespace core
+{
+namespace network
+{
+namespace udp
+{
+
+namespace
+{
+
+struct Metrics
+{
+    Metrics():
+        receivedDatagrams_(metrics::Registry::getInstance().getCounter("emu_udp_received_datagrams_total", "Datagrams received over udp.")),
+        receivedBytes_(metrics::Registry::getInstance().getCounter("emu_udp_received_bytes_total", "Bytes received over udp.")),
+        sentDatagrams_(metrics::Registry::getInstance().getCounter("emu_udp_sent_datagrams_total", "Datagrams sent over udp.")),
+        sentBytes_(metrics::Registry::getInstance().getCounter("emu_udp_sent_bytes_total", "Bytes sent over udp.")),
+        writeBufferOverflows_(metrics::Registry::getInstance().getCounter("emu_udp_write_buffer_overflows_total",
+                                                                          "Payloads dropped because write buffer of endpoint was full.")),
+        errors_(metrics::Registry::getInstance().getCounter("emu_udp_errors_total", "Failed udp operations.")),
+        receiveSystemCalls_(metrics::Registry::getInstance().getCounter("emu_udp_receive_system_calls_total",
+                                                                        "System calls receiving udp datagrams.")),
+        sendSystemCalls_(metrics::Registry::getInstance().getCounter("emu_udp_send_system_calls_total",
+                                                                     "System calls sending udp datagrams.")),
+        datagramsPerReceive_(metrics::Registry::getInstance().getHistogram("emu_udp_datagrams_per_system_call",
+                                                                           "Datagrams moved by single system call.", "direction=\"receive\"")),
+        datagramsPerSend_(metrics::Registry::getInstance().getHistogram("emu_udp_datagrams_per_system_call",
+                                                                        "Datagrams moved by single system call.", "direction=\"send\"")) {}
+
+    metrics::Counter &receivedDatagrams_;
+    metrics::Counter &receivedBytes_;
+    metrics::Counter &sentDatagrams_;
+    metrics::Counter &sentBytes_;
+    metrics::Counter &writeBufferOverflows_;
+    metrics::Counter &errors_;
+    metrics::Counter &receiveSystemCalls_;
+    metrics::Counter &sendSystemCalls_;
+    metrics::Histogram &datagramsPerReceive_;
+    metrics::Histogram &datagramsPerSend_;
+};
+
+Metrics& getMetrics()
+{
+    static Metrics metrics;
+    return metrics;
+}
+
+// bounds time spent draining socket before other handlers of the strand get their turn
+const size_t kMaxNumberOfReceiveBatches = 8;
+
+}
+
+Connection::Connection(asio::io_service &ioService, uint16_t port, Protocol &protocol):
+    socket_(ioService, boost::asio::ip::udp::endpoint(boost::asio::ip::udp::v4(), port)),
+    strand_(ioService),
+    protocol_(protocol),
+    flushScheduled_(false)
+{
+    readPayload_.reserve(Payload::getMaxSize());
+}
+
+Connection::~Connection() {}
+
+void Connection::registerConnection()
+{
+    protocol_.attach(shared_from_this());
+}
+
+void Connection::unregisterConnection()
+{
+    protocol_.detach(shared_from_this());
+}
+
+Payload& Connection::getReadPayload()
+{
+    return readPayload_;
+}
+
+void Connection::queueReceiveFrom()
+{
+    socket_.async_receive_from(boost::asio::buffer(&readPayload_[0], Payload::getMaxSize()),
+                                senderEndpoint_,
+                                strand_.wrap(std::bind(&Connection::receiveFromHandler,
+                                        this,
+                                        std::placeholders::_1,
+                                        std::placeholders::_2)));
+}
+
+void Connection::sendTo(const boost::asio::ip::udp::endpoint &endpoint, const Payload &payload)
+{
+    if(!strand_.running_in_this_thread())
+    {
+        // e.g. load reports sent from timer handlers
+        strand_.post(std::bind(&Connection::enqueue, shared_from_this(), endpoint, payload));
+        return;
+    }
+
+    this->enqueue(endpoint, payload);
+}
+
+void Connection::enqueue(const boost::asio::ip::udp::endpoint &endpoint, const Payload &payload)
+{
+    WriteBuffer &writeBuffer = writeBufferFactory_.get(endpoint);
+
+    bool result = writeBuffer.insert(payload);
+
+    if(!result)
+    {
+        getMetrics().writeBufferOverflows_.increment();
+        this->errorHandler(boost::asio::error::no_buffer_space, "sendTo");
+        return;
+    }
+
+    if(!writeBuffer.isPending())
+    {
+        writeBuffer.setPendingState();
+        this->scheduleFlush(endpoint);
+    }
+}
+
+void Connection::scheduleFlush(const boost::asio::ip::udp::endpoint &endpoint)
+{
+    flushedEndpoints_.push_back(endpoint);
+
+    if(!flushScheduled_)
+    {
+        flushScheduled_ = true;
+        strand_.post(std::bind(&Connection::flush, shared_from_this()));
+    }
+}
+
+void Connection::flush()
+{
+    int socket = socket_.native_handle();
+    size_t first = 0;
+
+    // endpoints with second payload waiting are appended by sendCompleted() and flushed in following batches
+    while(first < flushedEndpoints_.size())
+    {
+        size_t last = std::min(first + DatagramBatch::kMaxNumberOfDatagrams, flushedEndpoints_.size());
+
+        for(size_t i = first; i < last; ++i)
+        {
+            sendBatch_.add(flushedEndpoints_[i], writeBufferFactory_.get(flushedEndpoints_[i]).getPayload());
+        }
+
+        size_t sentDatagrams = sendBatch_.send(socket);
+
+        if(socket >= 0)
+        {
+            getMetrics().sendSystemCalls_.increment();
+            getMetrics().datagramsPerSend_.record(sentDatagrams);
+        }
+
+        for(size_t i = first; i < last; ++i)
+        {
+            boost::asio::ip::udp::endpoint endpoint = flushedEndpoints_[i];
+            WriteBuffer &writeBuffer = writeBufferFactory_.get(endpoint);
+
+            if(i - first < sentDatagrams)
+            {
+                getMetrics().sentDatagrams_.increment();
+                getMetrics().sentBytes_.increment(writeBuffer.getPayload().getSize());
+
+                this->sendCompleted(endpoint);
+            }
+            else
+            {
+                this->queueSendTo(endpoint, writeBuffer);
+            }
+        }
+
+        first = last;
+    }
+
+    flushedEndpoints_.clear();
+    flushScheduled_ = false;
+}
+
+void Connection::sendCompleted(const boost::asio::ip::udp::endpoint &endpoint)
+{
+    WriteBuffer &writeBuffer = writeBufferFactory_.get(endpoint);
+
+    if(writeBuffer.getSecondPayload().getSize() > 0)
+    {
+        writeBuffer.swap();
+        this->scheduleFlush(endpoint);
+    }
+    else
+    {
+        writeBufferFactory_.erase(endpoint);
+    }
+}
+
+void Connection::receiveFromHandler(const boost::system::error_code &errorCode, size_t bytesTransferred)
+{
+    if(errorCode)
+    {
+        this->errorHandler(errorCode, "receiveFrom");
+    }
+    else
+    {
+        getMetrics().receivedDatagrams_.increment();
+        getMetrics().receivedBytes_.increment(bytesTransferred);
+        getMetrics().receiveSystemCalls_.increment();
+        getMetrics().datagramsPerReceive_.record(1);
+
+        readPayload_.setSize(bytesTransferred); // we should trust ASIO and belive that bytesTransfered never will be greater than maxSize
+        protocol_.dispatch(shared_from_this(), senderEndpoint_);
+
+        this->receiveBatch();
+    }
+
+    this->queueReceiveFrom();
+}
+
+void Connection::receiveBatch()
+{
+    int socket = socket_.native_handle();
+
+    if(socket < 0)
+    {
+        return;
+    }
+
+    for(size_t batch = 0; batch < kMaxNumberOfReceiveBatches; ++batch)
+    {
+        size_t receivedDatagrams = receiveBatch_.receive(socket);
+
+        getMetrics().receiveSystemCalls_.increment();
+        getMetrics().datagramsPerReceive_.record(receivedDatagrams);
+
+        for(size_t i = 0; i < receivedDatagrams; ++i)
+        {
+            // read payload trades its chunk with batch one, protocol always reads datagram from getReadPayload()
+            std::swap(readPayload_, receiveBatch_.getPayload(i));
+            senderEndpoint_ = receiveBatch_.getEndpoint(i);
+
+            getMetrics().receivedDatagrams_.increment();
+            getMetrics().receivedBytes_.increment(readPayload_.getSize());
+
+            protocol_.dispatch(shared_from_this(), senderEndpoint_);
+        }
+
+        if(receivedDatagrams < DatagramBatch::kMaxNumberOfDatagrams)
+        {
+            break;
+        }
+    }
+}
+
+void Connection::queueSendTo(const boost::asio::ip::udp::endpoint &endpoint, WriteBuffer &writeBuffer)
+{
+    socket_.async_send_to(boost::asio::buffer(&writeBuffer.getPayload()[0], writeBuffer.getPayload().getSize()),
+                          endpoint,
+                          strand_.wrap(std::bind(&Connection::sendToHandler,
+                                       this,
+                                       endpoint,
+                                       std::placeholders::_1,
+                                       std::placeholders::_2)));
+}
+
+void Connection::sendToHandler(const boost::asio::ip::udp::endpoint &endpoint, const boost::system::error_code& errorCode, size_t bytesTransferred)
+{
+    if(errorCode)
+    {
+        this->errorHandler(errorCode, "sendTo");
+    }
+    else
+    {
+        getMetrics().sentDatagrams_.increment();
+        getMetrics().sentBytes_.increment(bytesTransferred);
+        getMetrics().sendSystemCalls_.increment();
+        getMetrics().datagramsPerSend_.record(1);
+    }
+
+    this->sendCompleted(endpoint);
+}
+
+void Connection::errorHandler(const boost::system::error_code &errorCode, const std::string &operationName)
+{
+    eMU_LOG(error) << "Error during handling async operation: " << operationName
+        << ", error: " << errorCode.message()
+        << ", code: " << errorCode.value();
+
+    getMetrics().errors_.increment();
+}
+
+asio::ip::udp::socket& Connection::getSocket()
+{
+    return socket_;
+}
+
+}
+}
+}
+}
@@ -0,0 +1,134 @@
+#include <core/network/udp/datagramBatch.hpp>
+#include <core/common/logging.hpp>
+
+#include <errno.h>
+#include <string.h>
+
+namespace eMU
+{
+namespace core
+{
+namespace network
+{
+namespace udp
+{
+
+const size_t DatagramBatch::kMaxNumberOfDatagrams;
+
+DatagramBatch::DatagramBatch():
+    payloads_(kMaxNumberOfDatagrams),
+    endpoints_(kMaxNumberOfDatagrams),
+    size_(0)
+{
+    for(auto &payload : payloads_)
+    {
+        payload.reserve(Payload::getMaxSize());
+    }
+}
+
+size_t DatagramBatch::receive(int socket)
+{
+    size_ = 0;
+
+    if(socket < 0)
+    {
+        return 0;
+    }
+
+    for(size_t i = 0; i < kMaxNumberOfDatagrams; ++i)
+    {
+        this->prepareHeader(i, &payloads_[i][0], Payload::getMaxSize());
+    }
+
+    int result = recvmmsg(socket, headers_, kMaxNumberOfDatagrams, MSG_DONTWAIT, nullptr);
+
+    if(result < 0)
+    {
+        if(errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+        {
+            eMU_LOG(error) << "recvmmsg failed, error: " << strerror(errno) << ", code: " << errno;
+        }
+
+        return 0;
+    }
+
+    size_ = static_cast<size_t>(result);
+
+    for(size_t i = 0; i < size_; ++i)
+    {
+        payloads_[i].setSize(headers_[i].msg_len);
+
+        memcpy(endpoints_[i].data(), &addresses_[i], headers_[i].msg_hdr.msg_namelen);
+        endpoints_[i].resize(headers_[i].msg_hdr.msg_namelen);
+    }
+
+    return size_;
+}
+
+Payload& DatagramBatch::getPayload(size_t index)
+{
+    return payloads_[index];
+}
+
+const boost::asio::ip::udp::endpoint& DatagramBatch::getEndpoint(size_t index) const
+{
+    return endpoints_[index];
+}
+
+bool DatagramBatch::add(const boost::asio::ip::udp::endpoint &endpoint, const Payload &payload)
+{
+    if(size_ == kMaxNumberOfDatagrams)
+    {
+        return false;
+    }
+
+    this->prepareHeader(size_, const_cast<uint8_t*>(&payload[0]), payload.getSize());
+    memcpy(&addresses_[size_], endpoint.data(), endpoint.size());
+    headers_[size_].msg_hdr.msg_namelen = endpoint.size();
+    ++size_;
+
+    return true;
+}
+
+size_t DatagramBatch::send(int socket)
+{
+    size_t size = size_;
+    size_ = 0;
+
+    if(socket < 0 || size == 0)
+    {
+        return 0;
+    }
+
+    int result = sendmmsg(socket, headers_, size, MSG_DONTWAIT);
+
+    // errors other than full socket buffer are reported by asio when the datagram is sent again
+    return result > 0 ? static_cast<size_t>(result) : 0;
+}
+
+size_t DatagramBatch::size() const
+{
+    return size_;
+}
+
+bool DatagramBatch::empty() const
+{
+    return size_ == 0;
+}
+
+void DatagramBatch::prepareHeader(size_t index, void *data, size_t size)
+{
+    vectors_[index].iov_base = data;
+    vectors_[index].iov_len = size;
+
+    memset(&headers_[index], 0, sizeof(mmsghdr));
+    headers_[index].msg_hdr.msg_name = &addresses_[index];
+    headers_[index].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+    headers_[index].msg_hdr.msg_iov = &vectors_[index];
+    headers_[index].msg_hdr.msg_iovlen = 1;
+}
+
+}
+}
+}
+}
@@ -1,33 +1,176 @@
-#include <core/network/udp/writeBufferFactory.hpp>
-
-namespace eMU
-{
-namespace core
-{
-namespace network
-{
-namespace udp
-{
-
-WriteBuffer& WriteBufferFactory::get(const boost::asio::ip::udp::endpoint &endpoint)
-{
-    if(buffers_.count(endpoint) > 0)
-    {
-        return buffers_[endpoint];
-    }
-    else
-    {
-        buffers_[endpoint] = WriteBuffer();
-        return buffers_[endpoint];
-    }
-}
-
-bool WriteBufferFactory::erase(const boost::asio::ip::udp::endpoint &endpoint)
-{
-    return buffers_.erase(endpoint) > 0 ? true: false;
-}
-
-}
-}
-}
-}
+#include <core/network/udp/writeBufferFactory.hpp>
+
+namespace eMU
+{
+namespace core
+{
+namespace network
+{
+namespace udp
+{
+
+namespace
+{
+const size_t kInitialNumberOfSlots = 16;
+}
+
+const uint32_t WriteBufferFactory::kEmptySlot;
+
+WriteBufferFactory::WriteBufferFactory():
+    slots_(kInitialNumberOfSlots),
+    size_(0) {}
+
+WriteBuffer& WriteBufferFactory::get(const boost::asio::ip::udp::endpoint &endpoint)
+{
+    size_t hash = getHash(endpoint);
+    size_t index = this->find(endpoint, hash);
+
+    if(slots_[index].bufferIndex_ != kEmptySlot)
+    {
+        return *buffers_[slots_[index].bufferIndex_];
+    }
+
+    // load factor kept at or below one half, so probe sequences stay short
+    if((size_ + 1) * 2 > slots_.size())
+    {
+        this->grow();
+        index = this->find(endpoint, hash);
+    }
+
+    slots_[index].hash_ = hash;
+    slots_[index].bufferIndex_ = this->acquireBuffer(endpoint);
+    ++size_;
+
+    return *buffers_[slots_[index].bufferIndex_];
+}
+
+bool WriteBufferFactory::erase(const boost::asio::ip::udp::endpoint &endpoint)
+{
+    size_t index = this->find(endpoint, getHash(endpoint));
+
+    if(slots_[index].bufferIndex_ == kEmptySlot)
+    {
+        return false;
+    }
+
+    buffers_[slots_[index].bufferIndex_]->clear();
+    freeBuffers_.push_back(slots_[index].bufferIndex_);
+    slots_[index] = Slot();
+    --size_;
+
+    // backward shift deletion, following entries of the probe sequence are moved into the hole
+    size_t mask = slots_.size() - 1;
+    size_t hole = index;
+
+    for(size_t next = (index + 1) & mask; slots_[next].bufferIndex_ != kEmptySlot; next = (next + 1) & mask)
+    {
+        size_t home = slots_[next].hash_ & mask;
+
+        if(((next - home) & mask) >= ((next - hole) & mask))
+        {
+            slots_[hole] = slots_[next];
+            slots_[next] = Slot();
+            hole = next;
+        }
+    }
+
+    return true;
+}
+
+size_t WriteBufferFactory::size() const
+{
+    return size_;
+}
+
+size_t WriteBufferFactory::getNumberOfPooledBuffers() const
+{
+    return buffers_.size();
+}
+
+size_t WriteBufferFactory::getHash(const boost::asio::ip::udp::endpoint &endpoint)
+{
+    uint64_t hash = endpoint.port();
+
+    if(endpoint.address().is_v4())
+    {
+        hash |= static_cast<uint64_t>(endpoint.address().to_v4().to_ulong()) << 16;
+    }
+    else
+    {
+        for(uint8_t byte : endpoint.address().to_v6().to_bytes())
+        {
+            hash = hash * 131 + byte;
+        }
+    }
+
+    // multiplicative mixing, high bits of the product are folded into the low bits used as slot index
+    hash *= 0x9E3779B97F4A7C15ull;
+
+    return static_cast<size_t>(hash ^ (hash >> 32));
+}
+
+size_t WriteBufferFactory::find(const boost::asio::ip::udp::endpoint &endpoint, size_t hash) const
+{
+    size_t mask = slots_.size() - 1;
+    size_t index = hash & mask;
+
+    while(slots_[index].bufferIndex_ != kEmptySlot
+          && (slots_[index].hash_ != hash || endpoints_[slots_[index].bufferIndex_] != endpoint))
+    {
+        index = (index + 1) & mask;
+    }
+
+    return index;
+}
+
+uint32_t WriteBufferFactory::acquireBuffer(const boost::asio::ip::udp::endpoint &endpoint)
+{
+    uint32_t bufferIndex = 0;
+
+    if(!freeBuffers_.empty())
+    {
+        bufferIndex = freeBuffers_.back();
+        freeBuffers_.pop_back();
+        endpoints_[bufferIndex] = endpoint;
+    }
+    else
+    {
+        bufferIndex = static_cast<uint32_t>(buffers_.size());
+        buffers_.push_back(std::unique_ptr<WriteBuffer>(new WriteBuffer()));
+        endpoints_.push_back(endpoint);
+    }
+
+    return bufferIndex;
+}
+
+void WriteBufferFactory::insertSlot(const Slot &slot)
+{
+    size_t mask = slots_.size() - 1;
+    size_t index = slot.hash_ & mask;
+
+    while(slots_[index].bufferIndex_ != kEmptySlot)
+    {
+        index = (index + 1) & mask;
+    }
+
+    slots_[index] = slot;
+}
+
+void WriteBufferFactory::grow()
+{
+    std::vector<Slot> slots(slots_.size() * 2);
+    slots.swap(slots_);
+
+    for(const auto &slot : slots)
+    {
+        if(slot.bufferIndex_ != kEmptySlot)
+        {
+            this->insertSlot(slot);
+        }
+    }
+}
+
+}
+}
+}
+}
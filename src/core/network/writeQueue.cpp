@@ -0,0 +1,148 @@
+#include <core/network/writeQueue.hpp>
+
+#include <algorithm>
+#include <string.h>
+
+namespace eMU
+{
+namespace core
+{
+namespace network
+{
+
+WriteQueue::WriteQueue():
+    frontOffset_(0),
+    size_(0),
+    pending_(false)
+{
+    this->appendSegment();
+    buffers_.reserve(getMaxNumberOfBuffersPerSend());
+}
+
+size_t WriteQueue::getMaxNumberOfBuffersPerSend()
+{
+    return 64;
+}
+
+void WriteQueue::push(const Payload &payload)
+{
+    size_t offset = 0;
+
+    while(offset < payload.getSize())
+    {
+        Payload *segment = &segments_.back();
+
+        if(segment->getSize() == Payload::getMaxSize())
+        {
+            segment = &this->appendSegment();
+        }
+
+        segment->reserve(Payload::getMaxSize()); // segment must not relocate while part of it is being sent
+
+        size_t chunkSize = std::min(Payload::getMaxSize() - segment->getSize(), payload.getSize() - offset);
+        size_t segmentOffset = segment->getSize();
+
+        segment->setSize(segmentOffset + chunkSize);
+        memcpy(&(*segment)[segmentOffset], &payload[offset], chunkSize);
+
+        offset += chunkSize;
+    }
+
+    size_ += payload.getSize();
+}
+
+const WriteQueue::BufferSequence& WriteQueue::getBuffers()
+{
+    buffers_.clear();
+
+    size_t offset = frontOffset_;
+
+    for(const auto &segment : segments_)
+    {
+        if(buffers_.size() == getMaxNumberOfBuffersPerSend() || segment.getSize() == offset)
+        {
+            break;
+        }
+
+        buffers_.push_back(boost::asio::const_buffer(&segment[offset], segment.getSize() - offset));
+        offset = 0;
+    }
+
+    return buffers_;
+}
+
+void WriteQueue::consume(size_t bytesTransferred)
+{
+    bytesTransferred = std::min(bytesTransferred, size_);
+    size_ -= bytesTransferred;
+
+    while(bytesTransferred > 0)
+    {
+        Payload &front = segments_.front();
+        size_t frontSize = front.getSize() - frontOffset_;
+
+        if(bytesTransferred < frontSize)
+        {
+            frontOffset_ += bytesTransferred;
+            break;
+        }
+
+        bytesTransferred -= frontSize;
+        frontOffset_ = 0;
+
+        if(segments_.size() > 1)
+        {
+            segments_.pop_front();
+        }
+        else
+        {
+            front.clear();
+        }
+    }
+}
+
+void WriteQueue::clear()
+{
+    segments_.resize(1);
+    segments_.front().clear();
+
+    frontOffset_ = 0;
+    size_ = 0;
+    pending_ = false;
+}
+
+size_t WriteQueue::getSize() const
+{
+    return size_;
+}
+
+bool WriteQueue::empty() const
+{
+    return size_ == 0;
+}
+
+bool WriteQueue::isPending() const
+{
+    return pending_;
+}
+
+void WriteQueue::setPendingState()
+{
+    pending_ = true;
+}
+
+void WriteQueue::clearPendingState()
+{
+    pending_ = false;
+}
+
+Payload& WriteQueue::appendSegment()
+{
+    segments_.push_back(Payload());
+
+    return segments_.back();
+}
+
+}
+}
+}
@@ -0,0 +1,182 @@
+#include <dataserver/charactersCache.hpp>
+
+#include <boost/algorithm/string/case_conv.hpp>
+
+namespace eMU
+{
+namespace dataserver
+{
+
+CharactersCache::CharactersCache():
+    maxMemorySize_(0),
+    memorySize_(0),
+    timeToLive_(0),
+    generation_(0),
+    numberOfHits_(0),
+    numberOfMisses_(0),
+    numberOfEvictions_(0),
+    numberOfInvalidations_(0) {}
+
+void CharactersCache::configure(size_t maxMemorySize, std::chrono::milliseconds timeToLive)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    maxMemorySize_ = maxMemorySize;
+    timeToLive_ = timeToLive;
+
+    this->evict();
+}
+
+bool CharactersCache::isEnabled() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return maxMemorySize_ > 0 && timeToLive_.count() > 0;
+}
+
+bool CharactersCache::find(const std::string &accountId, streaming::common::CharacterInfoContainer &characters)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if(maxMemorySize_ == 0 || timeToLive_.count() == 0)
+    {
+        return false;
+    }
+
+    EntriesIndex::iterator it = index_.find(makeKey(accountId));
+
+    if(it == index_.end())
+    {
+        ++numberOfMisses_;
+        return false;
+    }
+
+    if(it->second->expirationTime_ <= Clock::now())
+    {
+        this->erase(it);
+        ++numberOfEvictions_;
+        ++numberOfMisses_;
+        return false;
+    }
+
+    entries_.splice(entries_.begin(), entries_, it->second);
+    characters = it->second->characters_;
+    ++numberOfHits_;
+
+    return true;
+}
+
+uint64_t CharactersCache::getGeneration() const
+{
+    return generation_;
+}
+
+void CharactersCache::insert(const std::string &accountId, const streaming::common::CharacterInfoContainer &characters, uint64_t generation)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if(maxMemorySize_ == 0 || timeToLive_.count() == 0 || generation != generation_)
+    {
+        return;
+    }
+
+    std::string key = makeKey(accountId);
+    EntriesIndex::iterator it = index_.find(key);
+
+    if(it != index_.end())
+    {
+        this->erase(it);
+    }
+
+    entries_.push_front(Entry{key, characters, Clock::now() + timeToLive_, 0});
+    entries_.front().memorySize_ = calculateMemorySize(entries_.front());
+    memorySize_ += entries_.front().memorySize_;
+    index_.insert(std::make_pair(key, entries_.begin()));
+
+    this->evict();
+}
+
+void CharactersCache::invalidate(const std::string &accountId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    ++generation_;
+
+    EntriesIndex::iterator it = index_.find(makeKey(accountId));
+
+    if(it != index_.end())
+    {
+        this->erase(it);
+        ++numberOfInvalidations_;
+    }
+}
+
+size_t CharactersCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return index_.size();
+}
+
+size_t CharactersCache::getMemorySize() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return memorySize_;
+}
+
+uint64_t CharactersCache::getNumberOfHits() const
+{
+    return numberOfHits_;
+}
+
+uint64_t CharactersCache::getNumberOfMisses() const
+{
+    return numberOfMisses_;
+}
+
+uint64_t CharactersCache::getNumberOfEvictions() const
+{
+    return numberOfEvictions_;
+}
+
+uint64_t CharactersCache::getNumberOfInvalidations() const
+{
+    return numberOfInvalidations_;
+}
+
+std::string CharactersCache::makeKey(const std::string &accountId)
+{
+    // accountId comparison in database is case insensitive
+    return boost::algorithm::to_lower_copy(accountId);
+}
+
+size_t CharactersCache::calculateMemorySize(const Entry &entry)
+{
+    // list node, index node and two copies of the key, allocator overhead is not counted
+    size_t memorySize = sizeof(Entry) + sizeof(EntriesIndex::value_type) + 2 * entry.accountId_.capacity();
+    memorySize += entry.characters_.capacity() * sizeof(streaming::common::CharacterListInfo);
+
+    for(const auto &character : entry.characters_)
+    {
+        memorySize += character.name_.capacity();
+    }
+
+    return memorySize;
+}
+
+void CharactersCache::erase(EntriesIndex::iterator it)
+{
+    memorySize_ -= it->second->memorySize_;
+    entries_.erase(it->second);
+    index_.erase(it);
+}
+
+void CharactersCache::evict()
+{
+    while(!entries_.empty() && memorySize_ > maxMemorySize_)
+    {
+        this->erase(index_.find(entries_.back().accountId_));
+        ++numberOfEvictions_;
+    }
+}
+
+}
+}
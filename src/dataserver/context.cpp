@@ -1,18 +1,35 @@
-#include <dataserver/context.hpp>
-
-namespace eMU
-{
-namespace dataserver
-{
-
-Context::Context(database::SqlInterface &sqlInterface, size_t maxNumberOfUsers):
-    protocols::contexts::Server<User>(maxNumberOfUsers),
-    sqlInterface_(sqlInterface) {}
-
-database::SqlInterface& Context::getSqlInterface()
-{
-    return sqlInterface_;
-}
-
-}
-}
+#include <dataserver/context.hpp>
+
+namespace eMU
+{
+namespace dataserver
+{
+
+Context::Context(database::SqlInterface &sqlInterface, size_t maxNumberOfUsers):
+    Context(database::WorkersPool::SqlInterfacesContainer(1, &sqlInterface), maxNumberOfUsers) {}
+
+Context::Context(const database::WorkersPool::SqlInterfacesContainer &sqlInterfaces, size_t maxNumberOfUsers):
+    protocols::contexts::Server<User>(maxNumberOfUsers),
+    databaseWorkers_(sqlInterfaces),
+    charactersListBatcher_(databaseWorkers_, [this](database::SqlInterface &sqlInterface, const transactions::CharactersListBatchRequest::Batcher::Batch &batch)
+    {
+        transactions::CharactersListBatchRequest(sqlInterface, batch, charactersCache_).handle();
+    }) {}
+
+database::WorkersPool& Context::getDatabaseWorkers()
+{
+    return databaseWorkers_;
+}
+
+CharactersCache& Context::getCharactersCache()
+{
+    return charactersCache_;
+}
+
+transactions::CharactersListBatchRequest::Batcher& Context::getCharactersListBatcher()
+{
+    return charactersListBatcher_;
+}
+
+}
+}
@@ -1,7 +1,14 @@
 #include <dataserver/database/mySqlInterface.hpp>
 
 #include <core/common/logging.hpp>
+#include <core/metrics/registry.hpp>
 #include <boost/algorithm/string/replace.hpp>
+#include <mysql/errmsg.h>
+#include <type_traits>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string.h>
 
 namespace eMU
 {
@@ -10,8 +17,118 @@ namespace dataserver
 namespace database
 {
 
+namespace
+{
+
+// my_bool in older client libraries, bool since MySQL 8
+typedef std::remove_pointer<decltype(MYSQL_BIND::is_null)>::type MySqlBool;
+
+class ParameterBinder: public boost::static_visitor<void>
+{
+public:
+    ParameterBinder(MYSQL_BIND &bind, unsigned long &length):
+        bind_(bind),
+        length_(length) {}
+
+    void operator()(const uint32_t &value) const
+    {
+        bind_.buffer_type = MYSQL_TYPE_LONG;
+        bind_.buffer = const_cast<uint32_t*>(&value);
+        bind_.is_unsigned = true;
+    }
+
+    void operator()(const std::string &value) const
+    {
+        length_ = value.size();
+
+        bind_.buffer_type = MYSQL_TYPE_STRING;
+        bind_.buffer = const_cast<char*>(value.data());
+        bind_.buffer_length = length_;
+        bind_.length = &length_;
+    }
+
+private:
+    MYSQL_BIND &bind_;
+    unsigned long &length_;
+};
+
+bool isIntegerType(enum_field_types type)
+{
+    return type == MYSQL_TYPE_TINY || type == MYSQL_TYPE_SHORT || type == MYSQL_TYPE_LONG
+        || type == MYSQL_TYPE_INT24 || type == MYSQL_TYPE_LONGLONG;
+}
+
+const size_t kMaxIntegerLength = 20;
+
+size_t formatInteger(int64_t value, char *text)
+{
+    char reversed[kMaxIntegerLength];
+    size_t size = 0;
+    uint64_t absolute = value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+
+    do
+    {
+        reversed[size++] = static_cast<char>('0' + absolute % 10);
+        absolute /= 10;
+    }
+    while(absolute > 0);
+
+    size_t length = 0;
+
+    if(value < 0)
+    {
+        text[length++] = '-';
+    }
+
+    while(size > 0)
+    {
+        text[length++] = reversed[--size];
+    }
+
+    return length;
+}
+
+struct Metrics
+{
+    Metrics():
+        queryLatency_(core::metrics::Registry::getInstance().getHistogram("emu_db_query_latency_nanoseconds",
+                                                                          "Time spent executing database requests.", "kind=\"query\"")),
+        statementLatency_(core::metrics::Registry::getInstance().getHistogram("emu_db_query_latency_nanoseconds",
+                                                                              "Time spent executing database requests.", "kind=\"statement\"")),
+        failures_(core::metrics::Registry::getInstance().getCounter("emu_db_query_failures_total", "Failed database requests.")) {}
+
+    core::metrics::Histogram &queryLatency_;
+    core::metrics::Histogram &statementLatency_;
+    core::metrics::Counter &failures_;
+};
+
+Metrics& getMetrics()
+{
+    static Metrics metrics;
+    return metrics;
+}
+
+uint64_t getNanosecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool isConnectionError(unsigned int errorCode)
+{
+    return errorCode == CR_SERVER_GONE_ERROR || errorCode == CR_SERVER_LOST
+        || errorCode == CR_CONNECTION_ERROR || errorCode == CR_CONN_HOST_ERROR;
+}
+
+}
+
 MySqlInterface::MySqlInterface():
-    queryResult_(nullptr) {}
+    queryResult_(nullptr),
+    executedStatement_(nullptr),
+    port_(0),
+    connected_(false)
+{
+    std::fill(statements_, statements_ + Statement::NUMBER_OF_STATEMENTS, nullptr);
+}
 
 bool MySqlInterface::initialize()
 {
@@ -28,22 +145,51 @@ bool MySqlInterface::initialize()
 bool MySqlInterface::connect(const std::string &hostname, uint16_t port,
                              const std::string &userName, const std::string &password, const std::string &databaseName)
 {
-    if(mysql_real_connect(&handle_, hostname.c_str(), userName.c_str(), password.c_str(),
-                          databaseName.c_str(), port, 0, CLIENT_MULTI_RESULTS | CLIENT_MULTI_STATEMENTS) != nullptr)
-    {
-        bool reconnect = true;
-        mysql_options(&handle_, MYSQL_OPT_RECONNECT, &reconnect);
+    hostname_ = hostname;
+    port_ = port;
+    userName_ = userName;
+    password_ = password;
+    databaseName_ = databaseName;
 
-        return true;
+    return this->establishConnection();
+}
+
+bool MySqlInterface::reconnect()
+{
+    for(size_t i = 0; i < Statement::NUMBER_OF_STATEMENTS; ++i)
+    {
+        this->closeStatement(static_cast<Statement::Id>(i));
     }
-    else
+
+    executedStatement_ = nullptr;
+    mysql_close(&handle_);
+
+    if(!this->initialize() || !this->establishConnection())
     {
+        errorMessage_ = mysql_error(&handle_);
+        eMU_LOG(error) << "Reconnect to database failed, reason: " << errorMessage_;
         return false;
     }
+
+    eMU_LOG(info) << "Reconnected to database " << hostname_ << ":" << port_;
+    return true;
+}
+
+bool MySqlInterface::establishConnection()
+{
+    connected_ = mysql_real_connect(&handle_, hostname_.c_str(), userName_.c_str(), password_.c_str(),
+                                    databaseName_.c_str(), port_, 0, CLIENT_MULTI_RESULTS | CLIENT_MULTI_STATEMENTS) != nullptr;
+
+    return connected_;
 }
 
 void MySqlInterface::cleanup()
 {
+    for(size_t i = 0; i < Statement::NUMBER_OF_STATEMENTS; ++i)
+    {
+        this->closeStatement(static_cast<Statement::Id>(i));
+    }
+
     mysql_close(&handle_);
 }
 
@@ -52,36 +198,111 @@ bool MySqlInterface::executeQuery(std::string query)
     //boost::algorithm::replace_all(query, "'", "\\'");
     //boost::algorithm::replace_all(query, "\\", "\\\\");
 
-    if(mysql_real_query(&handle_, query.c_str(), query.size()) == 0)
+    executedStatement_ = nullptr;
+    errorMessage_.clear();
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    int result = mysql_real_query(&handle_, query.c_str(), query.size());
+    getMetrics().queryLatency_.record(getNanosecondsSince(start));
+
+    if(result == 0)
     {
-        eMU_LOG(info) << "Executed query: " << query;
+        eMU_LOG(debug) << "Executed query: " << query;
         return true;
     }
     else
     {
-        eMU_LOG(error) << "Query execution failed, reason: " << this->getErrorMessage() << ", query: " << query;
+        errorMessage_ = mysql_error(&handle_);
+        eMU_LOG(error) << "Query execution failed, reason: " << errorMessage_ << ", query: " << query;
+
+        getMetrics().failures_.increment();
+
+        this->handleFailure(mysql_errno(&handle_));
+        return false;
+    }
+}
+
+bool MySqlInterface::executeStatement(Statement::Id statementId, const Statement::Parameters &parameters)
+{
+    executedStatement_ = nullptr;
+    errorMessage_.clear();
+
+    if(parameters.size() != Statement::getNumberOfParameters(statementId))
+    {
+        errorMessage_ = "Invalid number of statement parameters";
+        eMU_LOG(error) << errorMessage_ << ", statement: " << Statement::getText(statementId) << ", parameters: " << parameters.size();
         return false;
     }
+
+    MYSQL_STMT *statement = this->getStatement(statementId);
+
+    if(statement == nullptr)
+    {
+        return false;
+    }
+
+    std::vector<MYSQL_BIND> binds(parameters.size());
+    std::vector<unsigned long> lengths(parameters.size());
+    memset(binds.data(), 0, binds.size() * sizeof(MYSQL_BIND));
+
+    for(size_t i = 0; i < parameters.size(); ++i)
+    {
+        boost::apply_visitor(ParameterBinder(binds[i], lengths[i]), parameters[i]);
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    bool executed = mysql_stmt_bind_param(statement, binds.data()) == 0 && mysql_stmt_execute(statement) == 0;
+    getMetrics().statementLatency_.record(getNanosecondsSince(start));
+
+    if(!executed)
+    {
+        errorMessage_ = mysql_stmt_error(statement);
+        unsigned int errorCode = mysql_stmt_errno(statement);
+        eMU_LOG(error) << "Statement execution failed, reason: " << errorMessage_ << ", statement: " << Statement::getText(statementId);
+
+        getMetrics().failures_.increment();
+
+        // handle may be unusable after connection loss, statement is prepared again on next use
+        this->closeStatement(statementId);
+        this->handleFailure(errorCode);
+        return false;
+    }
+
+    executedStatement_ = statement;
+    return true;
 }
 
 std::string MySqlInterface::getErrorMessage()
 {
+    if(!errorMessage_.empty())
+    {
+        return errorMessage_;
+    }
+
     return std::move(std::string(mysql_error(&handle_)));
 }
 
 QueryResult MySqlInterface::fetchQueryResult()
 {
-    QueryResult queryResult;
+    if(executedStatement_ != nullptr)
+    {
+        MYSQL_STMT *statement = executedStatement_;
+        executedStatement_ = nullptr;
+
+        return this->fetchStatementRows(statement);
+    }
+
     queryResult_ = mysql_store_result(&handle_);
 
-    if(queryResult_ != nullptr)
+    if(queryResult_ == nullptr)
     {
-        this->fetchRows(queryResult);
-
-        mysql_free_result(queryResult_);
+        return QueryResult();
     }
 
-    return std::move(queryResult);
+    QueryResult queryResult = this->fetchRows();
+    mysql_free_result(queryResult_);
+
+    return queryResult;
 }
 
 Row::Fields MySqlInterface::fetchFields()
@@ -100,35 +321,220 @@ Row::Fields MySqlInterface::fetchFields()
     return fields;
 }
 
-void MySqlInterface::fetchRows(QueryResult &queryResult)
+QueryResult MySqlInterface::fetchRows()
 {
-    MYSQL_ROW mysqlRow = mysql_fetch_row(queryResult_);
+    QueryResult queryResult(this->fetchFields());
+
+    size_t numberOfFields = queryResult.getFields().size();
+    size_t numberOfRows = mysql_num_rows(queryResult_);
+    size_t maxRowSize = 0;
+
+    MYSQL_FIELD *fields = mysql_fetch_fields(queryResult_);
 
-    const Row::Fields &fields = this->fetchFields();
+    for(size_t i = 0; i < numberOfFields; ++i)
+    {
+        maxRowSize += fields[i].max_length;
+    }
+
+    queryResult.reserve(numberOfRows, numberOfRows * numberOfFields, numberOfRows * maxRowSize);
+
+    MYSQL_ROW mysqlRow = mysql_fetch_row(queryResult_);
 
     while(mysqlRow != nullptr)
     {
-        Row &row = queryResult.createRow(fields);
+        unsigned long *lengths = mysql_fetch_lengths(queryResult_);
+        queryResult.createRow();
 
-        for(size_t i = 0; i < fields.size(); ++i)
+        for(size_t i = 0; i < numberOfFields; ++i)
         {
-            row.insert(mysqlRow[i]);
+            queryResult.insert(mysqlRow[i] != nullptr ? mysqlRow[i] : "", lengths[i]);
         }
 
         mysqlRow = mysql_fetch_row(queryResult_);
     }
+
+    return queryResult;
 }
 
-bool MySqlInterface::isAlive()
+MYSQL_STMT* MySqlInterface::getStatement(Statement::Id statementId)
 {
-    if(mysql_ping(&handle_) == 0)
+    if(statements_[statementId] != nullptr)
     {
-        return true;
+        return statements_[statementId];
+    }
+
+    MYSQL_STMT *statement = mysql_stmt_init(&handle_);
+
+    if(statement == nullptr)
+    {
+        errorMessage_ = mysql_error(&handle_);
+        eMU_LOG(error) << "Statement initialization failed, reason: " << errorMessage_;
+
+        this->handleFailure(mysql_errno(&handle_));
+        return nullptr;
+    }
+
+    const std::string &text = Statement::getText(statementId);
+
+    if(mysql_stmt_prepare(statement, text.c_str(), text.size()) != 0)
+    {
+        errorMessage_ = mysql_stmt_error(statement);
+        unsigned int errorCode = mysql_stmt_errno(statement);
+        eMU_LOG(error) << "Statement preparation failed, reason: " << errorMessage_ << ", statement: " << text;
+
+        mysql_stmt_close(statement);
+        this->handleFailure(errorCode);
+        return nullptr;
+    }
+
+    eMU_LOG(info) << "Prepared statement: " << text;
+    statements_[statementId] = statement;
+
+    return statement;
+}
+
+void MySqlInterface::closeStatement(Statement::Id statementId)
+{
+    if(statements_[statementId] != nullptr)
+    {
+        mysql_stmt_close(statements_[statementId]);
+        statements_[statementId] = nullptr;
+    }
+}
+
+QueryResult MySqlInterface::fetchStatementRows(MYSQL_STMT *statement)
+{
+    MYSQL_RES *metadata = mysql_stmt_result_metadata(statement);
+
+    if(metadata == nullptr)
+    {
+        return QueryResult();
+    }
+
+    MySqlBool updateMaxLength = true;
+    mysql_stmt_attr_set(statement, STMT_ATTR_UPDATE_MAX_LENGTH, &updateMaxLength);
+
+    if(mysql_stmt_store_result(statement) != 0)
+    {
+        eMU_LOG(error) << "Storing statement result failed, reason: " << mysql_stmt_error(statement);
+        mysql_free_result(metadata);
+        return QueryResult();
+    }
+
+    size_t numberOfFields = mysql_num_fields(metadata);
+    size_t numberOfRows = mysql_stmt_num_rows(statement);
+    MYSQL_FIELD *fields = mysql_fetch_fields(metadata);
+
+    Row::Fields rowFields;
+    size_t maxRowSize = 0;
+    std::vector<MYSQL_BIND> binds(numberOfFields);
+    std::vector<int64_t> integers(numberOfFields);
+    std::vector<unsigned long> lengths(numberOfFields);
+    std::unique_ptr<MySqlBool[]> nulls(new MySqlBool[numberOfFields]());
+    memset(binds.data(), 0, binds.size() * sizeof(MYSQL_BIND));
+
+    for(size_t i = 0; i < numberOfFields; ++i)
+    {
+        rowFields[fields[i].name] = i;
+        maxRowSize += isIntegerType(fields[i].type) ? kMaxIntegerLength : fields[i].max_length;
+    }
+
+    // single buffer for all string columns, integers are fetched binary and formatted into result
+    std::vector<char> strings(maxRowSize + numberOfFields);
+    size_t stringsOffset = 0;
+
+    for(size_t i = 0; i < numberOfFields; ++i)
+    {
+        if(isIntegerType(fields[i].type))
+        {
+            binds[i].buffer_type = MYSQL_TYPE_LONGLONG;
+            binds[i].buffer = &integers[i];
+        }
+        else
+        {
+            binds[i].buffer_type = MYSQL_TYPE_STRING;
+            binds[i].buffer = &strings[stringsOffset];
+            binds[i].buffer_length = fields[i].max_length + 1;
+            stringsOffset += binds[i].buffer_length;
+        }
+
+        binds[i].length = &lengths[i];
+        binds[i].is_null = &nulls[i];
+    }
+
+    QueryResult queryResult(rowFields);
+    queryResult.reserve(numberOfRows, numberOfRows * numberOfFields, numberOfRows * maxRowSize);
+
+    if(mysql_stmt_bind_result(statement, binds.data()) == 0)
+    {
+        while(mysql_stmt_fetch(statement) == 0)
+        {
+            queryResult.createRow();
+
+            for(size_t i = 0; i < numberOfFields; ++i)
+            {
+                if(nulls[i])
+                {
+                    queryResult.insert(nullptr, 0);
+                }
+                else if(isIntegerType(fields[i].type))
+                {
+                    char text[kMaxIntegerLength];
+                    queryResult.insert(text, formatInteger(integers[i], text));
+                }
+                else
+                {
+                    queryResult.insert(static_cast<const char*>(binds[i].buffer), lengths[i]);
+                }
+            }
+        }
     }
     else
     {
-        eMU_LOG(error) << "Ping failed, reason: " << this->getErrorMessage();
-        return false;
+        eMU_LOG(error) << "Binding statement result failed, reason: " << mysql_stmt_error(statement);
+    }
+
+    mysql_stmt_free_result(statement);
+    mysql_free_result(metadata);
+
+    return queryResult;
+}
+
+void MySqlInterface::attachThread()
+{
+    mysql_thread_init();
+}
+
+void MySqlInterface::detachThread()
+{
+    mysql_thread_end();
+}
+
+bool MySqlInterface::isAlive()
+{
+    connected_ = mysql_ping(&handle_) == 0;
+
+    if(!connected_)
+    {
+        errorMessage_ = mysql_error(&handle_);
+        eMU_LOG(error) << "Ping failed, reason: " << errorMessage_;
+    }
+
+    return connected_;
+}
+
+bool MySqlInterface::isConnected()
+{
+    return connected_;
+}
+
+void MySqlInterface::handleFailure(unsigned int errorCode)
+{
+    if(isConnectionError(errorCode))
+    {
+        // failed request is not repeated, reconnect only spares the following ones
+        connected_ = false;
+        this->reconnect();
     }
 }
 
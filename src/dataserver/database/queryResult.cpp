@@ -7,16 +7,110 @@ namespace dataserver
 namespace database
 {
 
-const Rows& QueryResult::getRows() const
+QueryResult::QueryResult():
+    offsets_(1, 0) {}
+
+QueryResult::QueryResult(const Row::Fields &fields):
+    fields_(fields),
+    offsets_(1, 0) {}
+
+void QueryResult::reserve(size_t numberOfRows, size_t numberOfValues, size_t dataSize)
 {
-    return rows_;
+    rowsBegins_.reserve(numberOfRows);
+    offsets_.reserve(numberOfValues + 1);
+    data_.reserve(dataSize);
 }
 
-Row& QueryResult::createRow(const Row::Fields &fields)
+void QueryResult::createRow()
 {
-    rows_.push_back(Row(fields));
+    rowsBegins_.push_back(offsets_.size() - 1);
+}
+
+void QueryResult::insert(const char *data, size_t size)
+{
+    data_.insert(data_.end(), data, data + size);
+    offsets_.push_back(static_cast<Row::Offset>(data_.size()));
+}
+
+void QueryResult::insert(const std::string &value)
+{
+    this->insert(value.data(), value.size());
+}
+
+const Row::Fields& QueryResult::getFields() const
+{
+    return fields_;
+}
+
+size_t QueryResult::getFieldIndex(const std::string &field) const
+{
+    return fields_.at(field);
+}
+
+size_t QueryResult::getNumberOfRows() const
+{
+    return rowsBegins_.size();
+}
+
+Row QueryResult::getRow(size_t index) const
+{
+    size_t begin = rowsBegins_[index];
+    size_t end = index + 1 < rowsBegins_.size() ? rowsBegins_[index + 1] : offsets_.size() - 1;
+
+    return Row(data_.data(), &offsets_[begin], end - begin, fields_);
+}
+
+Rows QueryResult::getRows() const
+{
+    return Rows(*this);
+}
 
-    return rows_.back();
+Rows::Iterator::Iterator(const QueryResult &queryResult, size_t index):
+    queryResult_(&queryResult),
+    index_(index) {}
+
+Row Rows::Iterator::operator*() const
+{
+    return queryResult_->getRow(index_);
+}
+
+Rows::Iterator& Rows::Iterator::operator++()
+{
+    ++index_;
+    return *this;
+}
+
+bool Rows::Iterator::operator!=(const Iterator &iterator) const
+{
+    return index_ != iterator.index_;
+}
+
+Rows::Rows(const QueryResult &queryResult):
+    queryResult_(queryResult) {}
+
+size_t Rows::size() const
+{
+    return queryResult_.getNumberOfRows();
+}
+
+bool Rows::empty() const
+{
+    return queryResult_.getNumberOfRows() == 0;
+}
+
+Row Rows::operator[](size_t index) const
+{
+    return queryResult_.getRow(index);
+}
+
+Rows::Iterator Rows::begin() const
+{
+    return Iterator(queryResult_, 0);
+}
+
+Rows::Iterator Rows::end() const
+{
+    return Iterator(queryResult_, queryResult_.getNumberOfRows());
 }
 
 }
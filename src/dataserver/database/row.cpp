@@ -7,20 +7,23 @@ namespace dataserver
 namespace database
 {
 
-Row::Row(const Fields &fields):
-    fields_(fields) {}
+Row::Row(const char *data, const Offset *offsets, size_t numberOfValues, const Fields &fields):
+    data_(data),
+    offsets_(offsets),
+    numberOfValues_(numberOfValues),
+    fields_(&fields) {}
 
-void Row::insert(const Value &value)
+size_t Row::getNumberOfValues() const
 {
-    values_.push_back(value);
+    return numberOfValues_;
 }
 
 template<>
 std::string Row::getValue(size_t index) const
 {
-    if(index < values_.size())
+    if(index < numberOfValues_)
     {
-        return values_[index];
+        return std::string(data_ + offsets_[index], offsets_[index + 1] - offsets_[index]);
     }
     else
     {
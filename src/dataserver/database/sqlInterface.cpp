@@ -1,5 +1,7 @@
 #include <dataserver/database/sqlInterface.hpp>
 
+#include <core/common/logging.hpp>
+
 namespace eMU
 {
 namespace dataserver
@@ -9,6 +11,22 @@ namespace database
 
 SqlInterface::~SqlInterface() {}
 
+void SqlInterface::attachThread() {}
+
+void SqlInterface::detachThread() {}
+
+bool SqlInterface::checkHealth()
+{
+    if(this->isAlive())
+    {
+        return true;
+    }
+
+    eMU_LOG(warning) << "Connection to database is not alive, reconnecting.";
+
+    return this->reconnect();
+}
+
 }
 }
 }
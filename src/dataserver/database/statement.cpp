@@ -0,0 +1,52 @@
+#include <dataserver/database/statement.hpp>
+
+#include <algorithm>
+
+namespace eMU
+{
+namespace dataserver
+{
+namespace database
+{
+
+const size_t Statement::kMaxBatchSize;
+
+namespace
+{
+
+std::string makeInList(size_t numberOfParameters)
+{
+    std::string list = "(?";
+
+    for(size_t i = 1; i < numberOfParameters; ++i)
+    {
+        list += ", ?";
+    }
+
+    return list + ")";
+}
+
+const std::string kTexts[Statement::NUMBER_OF_STATEMENTS] =
+{
+    "SELECT `eMU_AccountCheck`(?, ?, ?)",
+    "SELECT hairColor, hairType, level, name, race, tutorialState FROM characters WHERE accountId=?",
+    "SELECT eMU_CharacterCreate(?, ?, ?, ?, ?, ?, ?, ?, ?, ?)",
+    "SELECT accountId, hairColor, hairType, level, name, race, tutorialState FROM characters WHERE accountId IN "
+        + makeInList(Statement::kMaxBatchSize)
+};
+
+}
+
+const std::string& Statement::getText(Id id)
+{
+    return kTexts[id];
+}
+
+size_t Statement::getNumberOfParameters(Id id)
+{
+    return std::count(kTexts[id].begin(), kTexts[id].end(), '?');
+}
+
+}
+}
+}
@@ -0,0 +1,194 @@
+#include <dataserver/database/workersPool.hpp>
+
+#include <core/common/logging.hpp>
+
+namespace eMU
+{
+namespace dataserver
+{
+namespace database
+{
+
+WorkersPool::WorkersPool(const SqlInterfacesContainer &sqlInterfaces):
+    sqlInterfaces_(sqlInterfaces),
+    running_(false),
+    maxQueueDepth_(0),
+    healthCheckInterval_(0),
+    numberOfExecutedJobs_(0),
+    totalWaitTime_(0),
+    numberOfHealthChecks_(0),
+    numberOfFailedHealthChecks_(0) {}
+
+WorkersPool::~WorkersPool()
+{
+    this->stop();
+}
+
+void WorkersPool::setHealthCheckInterval(std::chrono::milliseconds interval)
+{
+    healthCheckInterval_ = interval;
+}
+
+void WorkersPool::start()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = true;
+    }
+
+    for(SqlInterface *sqlInterface : sqlInterfaces_)
+    {
+        workers_.create_thread(std::bind(&WorkersPool::work, this, std::ref(*sqlInterface)));
+    }
+
+    eMU_LOG(info) << "Database workers started, number of workers: " << sqlInterfaces_.size();
+}
+
+void WorkersPool::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if(!running_)
+        {
+            return;
+        }
+
+        running_ = false;
+    }
+
+    jobQueued_.notify_all();
+    workers_.join_all();
+}
+
+void WorkersPool::post(const Job &job)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if(running_)
+        {
+            queue_.push_back(QueuedJob{job, Clock::now()});
+            maxQueueDepth_ = std::max(maxQueueDepth_, queue_.size());
+            jobQueued_.notify_one();
+
+            return;
+        }
+    }
+
+    this->execute(job, *sqlInterfaces_.front());
+}
+
+void WorkersPool::work(SqlInterface &sqlInterface)
+{
+    sqlInterface.attachThread();
+
+    Clock::time_point nextHealthCheck = Clock::now() + healthCheckInterval_;
+    auto jobAvailable = [this]() { return !running_ || !queue_.empty(); };
+
+    while(true)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        if(healthCheckInterval_.count() == 0)
+        {
+            jobQueued_.wait(lock, jobAvailable);
+        }
+        else if(!jobQueued_.wait_until(lock, nextHealthCheck, jobAvailable))
+        {
+            lock.unlock();
+
+            this->checkHealth(sqlInterface);
+            nextHealthCheck = Clock::now() + healthCheckInterval_;
+            continue;
+        }
+
+        if(queue_.empty())
+        {
+            break;
+        }
+
+        QueuedJob queuedJob = std::move(queue_.front());
+        queue_.pop_front();
+        lock.unlock();
+
+        totalWaitTime_ += std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - queuedJob.enqueueTime_).count();
+        this->execute(queuedJob.job_, sqlInterface);
+
+        if(healthCheckInterval_.count() == 0)
+        {
+            continue;
+        }
+
+        // busy connection proves itself by executed queries, lost one is retried at every interval even under load
+        if(sqlInterface.isConnected())
+        {
+            nextHealthCheck = Clock::now() + healthCheckInterval_;
+        }
+        else if(Clock::now() >= nextHealthCheck)
+        {
+            this->checkHealth(sqlInterface);
+            nextHealthCheck = Clock::now() + healthCheckInterval_;
+        }
+    }
+
+    sqlInterface.detachThread();
+}
+
+void WorkersPool::execute(const Job &job, SqlInterface &sqlInterface)
+{
+    job(sqlInterface);
+    ++numberOfExecutedJobs_;
+}
+
+void WorkersPool::checkHealth(SqlInterface &sqlInterface)
+{
+    ++numberOfHealthChecks_;
+
+    if(!sqlInterface.checkHealth())
+    {
+        ++numberOfFailedHealthChecks_;
+        eMU_LOG(error) << "Database connection health check failed, reason: " << sqlInterface.getErrorMessage();
+    }
+}
+
+size_t WorkersPool::getNumberOfWorkers() const
+{
+    return sqlInterfaces_.size();
+}
+
+size_t WorkersPool::getQueueDepth() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size();
+}
+
+size_t WorkersPool::getMaxQueueDepth() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return maxQueueDepth_;
+}
+
+uint64_t WorkersPool::getNumberOfExecutedJobs() const
+{
+    return numberOfExecutedJobs_;
+}
+
+uint64_t WorkersPool::getTotalWaitTime() const
+{
+    return totalWaitTime_;
+}
+
+uint64_t WorkersPool::getNumberOfHealthChecks() const
+{
+    return numberOfHealthChecks_;
+}
+
+uint64_t WorkersPool::getNumberOfFailedHealthChecks() const
+{
+    return numberOfFailedHealthChecks_;
+}
+
+}
+}
+}
@@ -1,52 +1,136 @@
-#include <dataserver/main.hpp>
-#include <dataserver/database/mySqlInterface.hpp>
-#include <dataserver/context.hpp>
-#include <dataserver/protocol.hpp>
-#include <core/network/tcp/connectionsAcceptor.hpp>
-#include <core/common/concurrency.hpp>
-
-#include <boost/thread.hpp>
-#include <core/common/logging.hpp>
-#include <gflags/gflags.h>
-
-DEFINE_string(db_host, "127.0.0.1", "Database engine address");
-DEFINE_int32(db_port, 3306, "Database engine listen port");
-DEFINE_string(db_name, "mu2", "Database name");
-DEFINE_string(db_user, "root", "Database engine user name");
-DEFINE_string(db_password, "root", "Database engine user password");
-DEFINE_int32(max_users, 5, "Max number of users to connect");
-DEFINE_int32(port, 55960, "server listen port");
-DEFINE_int32(max_threads, 2, "max number of concurrent threads");
-
-int main(int argsCount, char *args[])
-{
-    google::ParseCommandLineFlags(&argsCount, &args, true);
-
-    eMU::dataserver::database::MySqlInterface mysqlInterface;
-    if(!mysqlInterface.initialize())
-    {
-        eMU_LOG(error) << "Initialization of database engine failed.";
-        return 1;
-    }
-
-    if(!mysqlInterface.connect(FLAGS_db_host, FLAGS_db_port, FLAGS_db_user, FLAGS_db_password, FLAGS_db_name))
-    {
-        eMU_LOG(error) << "Connect to database engine failed.";
-        return 1;
-    }
-
-    eMU::dataserver::Context dataserverContext(mysqlInterface, FLAGS_max_users);
-    eMU::dataserver::Protocol dataserverProtocol(dataserverContext);
-    boost::asio::io_service ioService;
-
-    eMU::core::network::tcp::ConnectionsAcceptor connectionsAcceptor(ioService, FLAGS_port, dataserverProtocol);
-    connectionsAcceptor.queueAccept();
-
-    eMU::core::common::Concurrency concurrency(ioService, FLAGS_max_threads);
-    concurrency.start();
-    concurrency.join();
-
-    mysqlInterface.cleanup();
-
-    return 0;
-}
+#include <dataserver/main.hpp>
+#include <dataserver/database/mySqlInterface.hpp>
+#include <dataserver/context.hpp>
+#include <dataserver/protocol.hpp>
+#include <core/network/tcp/connectionsAcceptor.hpp>
+#include <core/common/concurrency.hpp>
+#include <core/metrics/exporter.hpp>
+
+#include <boost/thread.hpp>
+#include <core/common/logging.hpp>
+#include <gflags/gflags.h>
+
+DEFINE_string(db_host, "127.0.0.1", "Database engine address");
+DEFINE_int32(db_port, 3306, "Database engine listen port");
+DEFINE_string(db_name, "mu2", "Database name");
+DEFINE_string(db_user, "root", "Database engine user name");
+DEFINE_string(db_password, "root", "Database engine user password");
+DEFINE_int32(db_connections, 4, "number of database connections, each served by its own worker thread");
+DEFINE_int32(db_health_check_interval, 30, "seconds after which idle or lost database connection is pinged and reconnected when needed, 0 disables");
+DEFINE_int32(characters_list_batch_size, 16, "max number of characters list requests selected by single query, 1 disables batching");
+DEFINE_int32(characters_list_batch_latency, 0, "microseconds characters list request may wait for batch to fill, 0 coalesces only already queued requests");
+DEFINE_int32(characters_cache_size, 16, "megabytes of memory used to cache characters lists, 0 disables caching");
+DEFINE_int32(characters_cache_ttl, 300, "seconds after which cached characters list is selected from database again");
+DEFINE_int32(max_users, 5, "Max number of users to connect");
+DEFINE_int32(port, 55960, "server listen port");
+DEFINE_int32(max_threads, 2, "max number of concurrent threads");
+DEFINE_bool(io_service_per_thread, false, "run separate event loop on each thread and spread accepted connections across them");
+DEFINE_int32(write_queue_high_watermark, 65536, "connection write queue size which notifies protocol about congestion");
+DEFINE_int32(write_queue_low_watermark, 16384, "connection write queue size which ends congestion");
+DEFINE_int32(metrics_port, 0, "loopback port serving metrics in Prometheus text format, 0 disables");
+
+int main(int argsCount, char *args[])
+{
+    google::ParseCommandLineFlags(&argsCount, &args, true);
+
+    if(FLAGS_db_connections < 1)
+    {
+        eMU_LOG(error) << "At least one database connection is required.";
+        return 1;
+    }
+
+    std::vector<std::unique_ptr<eMU::dataserver::database::MySqlInterface>> mysqlInterfaces;
+    eMU::dataserver::database::WorkersPool::SqlInterfacesContainer sqlInterfaces;
+
+    for(int32_t i = 0; i < FLAGS_db_connections; ++i)
+    {
+        mysqlInterfaces.push_back(std::unique_ptr<eMU::dataserver::database::MySqlInterface>(new eMU::dataserver::database::MySqlInterface()));
+
+        if(!mysqlInterfaces.back()->initialize())
+        {
+            eMU_LOG(error) << "Initialization of database engine failed.";
+            return 1;
+        }
+
+        if(!mysqlInterfaces.back()->connect(FLAGS_db_host, FLAGS_db_port, FLAGS_db_user, FLAGS_db_password, FLAGS_db_name))
+        {
+            eMU_LOG(error) << "Connect to database engine failed.";
+            return 1;
+        }
+
+        sqlInterfaces.push_back(mysqlInterfaces.back().get());
+    }
+
+    eMU::dataserver::Context dataserverContext(sqlInterfaces, FLAGS_max_users);
+    dataserverContext.getDatabaseWorkers().setHealthCheckInterval(std::chrono::seconds(FLAGS_db_health_check_interval));
+    size_t charactersListBatchSize = std::min<size_t>(std::max(FLAGS_characters_list_batch_size, 1), eMU::dataserver::database::Statement::kMaxBatchSize);
+    dataserverContext.getCharactersListBatcher().configure(charactersListBatchSize, std::chrono::microseconds(FLAGS_characters_list_batch_latency));
+    dataserverContext.getCharactersCache().configure(static_cast<size_t>(std::max(FLAGS_characters_cache_size, 0)) * 1024 * 1024,
+                                                     std::chrono::seconds(FLAGS_characters_cache_ttl));
+    dataserverContext.getDatabaseWorkers().start();
+
+    eMU::dataserver::Protocol dataserverProtocol(dataserverContext);
+    dataserverProtocol.setWriteQueueWatermarks(FLAGS_write_queue_high_watermark, FLAGS_write_queue_low_watermark);
+    boost::asio::io_service ioService;
+
+    eMU::core::common::Concurrency::Model concurrencyModel = FLAGS_io_service_per_thread ? eMU::core::common::Concurrency::Model::IO_SERVICE_PER_THREAD
+                                                                                         : eMU::core::common::Concurrency::Model::SHARED_IO_SERVICE;
+    eMU::core::common::Concurrency concurrency(ioService, FLAGS_max_threads, concurrencyModel);
+
+    eMU::core::network::tcp::ConnectionsAcceptor connectionsAcceptor(ioService, FLAGS_port, dataserverProtocol);
+    if(FLAGS_io_service_per_thread)
+    {
+        connectionsAcceptor.setIoServiceSelector(std::bind(&eMU::core::common::Concurrency::getNextIoService, &concurrency));
+    }
+    connectionsAcceptor.queueAccept();
+
+    eMU::core::metrics::Registry &metricsRegistry = eMU::core::metrics::Registry::getInstance();
+    eMU::dataserver::database::WorkersPool &workersPool = dataserverContext.getDatabaseWorkers();
+    eMU::dataserver::CharactersCache &cache = dataserverContext.getCharactersCache();
+    metricsRegistry.addGaugeCallback("emu_db_queue_depth", "Database jobs waiting for worker.", [&workersPool]() { return workersPool.getQueueDepth(); });
+    metricsRegistry.addGaugeCallback("emu_db_max_queue_depth", "Deepest database jobs queue so far.", [&workersPool]() { return workersPool.getMaxQueueDepth(); });
+    metricsRegistry.addGaugeCallback("emu_characters_cache_entries", "Cached characters lists.", [&cache]() { return cache.size(); });
+    metricsRegistry.addGaugeCallback("emu_characters_cache_memory_bytes", "Memory used by cached characters lists.", [&cache]() { return cache.getMemorySize(); });
+
+    std::unique_ptr<eMU::core::metrics::Exporter> metricsExporter;
+    if(FLAGS_metrics_port > 0)
+    {
+        metricsExporter.reset(new eMU::core::metrics::Exporter(ioService, FLAGS_metrics_port, eMU::core::metrics::Registry::getInstance()));
+        metricsExporter->queueAccept();
+    }
+
+    concurrency.start();
+    concurrency.join();
+
+    eMU::dataserver::database::WorkersPool &databaseWorkers = dataserverContext.getDatabaseWorkers();
+    databaseWorkers.stop();
+
+    eMU_LOG(info) << "Database workers: " << databaseWorkers.getNumberOfWorkers()
+        << ", executed jobs: " << databaseWorkers.getNumberOfExecutedJobs()
+        << ", max queue depth: " << databaseWorkers.getMaxQueueDepth()
+        << ", total wait time [us]: " << databaseWorkers.getTotalWaitTime()
+        << ", health checks: " << databaseWorkers.getNumberOfHealthChecks()
+        << ", failed health checks: " << databaseWorkers.getNumberOfFailedHealthChecks();
+
+    eMU::dataserver::transactions::CharactersListBatchRequest::Batcher &charactersListBatcher = dataserverContext.getCharactersListBatcher();
+
+    eMU_LOG(info) << "Characters list batching, requests: " << charactersListBatcher.getNumberOfRequests()
+        << ", batches: " << charactersListBatcher.getNumberOfBatches()
+        << ", largest batch: " << charactersListBatcher.getLargestBatchSize();
+
+    eMU::dataserver::CharactersCache &charactersCache = dataserverContext.getCharactersCache();
+
+    eMU_LOG(info) << "Characters cache, hits: " << charactersCache.getNumberOfHits()
+        << ", misses: " << charactersCache.getNumberOfMisses()
+        << ", evictions: " << charactersCache.getNumberOfEvictions()
+        << ", invalidations: " << charactersCache.getNumberOfInvalidations()
+        << ", entries: " << charactersCache.size()
+        << ", memory [B]: " << charactersCache.getMemorySize();
+
+    for(auto &mysqlInterface : mysqlInterfaces)
+    {
+        mysqlInterface->cleanup();
+    }
+
+    return 0;
+}
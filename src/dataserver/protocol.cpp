@@ -1,52 +1,96 @@
-#include <dataserver/protocol.hpp>
-#include <dataserver/transactions/checkAccountRequest.hpp>
-#include <dataserver/transactions/charactersListRequest.hpp>
-#include <dataserver/transactions/characterCreateRequest.hpp>
-
-#include <streaming/dataserver/streamIds.hpp>
-#include <streaming/dataserver/checkAccountRequest.hpp>
-#include <streaming/dataserver/charactersListRequest.hpp>
-#include <streaming/dataserver/characterCreateRequest.hpp>
-
-#include <core/common/logging.hpp>
-
-namespace eMU
-{
-namespace dataserver
-{
-
-Protocol::Protocol(Context &context):
-    protocols::Server<User>(context),
-    context_(context) {}
-
-bool Protocol::handleReadStream(User &user, const streaming::ReadStream &stream)
-{
-    uint16_t streamId = stream.getId();
-
-    if(streamId == streaming::dataserver::streamIds::kCheckAccountRequest)
-    {
-        streaming::dataserver::CheckAccountRequest request(stream);
-        transactions::CheckAccountRequest(user, context_.getSqlInterface(), request).handle();
-        return true;
-    }
-
-    if(streamId == streaming::dataserver::streamIds::kCharactersListRequest)
-    {
-        streaming::dataserver::CharactersListRequest request(stream);
-        transactions::CharactersListRequest(user, context_.getSqlInterface(), request).handle();
-        return true;
-    }
-
-    if(streamId == streaming::dataserver::streamIds::kCharacterCreateRequest)
-    {
-        streaming::dataserver::CharacterCreateRequest request(stream);
-        transactions::CharacterCreateRequest(user, context_.getSqlInterface(), request).handle();
-        return true;
-    }
-
-    return false;
-}
-
-
-}
-}
+#include <dataserver/protocol.hpp>
+#include <dataserver/transactions/checkAccountRequest.hpp>
+#include <dataserver/transactions/charactersListRequest.hpp>
+#include <dataserver/transactions/characterCreateRequest.hpp>
+
+#include <streaming/dataserver/streamIds.hpp>
+#include <streaming/dataserver/checkAccountRequest.hpp>
+#include <streaming/dataserver/charactersListRequest.hpp>
+#include <streaming/dataserver/charactersListResponse.hpp>
+#include <streaming/dataserver/characterCreateRequest.hpp>
+
+#include <core/common/logging.hpp>
+
+namespace eMU
+{
+namespace dataserver
+{
+
+Protocol::Protocol(Context &context):
+    protocols::Server<User>(context, streaming::dataserver::streamIds::kStreamIdBase),
+    context_(context)
+{
+    this->registerHandler(streaming::dataserver::streamIds::kCheckAccountRequest,
+                          [this](User &user, const streaming::ReadStreamView &stream) { this->handleCheckAccountRequest(user, stream); });
+    this->registerHandler(streaming::dataserver::streamIds::kCharactersListRequest,
+                          [this](User &user, const streaming::ReadStreamView &stream) { this->handleCharactersListRequest(user, stream); });
+    this->registerHandler(streaming::dataserver::streamIds::kCharacterCreateRequest,
+                          [this](User &user, const streaming::ReadStreamView &stream) { this->handleCharacterCreateRequest(user, stream); });
+}
+
+void Protocol::handleCheckAccountRequest(User &user, const streaming::ReadStreamView &stream)
+{
+    streaming::dataserver::CheckAccountRequest request(stream);
+    this->postTransaction<transactions::CheckAccountRequest>(user, request);
+}
+
+void Protocol::handleCharactersListRequest(User &user, const streaming::ReadStreamView &stream)
+{
+    streaming::dataserver::CharactersListRequest request(stream);
+
+    if(this->sendCachedCharactersList(user, request))
+    {
+        return;
+    }
+
+    if(context_.getCharactersListBatcher().isEnabled())
+    {
+        context_.getCharactersListBatcher().add(user.getConnection().shared_from_this(), request);
+    }
+    else
+    {
+        this->postTransaction<transactions::CharactersListRequest>(user, request, context_.getCharactersCache());
+    }
+}
+
+void Protocol::handleCharacterCreateRequest(User &user, const streaming::ReadStreamView &stream)
+{
+    streaming::dataserver::CharacterCreateRequest request(stream);
+    this->postTransaction<transactions::CharacterCreateRequest>(user, request, context_.getCharactersCache());
+}
+
+bool Protocol::sendCachedCharactersList(User &user, const streaming::dataserver::CharactersListRequest &request)
+{
+    streaming::common::CharacterInfoContainer characters;
+
+    if(!context_.getCharactersCache().find(request.getAccountId(), characters))
+    {
+        return false;
+    }
+
+    eMU_LOG(debug) << "hash: " << user.getHash()
+        << ", userHash: " << request.getUserHash()
+        << ", accountId: " << request.getAccountId() << ", characters list served from cache";
+
+    streaming::dataserver::CharactersListResponse response(request.getUserHash(), characters);
+    user.getConnection().send(response.getWriteStream().getPayload());
+
+    return true;
+}
+
+template<typename TransactionType, typename RequestType, typename... Arguments>
+void Protocol::postTransaction(User &user, const RequestType &request, Arguments&... arguments)
+{
+    core::network::tcp::Connection::Pointer connection = user.getConnection().shared_from_this();
+
+    // extra arguments are context owned services, captured by reference
+    context_.getDatabaseWorkers().post([connection, request, &arguments...](database::SqlInterface &sqlInterface)
+    {
+        // registered user may be destroyed by detach while job is queued, worker uses own handle bound to the same connection
+        User user(connection);
+        TransactionType(user, sqlInterface, request, arguments...).handle();
+    });
+}
+
+}
+}
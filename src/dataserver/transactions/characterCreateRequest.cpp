@@ -1,7 +1,6 @@
 #include <dataserver/transactions/characterCreateRequest.hpp>
 #include <streaming/dataserver/characterCreateResponse.hpp>
 
-#include <sstream>
 #include <core/common/logging.hpp>
 
 namespace eMU
@@ -13,9 +12,11 @@ namespace transactions
 
 CharacterCreateRequest::CharacterCreateRequest(User &user,
                                                database::SqlInterface &sqlInterface,
-                                               const streaming::dataserver::CharacterCreateRequest &request):
+                                               const streaming::dataserver::CharacterCreateRequest &request,
+                                               CharactersCache &charactersCache):
     DatabaseTransaction(user, sqlInterface, request.getUserHash()),
-    request_(request) {}
+    request_(request),
+    charactersCache_(charactersCache) {}
 
 void CharacterCreateRequest::handleValid()
 {
@@ -24,19 +25,24 @@ void CharacterCreateRequest::handleValid()
         << ", accountId: " << request_.getAccountId()
         << ", character name: " << request_.getCharacterCreateInfo().name_;
 
-    std::stringstream query;
-    query << "SELECT eMU_CharacterCreate('" << request_.getAccountId() << "'"
-        << ", '" << request_.getCharacterCreateInfo().name_ << "'"
-        << ", '" << static_cast<uint32_t>(request_.getCharacterCreateInfo().skin_) << "'"
-        << ", '" << static_cast<uint32_t>(request_.getCharacterCreateInfo().race_) << "'"
-        << ", '" << static_cast<uint32_t>(request_.getCharacterCreateInfo().face_) << "'"
-        << ", '" << static_cast<uint32_t>(request_.getCharacterCreateInfo().faceScars_) << "'"
-        << ", '" << static_cast<uint32_t>(request_.getCharacterCreateInfo().hairType_) << "'"
-        << ", '" << static_cast<uint32_t>(request_.getCharacterCreateInfo().hairColor_) << "'"
-        << ", '" << static_cast<uint32_t>(request_.getCharacterCreateInfo().tatoo_) << "'"
-        << ", '" << static_cast<uint32_t>(request_.getCharacterCreateInfo().skinColor_) << "');";
-
-    if(!sqlInterface_.executeQuery(query.str()))
+    const streaming::common::CharacterViewInfo &info = request_.getCharacterCreateInfo();
+    database::Statement::Parameters parameters = {request_.getAccountId(),
+                                                  info.name_,
+                                                  static_cast<uint32_t>(info.skin_),
+                                                  static_cast<uint32_t>(info.race_),
+                                                  static_cast<uint32_t>(info.face_),
+                                                  static_cast<uint32_t>(info.faceScars_),
+                                                  static_cast<uint32_t>(info.hairType_),
+                                                  static_cast<uint32_t>(info.hairColor_),
+                                                  static_cast<uint32_t>(info.tatoo_),
+                                                  static_cast<uint32_t>(info.skinColor_)};
+
+    bool executed = sqlInterface_.executeStatement(database::Statement::CHARACTER_CREATE, parameters);
+
+    // failed execution may still have been committed before connection was lost
+    charactersCache_.invalidate(request_.getAccountId());
+
+    if(!executed)
     {
         this->sendFaultIndication(sqlInterface_.getErrorMessage());
         return;
@@ -0,0 +1,106 @@
+#include <dataserver/transactions/charactersListBatchRequest.hpp>
+#include <streaming/dataserver/charactersListResponse.hpp>
+#include <streaming/dataserver/faultIndication.hpp>
+
+#include <core/common/logging.hpp>
+#include <boost/algorithm/string/predicate.hpp>
+
+namespace eMU
+{
+namespace dataserver
+{
+namespace transactions
+{
+
+CharactersListBatchRequest::CharactersListBatchRequest(database::SqlInterface &sqlInterface, const Batcher::Batch &batch, CharactersCache &charactersCache):
+    sqlInterface_(sqlInterface),
+    batch_(batch),
+    charactersCache_(charactersCache) {}
+
+bool CharactersListBatchRequest::isValid() const
+{
+    return !batch_.empty() && batch_.size() <= database::Statement::kMaxBatchSize && sqlInterface_.isConnected();
+}
+
+void CharactersListBatchRequest::handleInvalid()
+{
+    eMU_LOG(error) << "Characters list batch rejected, size: " << batch_.size();
+
+    this->sendFaultIndications("Connection to database is died");
+}
+
+void CharactersListBatchRequest::handleValid()
+{
+    database::Statement::Parameters parameters(database::Statement::kMaxBatchSize, batch_.front().request_.getAccountId());
+
+    for(size_t i = 0; i < batch_.size(); ++i)
+    {
+        parameters[i] = batch_[i].request_.getAccountId();
+    }
+
+    eMU_LOG(info) << "Characters list batch, size: " << batch_.size();
+
+    uint64_t cacheGeneration = charactersCache_.getGeneration();
+
+    if(!sqlInterface_.executeStatement(database::Statement::CHARACTERS_LIST_BATCH, parameters))
+    {
+        this->sendFaultIndications(sqlInterface_.getErrorMessage());
+        return;
+    }
+
+    const database::QueryResult &queryResult = sqlInterface_.fetchQueryResult();
+    size_t accountId = 0, hairColor = 0, hairType = 0, level = 0, name = 0, race = 0, tutorialState = 0;
+
+    if(!queryResult.getRows().empty())
+    {
+        accountId = queryResult.getFieldIndex("accountId");
+        hairColor = queryResult.getFieldIndex("hairColor");
+        hairType = queryResult.getFieldIndex("hairType");
+        level = queryResult.getFieldIndex("level");
+        name = queryResult.getFieldIndex("name");
+        race = queryResult.getFieldIndex("race");
+        tutorialState = queryResult.getFieldIndex("tutorialState");
+    }
+
+    for(const auto &entry : batch_)
+    {
+        streaming::common::CharacterInfoContainer characters;
+
+        for(const auto &row : queryResult.getRows())
+        {
+            // accountId comparison in database is case insensitive
+            if(!boost::algorithm::iequals(row.getValue<std::string>(accountId), entry.request_.getAccountId()))
+            {
+                continue;
+            }
+
+            streaming::common::CharacterListInfo character;
+            character.hairColor_ = row.getValue<uint32_t>(hairColor);
+            character.hairType_ = row.getValue<uint32_t>(hairType);
+            character.level_ = row.getValue<uint32_t>(level);
+            character.name_ = row.getValue<std::string>(name);
+            character.race_ = row.getValue<uint32_t>(race);
+            character.tutorialState_ = row.getValue<uint16_t>(tutorialState);
+
+            characters.push_back(character);
+        }
+
+        charactersCache_.insert(entry.request_.getAccountId(), characters, cacheGeneration);
+
+        streaming::dataserver::CharactersListResponse response(entry.request_.getUserHash(), characters);
+        entry.connection_->send(response.getWriteStream().getPayload());
+    }
+}
+
+void CharactersListBatchRequest::sendFaultIndications(const std::string &message)
+{
+    for(const auto &entry : batch_)
+    {
+        streaming::dataserver::FaultIndication indication(entry.request_.getUserHash(), message);
+        entry.connection_->send(indication.getWriteStream().getPayload());
+    }
+}
+
+}
+}
+}
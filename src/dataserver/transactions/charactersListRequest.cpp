@@ -1,7 +1,6 @@
 #include <dataserver/transactions/charactersListRequest.hpp>
 #include <streaming/dataserver/charactersListResponse.hpp>
 
-#include <sstream>
 #include <core/common/logging.hpp>
 
 namespace eMU
@@ -13,9 +12,11 @@ namespace transactions
 
 CharactersListRequest::CharactersListRequest(User &user,
                                              database::SqlInterface &sqlInterface,
-                                             const streaming::dataserver::CharactersListRequest &request):
+                                             const streaming::dataserver::CharactersListRequest &request,
+                                             CharactersCache &charactersCache):
     DatabaseTransaction(user, sqlInterface, request.getUserHash()),
-    request_(request) {}
+    request_(request),
+    charactersCache_(charactersCache) {}
 
 void CharactersListRequest::handleValid()
 {
@@ -23,10 +24,9 @@ void CharactersListRequest::handleValid()
         << ", userHash: " << request_.getUserHash()
         << ", accountId: " << request_.getAccountId();
 
-    std::stringstream query;
-    query << "SELECT hairColor, hairType, level, name, race, tutorialState FROM characters WHERE accountId='" << request_.getAccountId() << "';";
+    uint64_t cacheGeneration = charactersCache_.getGeneration();
 
-    if(!sqlInterface_.executeQuery(query.str()))
+    if(!sqlInterface_.executeStatement(database::Statement::CHARACTERS_LIST, {request_.getAccountId()}))
     {
         this->sendFaultIndication(sqlInterface_.getErrorMessage());
         return;
@@ -35,19 +35,33 @@ void CharactersListRequest::handleValid()
     const database::QueryResult &queryResult = sqlInterface_.fetchQueryResult();
     streaming::common::CharacterInfoContainer characters;
 
-    for(const auto &row : queryResult.getRows())
+    if(!queryResult.getRows().empty())
     {
-        streaming::common::CharacterListInfo character;
-        character.hairColor_ = row.getValue<uint32_t>("hairColor");
-        character.hairType_ = row.getValue<uint32_t>("hairType");
-        character.level_ = row.getValue<uint32_t>("level");
-        character.name_ = row.getValue<std::string>("name");
-        character.race_ = row.getValue<uint32_t>("race");
-        character.tutorialState_ = row.getValue<uint16_t>("tutorialState");
-
-        characters.push_back(character);
+        size_t hairColor = queryResult.getFieldIndex("hairColor");
+        size_t hairType = queryResult.getFieldIndex("hairType");
+        size_t level = queryResult.getFieldIndex("level");
+        size_t name = queryResult.getFieldIndex("name");
+        size_t race = queryResult.getFieldIndex("race");
+        size_t tutorialState = queryResult.getFieldIndex("tutorialState");
+
+        characters.reserve(queryResult.getNumberOfRows());
+
+        for(const auto &row : queryResult.getRows())
+        {
+            streaming::common::CharacterListInfo character;
+            character.hairColor_ = row.getValue<uint32_t>(hairColor);
+            character.hairType_ = row.getValue<uint32_t>(hairType);
+            character.level_ = row.getValue<uint32_t>(level);
+            character.name_ = row.getValue<std::string>(name);
+            character.race_ = row.getValue<uint32_t>(race);
+            character.tutorialState_ = row.getValue<uint16_t>(tutorialState);
+
+            characters.push_back(character);
+        }
     }
 
+    charactersCache_.insert(request_.getAccountId(), characters, cacheGeneration);
+
     streaming::dataserver::CharactersListResponse response(request_.getUserHash(), characters);
     user_.getConnection().send(response.getWriteStream().getPayload());
 }
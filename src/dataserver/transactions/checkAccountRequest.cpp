@@ -2,7 +2,6 @@
 #include <streaming/dataserver/checkAccountResponse.hpp>
 #include <streaming/dataserver/checkAccountResult.hpp>
 
-#include <sstream>
 #include <core/common/logging.hpp>
 
 namespace eMU
@@ -24,14 +23,9 @@ void CheckAccountRequest::handleValid()
         << ", userHash: " << request_.getUserHash()
         << ", accountId: " << request_.getAccountId();
 
-    std::stringstream query;
-    query << "SELECT"
-        << " `eMU_AccountCheck`("
-        << "'" << request_.getAccountId() << "'"
-        << ", '" << request_.getPassword() << "'"
-        << ", '" << "127.0.0.1" << "');";
+    database::Statement::Parameters parameters = {request_.getAccountId(), request_.getPassword(), std::string("127.0.0.1")};
 
-    if(!sqlInterface_.executeQuery(query.str()))
+    if(!sqlInterface_.executeStatement(database::Statement::CHECK_ACCOUNT, parameters))
     {
         this->sendFaultIndication(sqlInterface_.getErrorMessage());
         return;
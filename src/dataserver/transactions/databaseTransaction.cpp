@@ -20,7 +20,7 @@ DatabaseTransaction::DatabaseTransaction(User &user,
 
 bool DatabaseTransaction::isValid() const
 {
-    return sqlInterface_.isAlive();
+    return sqlInterface_.isConnected();
 }
 
 void DatabaseTransaction::handleInvalid()
@@ -1,45 +1,48 @@
-#include <gameserver/dataserverProtocol.hpp>
-#include <gameserver/transactions/charactersListResponse.hpp>
-#include <gameserver/transactions/characterCreateResponse.hpp>
-#include <gameserver/transactions/faultIndication.hpp>
-#include <streaming/dataserver/streamIds.hpp>
-#include <streaming/dataserver/charactersListResponse.hpp>
-#include <streaming/dataserver/characterCreateResponse.hpp>
-#include <streaming/dataserver/faultIndication.hpp>
-
-#include <core/common/logging.hpp>
-
-namespace eMU
-{
-namespace gameserver
-{
-
-DataserverProtocol::DataserverProtocol(Context &context):
-    protocols::Client(context),
-    context_(context) {}
-
-bool DataserverProtocol::handleReadStream(const streaming::ReadStream &stream)
-{
-    uint16_t streamId = stream.getId();
-
-    if(streamId == streaming::dataserver::streamIds::kCharactersListResponse)
-    {
-        streaming::dataserver::CharactersListResponse response(stream);
-        transactions::CharactersListResponse(context_.getUsersFactory(), response).handle();
-    }
-    if(streamId == streaming::dataserver::streamIds::kCharacterCreateResponse)
-    {
-        streaming::dataserver::CharacterCreateResponse response(stream);
-        transactions::CharacterCreateResponse(context_.getUsersFactory(), response).handle();
-    }
-    if(streamId == streaming::dataserver::streamIds::kFaultIndication)
-    {
-        streaming::dataserver::FaultIndication indication(stream);
-        transactions::FaultIndication(context_.getUsersFactory(), indication).handle();
-    }
-
-    return true;
-}
-
-}
-}
+#include <gameserver/dataserverProtocol.hpp>
+#include <gameserver/transactions/charactersListResponse.hpp>
+#include <gameserver/transactions/characterCreateResponse.hpp>
+#include <gameserver/transactions/faultIndication.hpp>
+#include <streaming/dataserver/streamIds.hpp>
+#include <streaming/dataserver/charactersListResponse.hpp>
+#include <streaming/dataserver/characterCreateResponse.hpp>
+#include <streaming/dataserver/faultIndication.hpp>
+
+#include <core/common/logging.hpp>
+
+namespace eMU
+{
+namespace gameserver
+{
+
+DataserverProtocol::DataserverProtocol(Context &context):
+    protocols::Client(context, streaming::dataserver::streamIds::kStreamIdBase),
+    context_(context)
+{
+    this->registerHandler(streaming::dataserver::streamIds::kCharactersListResponse,
+                          [this](const streaming::ReadStreamView &stream) { this->handleCharactersListResponse(stream); });
+    this->registerHandler(streaming::dataserver::streamIds::kCharacterCreateResponse,
+                          [this](const streaming::ReadStreamView &stream) { this->handleCharacterCreateResponse(stream); });
+    this->registerHandler(streaming::dataserver::streamIds::kFaultIndication,
+                          [this](const streaming::ReadStreamView &stream) { this->handleFaultIndication(stream); });
+}
+
+void DataserverProtocol::handleCharactersListResponse(const streaming::ReadStreamView &stream)
+{
+    streaming::dataserver::CharactersListResponse response(stream);
+    transactions::CharactersListResponse(context_.getUsersFactory(), response).handle();
+}
+
+void DataserverProtocol::handleCharacterCreateResponse(const streaming::ReadStreamView &stream)
+{
+    streaming::dataserver::CharacterCreateResponse response(stream);
+    transactions::CharacterCreateResponse(context_.getUsersFactory(), response).handle();
+}
+
+void DataserverProtocol::handleFaultIndication(const streaming::ReadStreamView &stream)
+{
+    streaming::dataserver::FaultIndication indication(stream);
+    transactions::FaultIndication(context_.getUsersFactory(), indication).handle();
+}
+
+}
+}
@@ -1,55 +1,124 @@
-#include <gameserver/main.hpp>
-#include <gameserver/context.hpp>
-#include <gameserver/protocol.hpp>
-#include <gameserver/dataserverProtocol.hpp>
-#include <gameserver/udpProtocol.hpp>
-#include <core/network/tcp/connectionsAcceptor.hpp>
-#include <core/common/concurrency.hpp>
-#include <core/network/tcp/connection.hpp>
-
-#include <boost/thread.hpp>
-#include <core/common/logging.hpp>
-#include <gflags/gflags.h>
-
-DEFINE_string(dataserver_host, "127.0.0.1", "Dataserver address");
-DEFINE_int32(dataserver_port, 55960, "Dataserver port");
-DEFINE_int32(max_users, 5, "Max number of users to connect");
-DEFINE_int32(port, 55901, "server listen port");
-DEFINE_int32(max_threads, 2, "max number of concurrent threads");
-DEFINE_int32(code, 0, "gameserver code");
-
-
-int main(int argsCount, char *args[])
-{
-    google::ParseCommandLineFlags(&argsCount, &args, true);
-
-    eMU::gameserver::Context gameserverContext(FLAGS_max_users, FLAGS_code);
-
-    eMU::gameserver::DataserverProtocol dataserverProtocol(gameserverContext);
-
-    boost::asio::io_service ioService;
-    eMU::core::network::tcp::Connection::Pointer dataserverConnection(new eMU::core::network::tcp::Connection(ioService, dataserverProtocol));
-    if(!dataserverConnection->connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::address::from_string(FLAGS_dataserver_host),
-                                                                    FLAGS_dataserver_port)))
-    {
-        eMU_LOG(error) << "Connection to datserver failed. host: " << FLAGS_dataserver_host << ", port: " << FLAGS_dataserver_port;
-        return 1;
-    }
-
-    eMU::gameserver::UdpProtocol udpProtocol(gameserverContext);
-    eMU::core::network::udp::Connection::Pointer udpConnection(new eMU::core::network::udp::Connection(ioService, FLAGS_port, udpProtocol));
-    udpConnection->registerConnection();
-    udpConnection->queueReceiveFrom();
-
-    eMU::gameserver::Protocol gameserverProtocol(gameserverContext);
-    eMU::core::network::tcp::ConnectionsAcceptor connectionsAcceptor(ioService, FLAGS_port, gameserverProtocol);
-    connectionsAcceptor.queueAccept();
-
-    eMU::core::common::Concurrency concurrency(ioService, FLAGS_max_threads);
-    concurrency.start();
-    concurrency.join();
-
-    udpConnection->unregisterConnection();
-
-    return 0;
-}
+#include <gameserver/main.hpp>
+#include <gameserver/context.hpp>
+#include <gameserver/protocol.hpp>
+#include <gameserver/dataserverProtocol.hpp>
+#include <gameserver/udpProtocol.hpp>
+#include <gameserver/transactions/loadIndication.hpp>
+#include <core/network/tcp/connectionsAcceptor.hpp>
+#include <core/common/concurrency.hpp>
+#include <core/metrics/exporter.hpp>
+#include <core/network/tcp/connection.hpp>
+
+#include <boost/thread.hpp>
+#include <core/common/logging.hpp>
+#include <gflags/gflags.h>
+
+DEFINE_string(dataserver_host, "127.0.0.1", "Dataserver address");
+DEFINE_int32(dataserver_port, 55960, "Dataserver port");
+DEFINE_int32(max_users, 5, "Max number of users to connect");
+DEFINE_int32(port, 55901, "server listen port");
+DEFINE_int32(max_threads, 2, "max number of concurrent threads");
+DEFINE_bool(io_service_per_thread, false, "run separate event loop on each thread and spread accepted connections across them");
+DEFINE_int32(acceptors, 1, "number of acceptors listening on server port, more than one enables SO_REUSEPORT");
+DEFINE_int32(pending_accepts, 1, "number of outstanding accepts queued by each acceptor");
+DEFINE_int32(code, 0, "gameserver code");
+DEFINE_int32(write_queue_high_watermark, 65536, "connection write queue size which notifies protocol about congestion");
+DEFINE_int32(write_queue_low_watermark, 16384, "connection write queue size which ends congestion");
+DEFINE_int32(metrics_port, 0, "loopback port serving metrics in Prometheus text format, 0 disables");
+DEFINE_string(loginserver_host, "127.0.0.1", "Loginserver address, load is reported to it over udp");
+DEFINE_int32(loginserver_port, 55557, "Loginserver udp port");
+DEFINE_int32(load_report_interval, 5, "seconds between load reports sent to loginserver, 0 disables");
+
+
+int main(int argsCount, char *args[])
+{
+    google::ParseCommandLineFlags(&argsCount, &args, true);
+
+    eMU::gameserver::Context gameserverContext(FLAGS_max_users, FLAGS_code);
+
+    eMU::gameserver::DataserverProtocol dataserverProtocol(gameserverContext);
+
+    boost::asio::io_service ioService;
+    eMU::core::network::tcp::Connection::Pointer dataserverConnection(new eMU::core::network::tcp::Connection(ioService, dataserverProtocol));
+    if(!dataserverConnection->connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::address::from_string(FLAGS_dataserver_host),
+                                                                    FLAGS_dataserver_port)))
+    {
+        eMU_LOG(error) << "Connection to datserver failed. host: " << FLAGS_dataserver_host << ", port: " << FLAGS_dataserver_port;
+        return 1;
+    }
+
+    eMU::gameserver::UdpProtocol udpProtocol(gameserverContext);
+    eMU::core::network::udp::Connection::Pointer udpConnection(new eMU::core::network::udp::Connection(ioService, FLAGS_port, udpProtocol));
+    udpConnection->registerConnection();
+    udpConnection->queueReceiveFrom();
+
+    eMU::gameserver::Protocol gameserverProtocol(gameserverContext);
+    gameserverProtocol.setWriteQueueWatermarks(FLAGS_write_queue_high_watermark, FLAGS_write_queue_low_watermark);
+
+    eMU::core::common::Concurrency::Model concurrencyModel = FLAGS_io_service_per_thread ? eMU::core::common::Concurrency::Model::IO_SERVICE_PER_THREAD
+                                                                                         : eMU::core::common::Concurrency::Model::SHARED_IO_SERVICE;
+    eMU::core::common::Concurrency concurrency(ioService, FLAGS_max_threads, concurrencyModel);
+
+    std::vector<std::unique_ptr<eMU::core::network::tcp::ConnectionsAcceptor>> connectionsAcceptors;
+    for(size_t i = 0; i < static_cast<size_t>(FLAGS_acceptors); ++i)
+    {
+        boost::asio::io_service &acceptorIoService = concurrency.getIoService(i % concurrency.getNumberOfIoServices());
+        connectionsAcceptors.push_back(std::unique_ptr<eMU::core::network::tcp::ConnectionsAcceptor>(
+            new eMU::core::network::tcp::ConnectionsAcceptor(acceptorIoService, FLAGS_port, gameserverProtocol, FLAGS_acceptors > 1, FLAGS_pending_accepts)));
+
+        if(FLAGS_io_service_per_thread && static_cast<size_t>(FLAGS_acceptors) < concurrency.getNumberOfIoServices())
+        {
+            connectionsAcceptors.back()->setIoServiceSelector(std::bind(&eMU::core::common::Concurrency::getNextIoService, &concurrency));
+        }
+
+        connectionsAcceptors.back()->queueAccept();
+    }
+
+    eMU::core::metrics::Registry::getInstance().addGaugeCallback("emu_users", "Connected users.",
+                                                                  [&gameserverContext]() { return gameserverContext.getUsersFactory().size(); });
+
+    std::unique_ptr<eMU::core::metrics::Exporter> metricsExporter;
+    if(FLAGS_metrics_port > 0)
+    {
+        metricsExporter.reset(new eMU::core::metrics::Exporter(ioService, FLAGS_metrics_port, eMU::core::metrics::Registry::getInstance()));
+        metricsExporter->queueAccept();
+    }
+
+    boost::asio::ip::udp::endpoint loginserverEndpoint(boost::asio::ip::address::from_string(FLAGS_loginserver_host), FLAGS_loginserver_port);
+    boost::asio::deadline_timer loadReportTimer(ioService);
+    std::function<void(const boost::system::error_code&)> reportLoad;
+    reportLoad = [&](const boost::system::error_code &errorCode)
+    {
+        if(errorCode)
+        {
+            return;
+        }
+
+        eMU::gameserver::transactions::LoadIndication(loginserverEndpoint,
+                                                      udpConnection,
+                                                      gameserverContext.getGameserverCode(),
+                                                      gameserverContext.getUsersFactory().size(),
+                                                      gameserverContext.getMaxNumberOfUsers()).handle();
+
+        loadReportTimer.expires_from_now(boost::posix_time::seconds(FLAGS_load_report_interval));
+        loadReportTimer.async_wait(reportLoad);
+    };
+
+    if(FLAGS_load_report_interval > 0)
+    {
+        reportLoad(boost::system::error_code());
+    }
+
+    concurrency.start();
+    concurrency.join();
+
+    for(size_t i = 0; i < connectionsAcceptors.size(); ++i)
+    {
+        eMU_LOG(info) << "Acceptor " << i << ", accepted connections: " << connectionsAcceptors[i]->getNumberOfAcceptedConnections()
+            << ", accept errors: " << connectionsAcceptors[i]->getNumberOfAcceptErrors();
+    }
+
+    udpConnection->unregisterConnection();
+
+    return 0;
+}
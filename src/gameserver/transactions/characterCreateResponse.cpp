@@ -10,7 +10,7 @@ namespace gameserver
 namespace transactions
 {
 
-CharacterCreateResponse::CharacterCreateResponse(core::common::Factory<User> &usersFactory,
+CharacterCreateResponse::CharacterCreateResponse(core::network::tcp::UsersFactory<User> &usersFactory,
                                                  const streaming::dataserver::CharacterCreateResponse &response):
     usersFactory_(usersFactory),
     response_(response) {}
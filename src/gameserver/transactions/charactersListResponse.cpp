@@ -10,7 +10,7 @@ namespace gameserver
 namespace transactions
 {
 
-CharactersListResponse::CharactersListResponse(core::common::Factory<User> &usersFactory,
+CharactersListResponse::CharactersListResponse(core::network::tcp::UsersFactory<User> &usersFactory,
                                                const streaming::dataserver::CharactersListResponse &response):
     usersFactory_(usersFactory),
     response_(response) {}
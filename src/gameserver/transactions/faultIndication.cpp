@@ -9,7 +9,7 @@ namespace gameserver
 namespace transactions
 {
 
-FaultIndication::FaultIndication(core::common::Factory<User> &usersFactory,
+FaultIndication::FaultIndication(core::network::tcp::UsersFactory<User> &usersFactory,
                                  const streaming::dataserver::FaultIndication &indication):
     usersFactory_(usersFactory),
     indication_(indication) {}
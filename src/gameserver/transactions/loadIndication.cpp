@@ -0,0 +1,44 @@
+#include <gameserver/transactions/loadIndication.hpp>
+#include <streaming/gameserver/loadIndication.hpp>
+
+#include <core/common/logging.hpp>
+
+namespace eMU
+{
+namespace gameserver
+{
+namespace transactions
+{
+
+LoadIndication::LoadIndication(const boost::asio::ip::udp::endpoint &loginserverEndpoint,
+                               core::network::udp::Connection::Pointer udpConnection,
+                               uint16_t gameserverCode,
+                               size_t numberOfUsers,
+                               size_t maxNumberOfUsers):
+    loginserverEndpoint_(loginserverEndpoint),
+    udpConnection_(udpConnection),
+    gameserverCode_(gameserverCode),
+    numberOfUsers_(numberOfUsers),
+    maxNumberOfUsers_(maxNumberOfUsers) {}
+
+bool LoadIndication::isValid() const
+{
+    return udpConnection_ != nullptr;
+}
+
+void LoadIndication::handleValid()
+{
+    eMU_LOG(debug) << "Reporting load, users: " << numberOfUsers_ << "/" << maxNumberOfUsers_;
+
+    streaming::gameserver::LoadIndication indication(gameserverCode_, numberOfUsers_, maxNumberOfUsers_);
+    udpConnection_->sendTo(loginserverEndpoint_, indication.getWriteStream().getPayload());
+}
+
+void LoadIndication::handleInvalid()
+{
+    eMU_LOG(error) << "udpConnection is nullptr!";
+}
+
+}
+}
+}
@@ -0,0 +1,186 @@
+#include <loadGenerator/main.hpp>
+#include <streaming/loginserver/gameserversListRequest.hpp>
+
+#include <boost/asio.hpp>
+#include <boost/thread.hpp>
+#include <gflags/gflags.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+DEFINE_string(host, "127.0.0.1", "address of tested server");
+DEFINE_int32(port, 55557, "port of tested server");
+DEFINE_int32(connections, 10000, "total number of connections to open");
+DEFINE_int32(rate, 2000, "number of new connections per second");
+DEFINE_int32(threads, 2, "number of load generator threads");
+
+// Opens connections at a fixed rate against loginserver. Every connection sends gameservers list request and waits
+// for first bytes of response, so measured latency covers handshake, server side accept, attach and first dispatch.
+// Server should be started with --max_users above number of connections open at the same time.
+
+namespace
+{
+
+typedef std::chrono::steady_clock Clock;
+
+class Probe: public std::enable_shared_from_this<Probe>
+{
+public:
+    Probe(boost::asio::io_service &ioService, const eMU::core::network::Payload &request,
+          double &connectLatency, double &responseLatency, std::atomic<size_t> &finishedProbes, std::atomic<size_t> &failedProbes):
+        socket_(ioService),
+        request_(request),
+        connectLatency_(connectLatency),
+        responseLatency_(responseLatency),
+        finishedProbes_(finishedProbes),
+        failedProbes_(failedProbes) {}
+
+    void start(const boost::asio::ip::tcp::endpoint &endpoint)
+    {
+        startTime_ = Clock::now();
+        socket_.async_connect(endpoint, std::bind(&Probe::connectHandler, shared_from_this(), std::placeholders::_1));
+    }
+
+private:
+    void connectHandler(const boost::system::error_code &errorCode)
+    {
+        if(errorCode)
+        {
+            this->finish(false);
+            return;
+        }
+
+        connectLatency_ = this->elapsed();
+        boost::asio::async_write(socket_, boost::asio::buffer(&request_[0], request_.getSize()),
+                                 std::bind(&Probe::writeHandler, shared_from_this(), std::placeholders::_1));
+    }
+
+    void writeHandler(const boost::system::error_code &errorCode)
+    {
+        if(errorCode)
+        {
+            this->finish(false);
+            return;
+        }
+
+        boost::asio::async_read(socket_, boost::asio::buffer(responseHeader_),
+                                std::bind(&Probe::readHandler, shared_from_this(), std::placeholders::_1));
+    }
+
+    void readHandler(const boost::system::error_code &errorCode)
+    {
+        if(errorCode)
+        {
+            this->finish(false);
+            return;
+        }
+
+        responseLatency_ = this->elapsed();
+        this->finish(true);
+    }
+
+    void finish(bool succeeded)
+    {
+        if(!succeeded)
+        {
+            ++failedProbes_;
+        }
+
+        boost::system::error_code errorCode;
+        socket_.close(errorCode);
+        ++finishedProbes_;
+    }
+
+    double elapsed() const
+    {
+        return std::chrono::duration<double, std::micro>(Clock::now() - startTime_).count();
+    }
+
+    boost::asio::ip::tcp::socket socket_;
+    const eMU::core::network::Payload &request_;
+    double &connectLatency_;
+    double &responseLatency_;
+    std::atomic<size_t> &finishedProbes_;
+    std::atomic<size_t> &failedProbes_;
+    Clock::time_point startTime_;
+    uint8_t responseHeader_[sizeof(uint32_t)];
+};
+
+void printPercentiles(const std::string &name, std::vector<double> latencies)
+{
+    latencies.erase(std::remove(latencies.begin(), latencies.end(), 0.0), latencies.end());
+
+    if(latencies.empty())
+    {
+        std::cout << name << ": no samples" << std::endl;
+        return;
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+
+    std::cout << name << " [us]:" << std::fixed << std::setprecision(1);
+    for(const auto &percentile : {std::make_pair("p50", 0.5), std::make_pair("p90", 0.9), std::make_pair("p99", 0.99), std::make_pair("p99.9", 0.999)})
+    {
+        size_t index = std::min(latencies.size() - 1, static_cast<size_t>(percentile.second * latencies.size()));
+        std::cout << " " << percentile.first << "=" << latencies[index];
+    }
+    std::cout << " max=" << latencies.back() << ", samples: " << latencies.size() << std::endl;
+}
+
+}
+
+int main(int argsCount, char *args[])
+{
+    google::ParseCommandLineFlags(&argsCount, &args, true);
+
+    const size_t numberOfConnections = FLAGS_connections;
+    const boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::address::from_string(FLAGS_host), FLAGS_port);
+    eMU::streaming::loginserver::GameserversListRequest gameserversListRequest;
+    const eMU::core::network::Payload &request = gameserversListRequest.getWriteStream().getPayload();
+
+    std::vector<double> connectLatencies(numberOfConnections, 0.0);
+    std::vector<double> responseLatencies(numberOfConnections, 0.0);
+    std::atomic<size_t> finishedProbes(0);
+    std::atomic<size_t> failedProbes(0);
+
+    boost::asio::io_service ioService;
+    std::unique_ptr<boost::asio::io_service::work> work(new boost::asio::io_service::work(ioService));
+
+    boost::thread_group threads;
+    for(int32_t i = 0; i < FLAGS_threads; ++i)
+    {
+        threads.create_thread(std::bind(static_cast<size_t (boost::asio::io_service::*)()>(&boost::asio::io_service::run), &ioService));
+    }
+
+    const std::chrono::microseconds interval(1000000 / std::max(FLAGS_rate, 1));
+    Clock::time_point startTime = Clock::now();
+
+    for(size_t i = 0; i < numberOfConnections; ++i)
+    {
+        std::this_thread::sleep_until(startTime + i * interval);
+
+        std::make_shared<Probe>(ioService, request, connectLatencies[i], responseLatencies[i], finishedProbes, failedProbes)->start(endpoint);
+    }
+
+    while(finishedProbes < numberOfConnections)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    double duration = std::chrono::duration<double>(Clock::now() - startTime).count();
+
+    work.reset();
+    threads.join_all();
+
+    std::cout << "connections: " << numberOfConnections << ", failed: " << failedProbes
+              << ", achieved rate: " << std::fixed << std::setprecision(1) << numberOfConnections / duration << " conn/s" << std::endl;
+    printPercentiles("connect latency", connectLatencies);
+    printPercentiles("accept to first response latency", responseLatencies);
+
+    return failedProbes == 0 ? 0 : 1;
+}
@@ -1,13 +1,23 @@
 #include <loginserver/gameserversList.hpp>
 #include <core/common/exception.hpp>
+#include <streaming/loginserver/gameserversListResponse.hpp>
 
 #include <core/common/logging.hpp>
+#include <algorithm>
 
 namespace eMU
 {
 namespace loginserver
 {
 
+GameserversList::GameserversList():
+    loadTimeout_(0),
+    numberOfLoads_(0),
+    numberOfRedirections_(0)
+{
+    this->publish(std::make_shared<Snapshot>());
+}
+
 GameserversList::~GameserversList() {}
 
 bool GameserversList::initialize(eMU::core::common::XmlReader &xmlReader)
@@ -19,6 +29,8 @@ bool GameserversList::initialize(eMU::core::common::XmlReader &xmlReader)
         return false;
     }
 
+    std::shared_ptr<Snapshot> snapshot = std::make_shared<Snapshot>();
+
     while(!xmlReader.end())
     {
         streaming::loginserver::GameserverInfo info = {};
@@ -27,34 +39,214 @@ bool GameserversList::initialize(eMU::core::common::XmlReader &xmlReader)
         info.code_ = xmlReader.get<uint16_t>("server", "code");
         info.name_ = xmlReader.get<std::string>("server", "name");
         info.port_ = xmlReader.get<uint16_t>("server", "port");
-        servers_.push_back(info);
 
+        if(!snapshot->indexes_.insert(std::make_pair(info.code_, snapshot->servers_.size())).second)
+        {
+            eMU_LOG(error) << "Duplicated gameserver code: " << info.code_ << " in servers list xml.";
+
+            return false;
+        }
+
+        snapshot->servers_.push_back(info);
         xmlReader.next();
     }
 
+    snapshot->loads_.resize(snapshot->servers_.size(), Load());
+
+    std::lock_guard<std::mutex> lock(writersMutex_);
+    SnapshotPointer currentSnapshot = this->getSnapshot();
+
+    // servers kept by reload do not lose reported load until their next report
+    for(size_t i = 0; i < snapshot->servers_.size(); ++i)
+    {
+        std::unordered_map<uint16_t, size_t>::const_iterator it = currentSnapshot->indexes_.find(snapshot->servers_[i].code_);
+
+        if(it != currentSnapshot->indexes_.end())
+        {
+            snapshot->loads_[i] = currentSnapshot->loads_[it->second];
+            snapshot->servers_[i].load_ = currentSnapshot->servers_[it->second].load_;
+        }
+    }
+
+    this->publish(snapshot);
+    ++numberOfLoads_;
+
     return true;
 }
 
-const streaming::loginserver::GameserversInfoContainer &GameserversList::getServers() const
+void GameserversList::setLoadTimeout(std::chrono::milliseconds loadTimeout)
 {
-    return servers_;
+    loadTimeout_ = loadTimeout;
+}
+
+streaming::loginserver::GameserversInfoContainer GameserversList::getServers() const
+{
+    return this->getSnapshot()->servers_;
+}
+
+GameserversList::PayloadPointer GameserversList::getListResponse() const
+{
+    return this->getSnapshot()->listResponse_;
 }
 
 bool GameserversList::hasGameserver(uint16_t code) const
 {
-    return findGameserverInfo(code) != servers_.end();
+    return this->getSnapshot()->indexes_.count(code) > 0;
+}
+
+bool GameserversList::findGameserverInfo(uint16_t code, streaming::loginserver::GameserverInfo &info) const
+{
+    SnapshotPointer snapshot = this->getSnapshot();
+    std::unordered_map<uint16_t, size_t>::const_iterator it = snapshot->indexes_.find(code);
+
+    if(it == snapshot->indexes_.end())
+    {
+        return false;
+    }
+
+    info = snapshot->servers_[it->second];
+    return true;
 }
 
-const streaming::loginserver::GameserverInfo& GameserversList::getGameserverInfo(uint16_t code) const
+bool GameserversList::selectGameserver(uint16_t requestedCode, streaming::loginserver::GameserverInfo &info) const
 {
-    return *findGameserverInfo(code);
+    SnapshotPointer snapshot = this->getSnapshot();
+    std::unordered_map<uint16_t, size_t>::const_iterator it = snapshot->indexes_.find(requestedCode);
+
+    if(it == snapshot->indexes_.end())
+    {
+        return false;
+    }
+
+    Clock::time_point now = Clock::now();
+    const Load &requestedLoad = snapshot->loads_[it->second];
+
+    if(!this->isLoadKnown(requestedLoad, now) || !isFull(requestedLoad))
+    {
+        info = snapshot->servers_[it->second];
+        return true;
+    }
+
+    // only servers which reported free slots recently are taken as replacement
+    size_t selected = snapshot->servers_.size();
+
+    for(size_t i = 0; i < snapshot->servers_.size(); ++i)
+    {
+        const Load &load = snapshot->loads_[i];
+
+        if(!this->isLoadKnown(load, now) || isFull(load))
+        {
+            continue;
+        }
+
+        if(selected == snapshot->servers_.size() || isLessOccupied(load, snapshot->loads_[selected]))
+        {
+            selected = i;
+        }
+    }
+
+    if(selected == snapshot->servers_.size())
+    {
+        return false;
+    }
+
+    eMU_LOG(info) << "Gameserver code: " << requestedCode << " is full, redirecting to code: " << snapshot->servers_[selected].code_;
+
+    ++numberOfRedirections_;
+    info = snapshot->servers_[selected];
+
+    return true;
 }
 
-streaming::loginserver::GameserversInfoContainer::const_iterator GameserversList::findGameserverInfo(uint16_t code) const
+bool GameserversList::updateLoad(uint16_t code, uint32_t numberOfUsers, uint32_t maxNumberOfUsers)
 {
-    return std::find_if(servers_.begin(),
-                        servers_.end(),
-                        [code](const streaming::loginserver::GameserverInfo &info) { return info.code_ == code; });
+    std::lock_guard<std::mutex> lock(writersMutex_);
+
+    SnapshotPointer currentSnapshot = this->getSnapshot();
+    std::unordered_map<uint16_t, size_t>::const_iterator it = currentSnapshot->indexes_.find(code);
+
+    if(it == currentSnapshot->indexes_.end())
+    {
+        return false;
+    }
+
+    std::shared_ptr<Snapshot> snapshot = std::make_shared<Snapshot>(*currentSnapshot);
+    snapshot->loads_[it->second] = Load{numberOfUsers, maxNumberOfUsers, Clock::now()};
+
+    uint8_t load = calculateLoad(numberOfUsers, maxNumberOfUsers);
+
+    if(load == snapshot->servers_[it->second].load_)
+    {
+        // advertised list does not change, encoded response is shared with previous snapshot
+        std::atomic_store(&snapshot_, SnapshotPointer(snapshot));
+    }
+    else
+    {
+        snapshot->servers_[it->second].load_ = load;
+        this->publish(snapshot);
+    }
+
+    return true;
+}
+
+uint64_t GameserversList::getNumberOfLoads() const
+{
+    return numberOfLoads_;
+}
+
+uint64_t GameserversList::getNumberOfRedirections() const
+{
+    return numberOfRedirections_;
+}
+
+GameserversList::SnapshotPointer GameserversList::getSnapshot() const
+{
+    return std::atomic_load(&snapshot_);
+}
+
+void GameserversList::publish(const std::shared_ptr<Snapshot> &snapshot)
+{
+    snapshot->listResponse_ = encodeListResponse(snapshot->servers_);
+    std::atomic_store(&snapshot_, SnapshotPointer(snapshot));
+}
+
+bool GameserversList::isLoadKnown(const Load &load, Clock::time_point now) const
+{
+    if(load.reportTime_ == Clock::time_point())
+    {
+        return false;
+    }
+
+    return loadTimeout_.count() == 0 || now - load.reportTime_ <= loadTimeout_;
+}
+
+bool GameserversList::isFull(const Load &load)
+{
+    return load.numberOfUsers_ >= load.maxNumberOfUsers_;
+}
+
+bool GameserversList::isLessOccupied(const Load &left, const Load &right)
+{
+    return static_cast<uint64_t>(left.numberOfUsers_) * right.maxNumberOfUsers_ <
+           static_cast<uint64_t>(right.numberOfUsers_) * left.maxNumberOfUsers_;
+}
+
+uint8_t GameserversList::calculateLoad(uint32_t numberOfUsers, uint32_t maxNumberOfUsers)
+{
+    if(maxNumberOfUsers == 0)
+    {
+        return 100;
+    }
+
+    return static_cast<uint8_t>(std::min<uint64_t>(100, static_cast<uint64_t>(numberOfUsers) * 100 / maxNumberOfUsers));
+}
+
+GameserversList::PayloadPointer GameserversList::encodeListResponse(const streaming::loginserver::GameserversInfoContainer &servers)
+{
+    // names are converted to UTF-16 once per list instead of once per request
+    streaming::loginserver::GameserversListResponse response(servers);
+
+    return std::make_shared<const core::network::Payload>(response.getWriteStream().getPayload());
 }
 
 }
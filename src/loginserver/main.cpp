@@ -1,62 +1,142 @@
-#include <loginserver/main.hpp>
-#include <loginserver/context.hpp>
-#include <loginserver/protocol.hpp>
-#include <loginserver/dataserverProtocol.hpp>
-#include <loginserver/udpProtocol.hpp>
-#include <core/network/tcp/connectionsAcceptor.hpp>
-#include <core/common/xmlReader.hpp>
-#include <core/common/concurrency.hpp>
-#include <core/network/udp/connection.hpp>
-
-#include <boost/thread.hpp>
-#include <core/common/logging.hpp>
-#include <gflags/gflags.h>
-
-DEFINE_string(dataserver_host, "127.0.0.1", "Dataserver address");
-DEFINE_int32(dataserver_port, 55960, "Dataserver port");
-DEFINE_int32(max_users, 5, "Max number of users to connect");
-DEFINE_int32(port, 55557, "server listen port");
-DEFINE_int32(max_threads, 2, "max number of concurrent threads");
-
-
-int main(int argsCount, char *args[])
-{
-    google::ParseCommandLineFlags(&argsCount, &args, true);
-
-    eMU::loginserver::Context loginserverContext(FLAGS_max_users);
-    eMU::core::common::XmlReader xmlReader(eMU::core::common::XmlReader::getXmlFileContent("./data/gameserversList.xml"));
-
-    if(!loginserverContext.getGameserversList().initialize(xmlReader))
-    {
-        eMU_LOG(error) << "Initialization of gameservers list failed.";
-        return 1;
-    }
-
-    eMU::loginserver::DataserverProtocol dataserverProtocol(loginserverContext);
-
-    boost::asio::io_service ioService;
-    eMU::core::network::tcp::Connection::Pointer dataserverConnection(new eMU::core::network::tcp::Connection(ioService, dataserverProtocol));
-    if(!dataserverConnection->connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::address::from_string(FLAGS_dataserver_host),
-                                                                    FLAGS_dataserver_port)))
-    {
-        eMU_LOG(error) << "Connection to datserver failed. host: " << FLAGS_dataserver_host << ", port: " << FLAGS_dataserver_port;
-        return 1;
-    }
-
-    eMU::loginserver::UdpProtocol udpProtocol(loginserverContext);
-    eMU::core::network::udp::Connection::Pointer udpConnection(new eMU::core::network::udp::Connection(ioService, FLAGS_port, udpProtocol));
-    udpConnection->registerConnection();
-    udpConnection->queueReceiveFrom();
-
-    eMU::loginserver::Protocol loginserverProtocol(loginserverContext);
-    eMU::core::network::tcp::ConnectionsAcceptor connectionsAcceptor(ioService, FLAGS_port, loginserverProtocol);
-    connectionsAcceptor.queueAccept();
-
-    eMU::core::common::Concurrency concurrency(ioService, FLAGS_max_threads);
-    concurrency.start();
-    concurrency.join();
-
-    udpConnection->unregisterConnection();
-
-    return 0;
-}
+#include <loginserver/main.hpp>
+#include <loginserver/context.hpp>
+#include <loginserver/protocol.hpp>
+#include <loginserver/dataserverProtocol.hpp>
+#include <loginserver/udpProtocol.hpp>
+#include <core/network/tcp/connectionsAcceptor.hpp>
+#include <core/common/xmlReader.hpp>
+#include <core/common/concurrency.hpp>
+#include <core/metrics/exporter.hpp>
+#include <core/network/udp/connection.hpp>
+
+#include <boost/thread.hpp>
+#include <csignal>
+#include <core/common/logging.hpp>
+#include <gflags/gflags.h>
+
+DEFINE_string(dataserver_host, "127.0.0.1", "Dataserver address");
+DEFINE_int32(dataserver_port, 55960, "Dataserver port");
+DEFINE_int32(max_users, 5, "Max number of users to connect");
+DEFINE_int32(port, 55557, "server listen port");
+DEFINE_int32(max_threads, 2, "max number of concurrent threads");
+DEFINE_bool(io_service_per_thread, false, "run separate event loop on each thread and spread accepted connections across them");
+DEFINE_int32(acceptors, 1, "number of acceptors listening on server port, more than one enables SO_REUSEPORT");
+DEFINE_int32(pending_accepts, 1, "number of outstanding accepts queued by each acceptor");
+DEFINE_int32(write_queue_high_watermark, 65536, "connection write queue size which notifies protocol about congestion");
+DEFINE_int32(write_queue_low_watermark, 16384, "connection write queue size which ends congestion");
+DEFINE_int32(metrics_port, 0, "loopback port serving metrics in Prometheus text format, 0 disables");
+DEFINE_string(gameservers_list, "./data/gameserversList.xml", "gameservers list file, reloaded on SIGHUP");
+DEFINE_int32(gameserver_load_timeout, 15, "seconds after which load last reported by gameserver is treated as unknown");
+
+
+int main(int argsCount, char *args[])
+{
+    google::ParseCommandLineFlags(&argsCount, &args, true);
+
+    eMU::loginserver::Context loginserverContext(FLAGS_max_users);
+    eMU::core::common::XmlReader xmlReader(eMU::core::common::XmlReader::getXmlFileContent(FLAGS_gameservers_list));
+    eMU::loginserver::GameserversList &gameserversList = loginserverContext.getGameserversList();
+
+    if(!gameserversList.initialize(xmlReader))
+    {
+        eMU_LOG(error) << "Initialization of gameservers list failed.";
+        return 1;
+    }
+
+    gameserversList.setLoadTimeout(std::chrono::seconds(FLAGS_gameserver_load_timeout));
+
+    eMU::loginserver::DataserverProtocol dataserverProtocol(loginserverContext);
+
+    boost::asio::io_service ioService;
+    eMU::core::network::tcp::Connection::Pointer dataserverConnection(new eMU::core::network::tcp::Connection(ioService, dataserverProtocol));
+    if(!dataserverConnection->connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::address::from_string(FLAGS_dataserver_host),
+                                                                    FLAGS_dataserver_port)))
+    {
+        eMU_LOG(error) << "Connection to datserver failed. host: " << FLAGS_dataserver_host << ", port: " << FLAGS_dataserver_port;
+        return 1;
+    }
+
+    eMU::loginserver::UdpProtocol udpProtocol(loginserverContext);
+    eMU::core::network::udp::Connection::Pointer udpConnection(new eMU::core::network::udp::Connection(ioService, FLAGS_port, udpProtocol));
+    udpConnection->registerConnection();
+    udpConnection->queueReceiveFrom();
+
+    eMU::loginserver::Protocol loginserverProtocol(loginserverContext);
+    loginserverProtocol.setWriteQueueWatermarks(FLAGS_write_queue_high_watermark, FLAGS_write_queue_low_watermark);
+
+    eMU::core::common::Concurrency::Model concurrencyModel = FLAGS_io_service_per_thread ? eMU::core::common::Concurrency::Model::IO_SERVICE_PER_THREAD
+                                                                                         : eMU::core::common::Concurrency::Model::SHARED_IO_SERVICE;
+    eMU::core::common::Concurrency concurrency(ioService, FLAGS_max_threads, concurrencyModel);
+
+    std::vector<std::unique_ptr<eMU::core::network::tcp::ConnectionsAcceptor>> connectionsAcceptors;
+    for(size_t i = 0; i < static_cast<size_t>(FLAGS_acceptors); ++i)
+    {
+        boost::asio::io_service &acceptorIoService = concurrency.getIoService(i % concurrency.getNumberOfIoServices());
+        connectionsAcceptors.push_back(std::unique_ptr<eMU::core::network::tcp::ConnectionsAcceptor>(
+            new eMU::core::network::tcp::ConnectionsAcceptor(acceptorIoService, FLAGS_port, loginserverProtocol, FLAGS_acceptors > 1, FLAGS_pending_accepts)));
+
+        if(FLAGS_io_service_per_thread && static_cast<size_t>(FLAGS_acceptors) < concurrency.getNumberOfIoServices())
+        {
+            connectionsAcceptors.back()->setIoServiceSelector(std::bind(&eMU::core::common::Concurrency::getNextIoService, &concurrency));
+        }
+
+        connectionsAcceptors.back()->queueAccept();
+    }
+
+    eMU::core::metrics::Registry::getInstance().addGaugeCallback("emu_users", "Connected users.",
+                                                                  [&loginserverContext]() { return loginserverContext.getUsersFactory().size(); });
+
+    std::unique_ptr<eMU::core::metrics::Exporter> metricsExporter;
+    if(FLAGS_metrics_port > 0)
+    {
+        metricsExporter.reset(new eMU::core::metrics::Exporter(ioService, FLAGS_metrics_port, eMU::core::metrics::Registry::getInstance()));
+        metricsExporter->queueAccept();
+    }
+
+    boost::asio::signal_set reloadSignals(ioService, SIGHUP);
+    std::function<void(const boost::system::error_code&, int)> reloadGameserversList;
+    reloadGameserversList = [&](const boost::system::error_code &errorCode, int)
+    {
+        if(errorCode)
+        {
+            return;
+        }
+
+        try
+        {
+            eMU::core::common::XmlReader reloadedXmlReader(eMU::core::common::XmlReader::getXmlFileContent(FLAGS_gameservers_list));
+
+            if(gameserversList.initialize(reloadedXmlReader))
+            {
+                eMU_LOG(info) << "Gameservers list reloaded, number of servers: " << gameserversList.getServers().size();
+            }
+            else
+            {
+                eMU_LOG(error) << "Reload of gameservers list failed, previous list is kept.";
+            }
+        }
+        catch(const std::exception &exception)
+        {
+            eMU_LOG(error) << "Reload of gameservers list failed, previous list is kept. Error: " << exception.what();
+        }
+
+        reloadSignals.async_wait(reloadGameserversList);
+    };
+    reloadSignals.async_wait(reloadGameserversList);
+
+    concurrency.start();
+    concurrency.join();
+
+    for(size_t i = 0; i < connectionsAcceptors.size(); ++i)
+    {
+        eMU_LOG(info) << "Acceptor " << i << ", accepted connections: " << connectionsAcceptors[i]->getNumberOfAcceptedConnections()
+            << ", accept errors: " << connectionsAcceptors[i]->getNumberOfAcceptErrors();
+    }
+
+    eMU_LOG(info) << "Gameservers list loads: " << gameserversList.getNumberOfLoads()
+        << ", redirections from full gameservers: " << gameserversList.getNumberOfRedirections();
+
+    udpConnection->unregisterConnection();
+
+    return 0;
+}
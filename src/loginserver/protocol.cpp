@@ -1,50 +1,46 @@
-#include <loginserver/protocol.hpp>
-#include <loginserver/transactions/gameserverDetailsRequest.hpp>
-#include <loginserver/transactions/gameserversListRequest.hpp>
-#include <loginserver/transactions/loginRequest.hpp>
-
-#include <streaming/loginserver/streamIds.hpp>
-
-#include <core/common/logging.hpp>
-
-namespace eMU
-{
-namespace loginserver
-{
-
-Protocol::Protocol(Context &context):
-    protocols::Server<User>(context),
-    context_(context) {}
-
-bool Protocol::handleReadStream(User &user, const streaming::ReadStream &stream)
-{
-    uint16_t streamId = stream.getId();
-
-    if(streamId == streaming::loginserver::streamIds::kLoginRequest)
-    {
-        streaming::loginserver::LoginRequest request(stream);
-        transactions::LoginRequest(user, context_.getClientConnection(), request).handle();
-
-        return true;
-    }
-    else if(streamId == streaming::loginserver::streamIds::kGameserversListRequest)
-    {
-        streaming::loginserver::GameserversListRequest request(stream);
-        transactions::GameserversListRequest(user, context_.getGameserversList(), request).handle();
-
-        return true;
-    }
-    else if(streamId == streaming::loginserver::streamIds::kGameserverDetailsRequest)
-    {
-        streaming::loginserver::GameserverDetailsRequest request(stream);
-        transactions::GameserverDetailsRequest(user, context_.getGameserversList(), context_.getUdpConnection(), request).handle();
-
-        return true;
-    }
-
-    return false;
-}
-
-
-}
-}
+#include <loginserver/protocol.hpp>
+#include <loginserver/transactions/gameserverDetailsRequest.hpp>
+#include <loginserver/transactions/gameserversListRequest.hpp>
+#include <loginserver/transactions/loginRequest.hpp>
+
+#include <streaming/loginserver/streamIds.hpp>
+
+#include <core/common/logging.hpp>
+
+namespace eMU
+{
+namespace loginserver
+{
+
+Protocol::Protocol(Context &context):
+    protocols::Server<User>(context, streaming::loginserver::streamIds::kStreamIdBase),
+    context_(context)
+{
+    this->registerHandler(streaming::loginserver::streamIds::kLoginRequest,
+                          [this](User &user, const streaming::ReadStreamView &stream) { this->handleLoginRequest(user, stream); });
+    this->registerHandler(streaming::loginserver::streamIds::kGameserversListRequest,
+                          [this](User &user, const streaming::ReadStreamView &stream) { this->handleGameserversListRequest(user, stream); });
+    this->registerHandler(streaming::loginserver::streamIds::kGameserverDetailsRequest,
+                          [this](User &user, const streaming::ReadStreamView &stream) { this->handleGameserverDetailsRequest(user, stream); });
+}
+
+void Protocol::handleLoginRequest(User &user, const streaming::ReadStreamView &stream)
+{
+    streaming::loginserver::LoginRequest request(stream);
+    transactions::LoginRequest(user, context_.getClientConnection(), request).handle();
+}
+
+void Protocol::handleGameserversListRequest(User &user, const streaming::ReadStreamView &stream)
+{
+    streaming::loginserver::GameserversListRequest request(stream);
+    transactions::GameserversListRequest(user, context_.getGameserversList(), request).handle();
+}
+
+void Protocol::handleGameserverDetailsRequest(User &user, const streaming::ReadStreamView &stream)
+{
+    streaming::loginserver::GameserverDetailsRequest request(stream);
+    transactions::GameserverDetailsRequest(user, context_.getGameserversList(), context_.getUdpConnection(), request).handle();
+}
+
+}
+}
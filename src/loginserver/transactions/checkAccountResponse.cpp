@@ -12,7 +12,7 @@ namespace loginserver
 namespace transactions
 {
 
-CheckAccountResponse::CheckAccountResponse(core::common::Factory<User> &usersFactory,
+CheckAccountResponse::CheckAccountResponse(core::network::tcp::UsersFactory<User> &usersFactory,
                                            const streaming::dataserver::CheckAccountResponse &response):
     usersFactory_(usersFactory),
     response_(response) {}
@@ -29,7 +29,15 @@ void GameserverDetailsRequest::handleValid()
 {
     eMU_LOG(info) << "hash: " << user_.getHash() << ", gameserverCode: " << request_.getGameserverCode();
 
-    const streaming::loginserver::GameserverInfo &gameserverInfo = gameserversList_.getGameserverInfo(request_.getGameserverCode());
+    streaming::loginserver::GameserverInfo gameserverInfo = {};
+
+    if(!gameserversList_.selectGameserver(request_.getGameserverCode(), gameserverInfo))
+    {
+        eMU_LOG(warning) << "hash: " << user_.getHash() << ", no gameserver with free slots, requested gameserverCode: " << request_.getGameserverCode();
+
+        user_.getConnection().disconnect();
+        return;
+    }
 
     streaming::gameserver::RegisterUserRequest registerUserRequest({user_.getHash(), user_.getAccountId()});
     udpConnection_->sendTo(boost::asio::ip::udp::endpoint(boost::asio::ip::address::from_string(gameserverInfo.address_),
@@ -1,5 +1,4 @@
 #include <loginserver/transactions/gameserversListRequest.hpp>
-#include <streaming/loginserver/gameserversListResponse.hpp>
 
 #include <core/common/logging.hpp>
 
@@ -25,9 +24,9 @@ bool GameserversListRequest::isValid() const
 void GameserversListRequest::handleValid()
 {
     eMU_LOG(info) << "hash: " << user_.getHash();
-    streaming::loginserver::GameserversListResponse response(gameserversList_.getServers());
 
-    user_.getConnection().send(response.getWriteStream().getPayload());
+    GameserversList::PayloadPointer listResponse = gameserversList_.getListResponse();
+    user_.getConnection().send(*listResponse);
 }
 
 }
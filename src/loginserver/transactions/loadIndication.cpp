@@ -0,0 +1,37 @@
+#include <loginserver/transactions/loadIndication.hpp>
+
+#include <core/common/logging.hpp>
+
+namespace eMU
+{
+namespace loginserver
+{
+namespace transactions
+{
+
+LoadIndication::LoadIndication(GameserversList &gameserversList,
+                               const streaming::gameserver::LoadIndication &indication):
+    gameserversList_(gameserversList),
+    indication_(indication) {}
+
+bool LoadIndication::isValid() const
+{
+    return gameserversList_.hasGameserver(indication_.getGameserverCode());
+}
+
+void LoadIndication::handleValid()
+{
+    eMU_LOG(debug) << "gameserverCode: " << indication_.getGameserverCode()
+        << ", users: " << indication_.getNumberOfUsers() << "/" << indication_.getMaxNumberOfUsers();
+
+    gameserversList_.updateLoad(indication_.getGameserverCode(), indication_.getNumberOfUsers(), indication_.getMaxNumberOfUsers());
+}
+
+void LoadIndication::handleInvalid()
+{
+    eMU_LOG(warning) << "Load reported by gameserver missing in list, gameserverCode: " << indication_.getGameserverCode();
+}
+
+}
+}
+}
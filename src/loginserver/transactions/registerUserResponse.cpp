@@ -10,7 +10,7 @@ namespace loginserver
 namespace transactions
 {
 
-RegisterUserResponse::RegisterUserResponse(core::common::Factory<User> &usersFactory,
+RegisterUserResponse::RegisterUserResponse(core::network::tcp::UsersFactory<User> &usersFactory,
                                            GameserversList &gameserversList,
                                            const streaming::gameserver::RegisterUserResponse &response):
     usersFactory_(usersFactory),
@@ -37,7 +37,15 @@ void RegisterUserResponse::handleValid()
     {
         eMU_LOG(info) << "hash: " << user.getHash() << ", registered to gameserver, code: " << response_.getGameserverCode();
 
-        const streaming::loginserver::GameserverInfo &gameserverInfo = gameserversList_.getGameserverInfo(response_.getGameserverCode());
+        streaming::loginserver::GameserverInfo gameserverInfo = {};
+
+        if(!gameserversList_.findGameserverInfo(response_.getGameserverCode(), gameserverInfo))
+        {
+            eMU_LOG(warning) << "hash: " << user.getHash() << ", gameserver removed from list during registration, code: " << response_.getGameserverCode();
+
+            user.getConnection().disconnect();
+            return;
+        }
 
         eMU_LOG(info) << "hash: " << user.getHash() << ", sending gameserver details response, address: " << gameserverInfo.address_
             << ", port: " << gameserverInfo.port_;
@@ -1,29 +1,38 @@
-#include <loginserver/udpProtocol.hpp>
-#include <loginserver/transactions/registerUserResponse.hpp>
-#include <streaming/gameserver/streamIds.hpp>
-#include <streaming/gameserver/registerUserResponse.hpp>
-
-#include <core/common/logging.hpp>
-
-namespace eMU
-{
-namespace loginserver
-{
-
-UdpProtocol::UdpProtocol(Context &context):
-    protocols::Udp(context),
-    context_(context) {}
-
-void UdpProtocol::handleReadStream(const streaming::ReadStream &stream, const boost::asio::ip::udp::endpoint &senderEndpoint)
-{
-    uint16_t streamId = stream.getId();
-
-    if(streamId == streaming::gameserver::streamIds::kRegisterUserResponse)
-    {
-        streaming::gameserver::RegisterUserResponse response(stream);
-        transactions::RegisterUserResponse(context_.getUsersFactory(), context_.getGameserversList(), response).handle();
-    }
-}
-
-}
-}
+#include <loginserver/udpProtocol.hpp>
+#include <loginserver/transactions/registerUserResponse.hpp>
+#include <loginserver/transactions/loadIndication.hpp>
+#include <streaming/gameserver/streamIds.hpp>
+#include <streaming/gameserver/registerUserResponse.hpp>
+#include <streaming/gameserver/loadIndication.hpp>
+
+#include <core/common/logging.hpp>
+
+namespace eMU
+{
+namespace loginserver
+{
+
+UdpProtocol::UdpProtocol(Context &context):
+    protocols::Udp(context, streaming::gameserver::streamIds::kStreamIdBase),
+    context_(context)
+{
+    this->registerHandler(streaming::gameserver::streamIds::kRegisterUserResponse,
+                          [this](const streaming::ReadStreamView &stream, const boost::asio::ip::udp::endpoint&) { this->handleRegisterUserResponse(stream); });
+    this->registerHandler(streaming::gameserver::streamIds::kLoadIndication,
+                          [this](const streaming::ReadStreamView &stream, const boost::asio::ip::udp::endpoint&) { this->handleLoadIndication(stream); });
+}
+
+void UdpProtocol::handleRegisterUserResponse(const streaming::ReadStreamView &stream)
+{
+    streaming::gameserver::RegisterUserResponse response(stream);
+    transactions::RegisterUserResponse(context_.getUsersFactory(), context_.getGameserversList(), response).handle();
+}
+
+void UdpProtocol::handleLoadIndication(const streaming::ReadStreamView &stream)
+{
+    streaming::gameserver::LoadIndication indication(stream);
+    transactions::LoadIndication(context_.getGameserversList(), indication).handle();
+}
+
+}
+}
@@ -1,51 +1,62 @@
-#include <protocols/client.hpp>
-#include <streaming/readStreamsExtractor.hpp>
-
-#include <core/common/logging.hpp>
-
-namespace eMU
-{
-namespace protocols
-{
-
-Client::Client(contexts::Client &context):
-    context_(context) {}
-
-bool Client::attach(core::network::tcp::Connection::Pointer connection)
-{
-    context_.setClientConnection(connection);
-
-    return true;
-}
-
-void Client::detach(core::network::tcp::Connection::Pointer)
-{
-    eMU_LOG(info) << "Client connection closed.";
-
-    context_.setClientConnection(nullptr);
-}
-
-bool Client::dispatch(core::network::tcp::Connection::Pointer connection)
-{
-    streaming::ReadStreamsExtractor readStreamsExtractor(connection->getReadPayload());
-    if(!readStreamsExtractor.extract())
-    {
-        eMU_LOG(error) << "Streams extraction failed.";
-        return false;
-    }
-
-    for(const auto &stream : readStreamsExtractor.getStreams())
-    {
-        eMU_LOG(info) << "Client protocol, received stream, id: " << stream.getId();
-
-        if(!this->handleReadStream(stream))
-        {
-            return false;
-        }
-    }
-
-    return true;
-}
-
-}
-}
+#include <protocols/client.hpp>
+#include <streaming/readStreamsExtractor.hpp>
+
+#include <core/common/logging.hpp>
+
+namespace eMU
+{
+namespace protocols
+{
+
+Client::Client(contexts::Client &context, uint16_t streamIdBase):
+    context_(context),
+    dispatcher_(streamIdBase) {}
+
+bool Client::attach(core::network::tcp::Connection::Pointer connection)
+{
+    context_.setClientConnection(connection);
+
+    return true;
+}
+
+void Client::detach(core::network::tcp::Connection::Pointer)
+{
+    eMU_LOG(info) << "Client connection closed.";
+
+    context_.setClientConnection(nullptr);
+}
+
+bool Client::dispatch(core::network::tcp::Connection::Pointer connection)
+{
+    streaming::ReadStreamsExtractor readStreamsExtractor(connection->getReadPayload());
+    if(!readStreamsExtractor.extract())
+    {
+        eMU_LOG(error) << "Streams extraction failed.";
+        return false;
+    }
+
+    for(const auto &stream : readStreamsExtractor.getStreams())
+    {
+        eMU_LOG(debug) << "Client protocol, received stream, id: " << stream.getId();
+
+        if(!dispatcher_.dispatch(stream.getId(), stream))
+        {
+            eMU_LOG(warning) << "Client protocol, unknown stream id: " << stream.getId();
+        }
+    }
+
+    return true;
+}
+
+const Client::Dispatcher& Client::getDispatcher() const
+{
+    return dispatcher_;
+}
+
+void Client::registerHandler(uint16_t streamId, const Dispatcher::Handler &handler)
+{
+    dispatcher_.registerHandler(streamId, handler);
+}
+
+}
+}
@@ -1,12 +1,12 @@
-#include <protocols/contexts/server.hpp>
-
-namespace eMU
-{
-namespace protocols
-{
-namespace contexts
-{
-
-}
-}
-}
+#include <protocols/contexts/server.hpp>
+
+namespace eMU
+{
+namespace protocols
+{
+namespace contexts
+{
+
+}
+}
+}
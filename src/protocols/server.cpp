@@ -1,9 +1,9 @@
-#include <protocols/server.hpp>
-
-namespace eMU
-{
-namespace protocols
-{
-
-}
-}
+#include <protocols/server.hpp>
+
+namespace eMU
+{
+namespace protocols
+{
+
+}
+}
@@ -1,41 +1,56 @@
-#include <protocols/udp.hpp>
-#include <streaming/readStreamsExtractor.hpp>
-
-#include <core/common/logging.hpp>
-
-namespace eMU
-{
-namespace protocols
-{
-
-Udp::Udp(contexts::Udp &context):
-    context_(context) {}
-
-void Udp::attach(core::network::udp::Connection::Pointer connection)
-{
-    context_.setUdpConnection(connection);
-}
-
-void Udp::dispatch(core::network::udp::Connection::Pointer connection, const boost::asio::ip::udp::endpoint &senderEndpoint)
-{
-    streaming::ReadStreamsExtractor readStreamsExtractor(connection->getReadPayload());
-    if(!readStreamsExtractor.extract())
-    {
-        eMU_LOG(error) << "Streams extraction failed.";
-        return;
-    }
-
-    for(const auto &stream : readStreamsExtractor.getStreams())
-    {
-        eMU_LOG(info) << "Udp protocol, received stream id: " << stream.getId();
-        this->handleReadStream(stream, senderEndpoint);
-    }
-}
-
-void Udp::detach(core::network::udp::Connection::Pointer)
-{
-    context_.setUdpConnection(nullptr);
-}
-
-}
-}
+#include <protocols/udp.hpp>
+#include <streaming/readStreamsExtractor.hpp>
+
+#include <core/common/logging.hpp>
+
+namespace eMU
+{
+namespace protocols
+{
+
+Udp::Udp(contexts::Udp &context, uint16_t streamIdBase):
+    context_(context),
+    dispatcher_(streamIdBase) {}
+
+void Udp::attach(core::network::udp::Connection::Pointer connection)
+{
+    context_.setUdpConnection(connection);
+}
+
+void Udp::dispatch(core::network::udp::Connection::Pointer connection, const boost::asio::ip::udp::endpoint &senderEndpoint)
+{
+    streaming::ReadStreamsExtractor readStreamsExtractor(connection->getReadPayload());
+    if(!readStreamsExtractor.extract())
+    {
+        eMU_LOG(error) << "Streams extraction failed.";
+        return;
+    }
+
+    for(const auto &stream : readStreamsExtractor.getStreams())
+    {
+        eMU_LOG(debug) << "Udp protocol, received stream id: " << stream.getId();
+
+        if(!dispatcher_.dispatch(stream.getId(), stream, senderEndpoint))
+        {
+            eMU_LOG(warning) << "Udp protocol, unknown stream id: " << stream.getId();
+        }
+    }
+}
+
+void Udp::detach(core::network::udp::Connection::Pointer)
+{
+    context_.setUdpConnection(nullptr);
+}
+
+const Udp::Dispatcher& Udp::getDispatcher() const
+{
+    return dispatcher_;
+}
+
+void Udp::registerHandler(uint16_t streamId, const Dispatcher::Handler &handler)
+{
+    dispatcher_.registerHandler(streamId, handler);
+}
+
+}
+}
@@ -1,42 +1,48 @@
-#include <streaming/dataserver/characterCreateResponse.hpp>
-#include <streaming/dataserver/streamIds.hpp>
-
-namespace eMU
-{
-namespace streaming
-{
-namespace dataserver
-{
-
-CharacterCreateResponse::CharacterCreateResponse(const ReadStream &readStream):
-    readStream_(readStream)
-{
-    userHash_ = readStream_.readNext<core::network::tcp::NetworkUser::Hash>();
-    result_ = readStream_.readNext<CharacterCreateResult>();
-}
-
-CharacterCreateResponse::CharacterCreateResponse(core::network::tcp::NetworkUser::Hash userHash, CharacterCreateResult result):
-    writeStream_(streamIds::kCharacterCreateResponse)
-{
-    writeStream_.writeNext<core::network::tcp::NetworkUser::Hash>(userHash);
-    writeStream_.writeNext<CharacterCreateResult>(result);
-}
-
-const WriteStream& CharacterCreateResponse::getWriteStream() const
-{
-    return writeStream_;
-}
-
-core::network::tcp::NetworkUser::Hash CharacterCreateResponse::getUserHash() const
-{
-    return userHash_;
-}
-
-CharacterCreateResult CharacterCreateResponse::getResult() const
-{
-    return result_;
-}
-
-}
-}
-}
+#include <streaming/dataserver/characterCreateResponse.hpp>
+#include <streaming/dataserver/streamIds.hpp>
+#include <streaming/schema.hpp>
+
+namespace eMU
+{
+namespace streaming
+{
+namespace dataserver
+{
+
+namespace
+{
+
+typedef schema::Message<schema::Value<core::network::tcp::NetworkUser::Hash>, schema::Value<CharacterCreateResult>> Layout;
+
+}
+
+CharacterCreateResponse::CharacterCreateResponse(const ReadStreamView &readStream):
+    readStream_(readStream)
+{
+    Layout::decode(readStream_, userHash_, result_);
+}
+
+CharacterCreateResponse::CharacterCreateResponse(core::network::tcp::NetworkUser::Hash userHash, CharacterCreateResult result):
+    writeStream_(streamIds::kCharacterCreateResponse)
+{
+    Layout::encode(writeStream_, userHash, result);
+}
+
+const WriteStream& CharacterCreateResponse::getWriteStream() const
+{
+    return writeStream_;
+}
+
+core::network::tcp::NetworkUser::Hash CharacterCreateResponse::getUserHash() const
+{
+    return userHash_;
+}
+
+CharacterCreateResult CharacterCreateResponse::getResult() const
+{
+    return result_;
+}
+
+}
+}
+}
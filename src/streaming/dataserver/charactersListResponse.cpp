@@ -1,68 +1,80 @@
-#include <streaming/dataserver/charactersListResponse.hpp>
-#include <streaming/dataserver/streamIds.hpp>
-
-namespace eMU
-{
-namespace streaming
-{
-namespace dataserver
-{
-
-CharactersListResponse::CharactersListResponse(const ReadStream &readStream):
-    readStream_(readStream)
-{
-    userHash_ = readStream_.readNext<core::network::tcp::NetworkUser::Hash>();
-
-    uint8_t charactersCount = readStream_.readNext<uint8_t>();
-
-    for(uint8_t i = 0; i < charactersCount; ++i)
-    {
-        uint32_t characterNameLength = readStream_.readNext<uint32_t>();
-
-        common::CharacterListInfo characterListInfo;
-        characterListInfo.name_ = readStream_.readNextString(characterNameLength);
-        characterListInfo.hairColor_ = readStream_.readNext<uint8_t>();
-        characterListInfo.hairType_ = readStream_.readNext<uint8_t>();
-        characterListInfo.level_ = readStream_.readNext<uint8_t>();
-        characterListInfo.race_ = readStream_.readNext<uint8_t>();
-        characterListInfo.tutorialState_ = readStream_.readNext<uint16_t>();
-        characters_.push_back(characterListInfo);
-    }
-}
-
-CharactersListResponse::CharactersListResponse(core::network::tcp::NetworkUser::Hash userHash, const common::CharacterInfoContainer &characters):
-    writeStream_(streamIds::kCharactersListResponse)
-{
-    writeStream_.writeNext<core::network::tcp::NetworkUser::Hash>(userHash);
-    writeStream_.writeNext<uint8_t>(characters.size());
-
-    for(const auto &characterListInfo : characters)
-    {
-        writeStream_.writeNext<uint32_t>(characterListInfo.name_.length());
-        writeStream_.writeNextString(characterListInfo.name_);
-        writeStream_.writeNext<uint8_t>(characterListInfo.hairColor_);
-        writeStream_.writeNext<uint8_t>(characterListInfo.hairType_);
-        writeStream_.writeNext<uint8_t>(characterListInfo.level_);
-        writeStream_.writeNext<uint8_t>(characterListInfo.race_);
-        writeStream_.writeNext<uint16_t>(characterListInfo.tutorialState_);
-    }
-}
-
-const WriteStream& CharactersListResponse::getWriteStream() const
-{
-    return writeStream_;
-}
-
-core::network::tcp::NetworkUser::Hash CharactersListResponse::getUserHash() const
-{
-    return userHash_;
-}
-
-const common::CharacterInfoContainer& CharactersListResponse::getCharacters() const
-{
-    return characters_;
-}
-
-}
-}
-}
+#include <streaming/dataserver/charactersListResponse.hpp>
+#include <streaming/dataserver/streamIds.hpp>
+#include <streaming/schema.hpp>
+
+namespace eMU
+{
+namespace streaming
+{
+namespace dataserver
+{
+
+namespace
+{
+
+typedef schema::Message<schema::Value<core::network::tcp::NetworkUser::Hash>, schema::Value<uint8_t>> HeaderLayout;
+
+typedef schema::Message<schema::String<uint32_t>,
+                        schema::Value<uint8_t>,
+                        schema::Value<uint8_t>,
+                        schema::Value<uint8_t>,
+                        schema::Value<uint8_t>,
+                        schema::Value<uint16_t>> CharacterLayout;
+
+}
+
+CharactersListResponse::CharactersListResponse(const ReadStreamView &readStream):
+    readStream_(readStream)
+{
+    uint8_t charactersCount = 0;
+    HeaderLayout::decode(readStream_, userHash_, charactersCount);
+
+    characters_.resize(charactersCount);
+
+    for(auto &characterListInfo : characters_)
+    {
+        CharacterLayout::decode(readStream_,
+                                characterListInfo.name_,
+                                characterListInfo.hairColor_,
+                                characterListInfo.hairType_,
+                                characterListInfo.level_,
+                                characterListInfo.race_,
+                                characterListInfo.tutorialState_);
+    }
+}
+
+CharactersListResponse::CharactersListResponse(core::network::tcp::NetworkUser::Hash userHash, const common::CharacterInfoContainer &characters):
+    writeStream_(streamIds::kCharactersListResponse)
+{
+    HeaderLayout::encode(writeStream_, userHash, characters.size());
+
+    for(const auto &characterListInfo : characters)
+    {
+        CharacterLayout::encode(writeStream_,
+                                characterListInfo.name_,
+                                characterListInfo.hairColor_,
+                                characterListInfo.hairType_,
+                                characterListInfo.level_,
+                                characterListInfo.race_,
+                                characterListInfo.tutorialState_);
+    }
+}
+
+const WriteStream& CharactersListResponse::getWriteStream() const
+{
+    return writeStream_;
+}
+
+core::network::tcp::NetworkUser::Hash CharactersListResponse::getUserHash() const
+{
+    return userHash_;
+}
+
+const common::CharacterInfoContainer& CharactersListResponse::getCharacters() const
+{
+    return characters_;
+}
+
+}
+}
+}
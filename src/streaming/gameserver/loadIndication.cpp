@@ -0,0 +1,53 @@
+#include <streaming/gameserver/loadIndication.hpp>
+#include <streaming/gameserver/streamIds.hpp>
+#include <streaming/schema.hpp>
+
+namespace eMU
+{
+namespace streaming
+{
+namespace gameserver
+{
+
+namespace
+{
+
+typedef schema::Message<schema::Value<uint16_t>, schema::Value<uint32_t>, schema::Value<uint32_t>> Layout;
+
+}
+
+LoadIndication::LoadIndication(const ReadStreamView &readStream):
+    readStream_(readStream)
+{
+    Layout::decode(readStream_, gameserverCode_, numberOfUsers_, maxNumberOfUsers_);
+}
+
+LoadIndication::LoadIndication(uint16_t gameserverCode, uint32_t numberOfUsers, uint32_t maxNumberOfUsers):
+    writeStream_(streamIds::kLoadIndication)
+{
+    Layout::encode(writeStream_, gameserverCode, numberOfUsers, maxNumberOfUsers);
+}
+
+const WriteStream& LoadIndication::getWriteStream() const
+{
+    return writeStream_;
+}
+
+uint16_t LoadIndication::getGameserverCode() const
+{
+    return gameserverCode_;
+}
+
+uint32_t LoadIndication::getNumberOfUsers() const
+{
+    return numberOfUsers_;
+}
+
+uint32_t LoadIndication::getMaxNumberOfUsers() const
+{
+    return maxNumberOfUsers_;
+}
+
+}
+}
+}
@@ -1,43 +1,43 @@
-#include <streaming/gameserver/registerUserRequest.hpp>
-#include <streaming/gameserver/streamIds.hpp>
-
-#include <boost/locale.hpp>
-
-namespace eMU
-{
-namespace streaming
-{
-namespace gameserver
-{
-
-RegisterUserRequest::RegisterUserRequest(const ReadStream &readStream):
-    readStream_(readStream)
-{
-    userInfo_.userHash_ = readStream_.readNext<core::network::tcp::NetworkUser::Hash>();
-
-    uint32_t accountIdLength = readStream_.readNext<uint32_t>();
-    userInfo_.accountId_ = readStream_.readNextString(accountIdLength);
-}
-
-RegisterUserRequest::RegisterUserRequest(const UserRegistrationInfo &userInfo):
-    writeStream_(streamIds::kRegisterUserRequest)
-{
-    writeStream_.writeNext<core::network::tcp::NetworkUser::Hash>(userInfo.userHash_);
-
-    writeStream_.writeNext<uint32_t>(userInfo.accountId_.length());
-    writeStream_.writeNextString(userInfo.accountId_);
-}
-
-const WriteStream& RegisterUserRequest::getWriteStream() const
-{
-    return writeStream_;
-}
-
-const UserRegistrationInfo& RegisterUserRequest::getUserRegistrationInfo() const
-{
-    return userInfo_;
-}
-
-}
-}
-}
+#include <streaming/gameserver/registerUserRequest.hpp>
+#include <streaming/gameserver/streamIds.hpp>
+#include <streaming/schema.hpp>
+
+namespace eMU
+{
+namespace streaming
+{
+namespace gameserver
+{
+
+namespace
+{
+
+typedef schema::Message<schema::Value<core::network::tcp::NetworkUser::Hash>, schema::String<uint32_t>> Layout;
+
+}
+
+RegisterUserRequest::RegisterUserRequest(const ReadStreamView &readStream):
+    readStream_(readStream)
+{
+    Layout::decode(readStream_, userInfo_.userHash_, userInfo_.accountId_);
+}
+
+RegisterUserRequest::RegisterUserRequest(const UserRegistrationInfo &userInfo):
+    writeStream_(streamIds::kRegisterUserRequest)
+{
+    Layout::encode(writeStream_, userInfo.userHash_, userInfo.accountId_);
+}
+
+const WriteStream& RegisterUserRequest::getWriteStream() const
+{
+    return writeStream_;
+}
+
+const UserRegistrationInfo& RegisterUserRequest::getUserRegistrationInfo() const
+{
+    return userInfo_;
+}
+
+}
+}
+}
@@ -1,64 +1,85 @@
-#include <streaming/readStream.hpp>
-
-#include <string.h>
-
-namespace eMU
-{
-namespace streaming
-{
-
-ReadStream::ReadStream(const core::network::Payload &payload):
-    payload_(payload),
-    currentOffset_(6)
-{
-}
-
-ReadStream::ReadStream():
-    currentOffset_(0) {}
-
-uint16_t ReadStream::getId() const
-{
-    return this->readFromOffset<uint16_t>(4);
-}
-
-size_t ReadStream::getSize() const
-{
-    return payload_.getSize();
-}
-
-std::string ReadStream::readNextString(size_t length)
-{
-    std::string value;
-
-    for(size_t i = 0; i < length; ++i)
-    {
-        std::string::value_type c = this->readNext<std::string::value_type>();
-
-        if(c != 0)
-        {
-            value.push_back(c);
-        }
-    }
-
-    return std::move(value);
-}
-
-std::wstring ReadStream::readNextWideString(size_t length)
-{
-    std::wstring value;
-
-    for(size_t i = 0; i < length; ++i)
-    {
-        value.push_back(this->readNext<int16_t>());
-    }
-
-    return std::move(value);
-}
-
-const core::network::Payload& ReadStream::getPayload() const
-{
-    return payload_;
-}
-
-}
-}
+#include <streaming/readStream.hpp>
+
+#include <string.h>
+
+namespace eMU
+{
+namespace streaming
+{
+
+ReadStream::ReadStream(const core::network::Payload &payload):
+    payload_(payload)
+{
+    this->bindView(6);
+}
+
+ReadStream::ReadStream(const ReadStreamView &view)
+{
+    payload_.setSize(view.getSize());
+    memcpy(&payload_[0], view.getData(), view.getSize());
+
+    this->bindView(view.currentOffset_);
+}
+
+ReadStream::ReadStream(const ReadStream &readStream):
+    payload_(readStream.payload_)
+{
+    this->bindView(readStream.view_.currentOffset_);
+}
+
+ReadStream::ReadStream() {}
+
+ReadStream& ReadStream::operator=(const ReadStream &readStream)
+{
+    if(this != &readStream)
+    {
+        payload_ = readStream.payload_;
+        this->bindView(readStream.view_.currentOffset_);
+    }
+
+    return *this;
+}
+
+uint16_t ReadStream::getId() const
+{
+    return view_.getId();
+}
+
+size_t ReadStream::getSize() const
+{
+    return payload_.getSize();
+}
+
+std::string ReadStream::readNextString(size_t length)
+{
+    return view_.readNextString(length);
+}
+
+std::wstring ReadStream::readNextWideString(size_t length)
+{
+    return view_.readNextWideString(length);
+}
+
+std::string ReadStream::readNextWideStringAsUtf8(size_t length)
+{
+    return view_.readNextWideStringAsUtf8(length);
+}
+
+const core::network::Payload& ReadStream::getPayload() const
+{
+    return payload_;
+}
+
+ReadStream::operator const ReadStreamView&() const
+{
+    return view_;
+}
+
+void ReadStream::bindView(size_t currentOffset)
+{
+    view_ = ReadStreamView(&payload_[0], payload_.getSize());
+    view_.currentOffset_ = currentOffset;
+}
+
+}
+}
@@ -0,0 +1,101 @@
+#include <streaming/readStreamView.hpp>
+#include <streaming/wideStringCodec.hpp>
+
+namespace eMU
+{
+namespace streaming
+{
+
+ReadStreamView::ReadStreamView(const uint8_t *data, size_t size):
+    data_(data),
+    size_(size),
+    currentOffset_(6) {}
+
+ReadStreamView::ReadStreamView(const core::network::Payload &payload):
+    data_(&payload[0]),
+    size_(payload.getSize()),
+    currentOffset_(6) {}
+
+ReadStreamView::ReadStreamView():
+    data_(nullptr),
+    size_(0),
+    currentOffset_(0) {}
+
+uint16_t ReadStreamView::getId() const
+{
+    return this->readFromOffset<uint16_t>(4);
+}
+
+size_t ReadStreamView::getSize() const
+{
+    return size_;
+}
+
+const uint8_t* ReadStreamView::getData() const
+{
+    return data_;
+}
+
+std::string ReadStreamView::readNextString(size_t length)
+{
+    if(currentOffset_ + length > size_)
+    {
+        throw OverflowException();
+    }
+
+    std::string value;
+    value.reserve(length);
+
+    for(size_t i = 0; i < length; ++i)
+    {
+        std::string::value_type c = static_cast<std::string::value_type>(data_[currentOffset_ + i]);
+
+        if(c != 0)
+        {
+            value.push_back(c);
+        }
+    }
+
+    currentOffset_ += length;
+
+    return value;
+}
+
+std::wstring ReadStreamView::readNextWideString(size_t length)
+{
+    if(currentOffset_ + length * sizeof(char16_t) > size_)
+    {
+        throw OverflowException();
+    }
+
+    std::wstring value;
+    value.reserve(length);
+
+    for(size_t i = 0; i < length; ++i)
+    {
+        char16_t character;
+        memcpy(&character, data_ + currentOffset_ + i * sizeof(char16_t), sizeof(character));
+        value.push_back(character);
+    }
+
+    currentOffset_ += length * sizeof(char16_t);
+
+    return value;
+}
+
+std::string ReadStreamView::readNextWideStringAsUtf8(size_t length)
+{
+    if(currentOffset_ + length * sizeof(char16_t) > size_)
+    {
+        throw OverflowException();
+    }
+
+    std::string value;
+    WideStringCodec::decode(data_ + currentOffset_, length, value);
+    currentOffset_ += length * sizeof(char16_t);
+
+    return value;
+}
+
+}
+}
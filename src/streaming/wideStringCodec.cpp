@@ -0,0 +1,343 @@
+#include <streaming/wideStringCodec.hpp>
+
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace eMU
+{
+namespace streaming
+{
+
+namespace
+{
+
+const uint32_t kInvalidCodePoint = 0xFFFFFFFF;
+
+uint32_t readCodePoint(const uint8_t *&source, const uint8_t *end)
+{
+    uint8_t lead = *source++;
+
+    if(lead < 0x80)
+    {
+        return lead;
+    }
+
+    size_t length = 0;
+    uint32_t codePoint = 0;
+    uint8_t lowerBound = 0x80;
+    uint8_t upperBound = 0xBF;
+
+    // bounds of the first continuation byte reject overlong forms, surrogates and code points above U+10FFFF
+    if(lead >= 0xC2 && lead <= 0xDF)
+    {
+        length = 1;
+        codePoint = lead & 0x1F;
+    }
+    else if(lead >= 0xE0 && lead <= 0xEF)
+    {
+        length = 2;
+        codePoint = lead & 0x0F;
+        lowerBound = lead == 0xE0 ? 0xA0 : 0x80;
+        upperBound = lead == 0xED ? 0x9F : 0xBF;
+    }
+    else if(lead >= 0xF0 && lead <= 0xF4)
+    {
+        length = 3;
+        codePoint = lead & 0x07;
+        lowerBound = lead == 0xF0 ? 0x90 : 0x80;
+        upperBound = lead == 0xF4 ? 0x8F : 0xBF;
+    }
+    else
+    {
+        return kInvalidCodePoint;
+    }
+
+    if(static_cast<size_t>(end - source) < length || source[0] < lowerBound || source[0] > upperBound)
+    {
+        return kInvalidCodePoint;
+    }
+
+    for(size_t i = 0; i < length; ++i)
+    {
+        if((source[i] & 0xC0) != 0x80)
+        {
+            return kInvalidCodePoint;
+        }
+
+        codePoint = (codePoint << 6) | (source[i] & 0x3F);
+    }
+
+    source += length;
+
+    return codePoint;
+}
+
+uint8_t* writeUnit(uint8_t *destination, uint32_t unit)
+{
+    destination[0] = static_cast<uint8_t>(unit);
+    destination[1] = static_cast<uint8_t>(unit >> 8);
+
+    return destination + sizeof(char16_t);
+}
+
+uint16_t readUnit(const uint8_t *source)
+{
+    return static_cast<uint16_t>(source[0] | (source[1] << 8));
+}
+
+// Block helpers return number of leading ASCII characters handled, they stop at first block with non ASCII character
+// so callers finish at most one block of ASCII one by one.
+size_t countAscii(const uint8_t *source, size_t size)
+{
+    size_t count = 0;
+
+#if defined(__SSE2__)
+    for(; count + 16 <= size; count += 16)
+    {
+        if(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + count))) != 0)
+        {
+            break;
+        }
+    }
+#else
+    for(; count + 8 <= size; count += 8)
+    {
+        uint64_t bytes = 0;
+        memcpy(&bytes, source + count, sizeof(bytes));
+
+        if((bytes & 0x8080808080808080ULL) != 0)
+        {
+            break;
+        }
+    }
+#endif
+
+    return count;
+}
+
+size_t widenAscii(const uint8_t *source, size_t size, uint8_t *destination)
+{
+    size_t count = 0;
+
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+
+    for(; count + 16 <= size; count += 16)
+    {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + count));
+
+        if(_mm_movemask_epi8(bytes) != 0)
+        {
+            break;
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 2 * count), _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 2 * count + 16), _mm_unpackhi_epi8(bytes, zero));
+    }
+#else
+    for(; count + 8 <= size; count += 8)
+    {
+        uint64_t bytes = 0;
+        memcpy(&bytes, source + count, sizeof(bytes));
+
+        if((bytes & 0x8080808080808080ULL) != 0)
+        {
+            break;
+        }
+
+        for(size_t i = count; i < count + 8; ++i)
+        {
+            writeUnit(destination + 2 * i, source[i]);
+        }
+    }
+#endif
+
+    return count;
+}
+
+size_t narrowAscii(const uint8_t *source, size_t length, uint8_t *destination)
+{
+    size_t count = 0;
+
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i nonAsciiMask = _mm_set1_epi16(static_cast<short>(0xFF80));
+
+    for(; count + 8 <= length; count += 8)
+    {
+        __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 2 * count));
+
+        if(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(units, nonAsciiMask), zero)) != 0xFFFF)
+        {
+            break;
+        }
+
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(destination + count), _mm_packus_epi16(units, units));
+    }
+#else
+    for(; count + 4 <= length; count += 4)
+    {
+        uint64_t units = 0;
+        memcpy(&units, source + 2 * count, sizeof(units));
+
+        if((units & 0xFF80FF80FF80FF80ULL) != 0)
+        {
+            break;
+        }
+
+        for(size_t i = count; i < count + 4; ++i)
+        {
+            destination[i] = source[2 * i];
+        }
+    }
+#endif
+
+    return count;
+}
+
+}
+
+size_t WideStringCodec::getEncodedLength(const std::string &value)
+{
+    const uint8_t *source = reinterpret_cast<const uint8_t*>(value.data());
+    const uint8_t *end = source + value.size();
+    size_t length = 0;
+
+    while(source != end)
+    {
+        size_t asciiCount = countAscii(source, end - source);
+        source += asciiCount;
+        length += asciiCount;
+
+        for(; source != end && *source < 0x80; ++source)
+        {
+            ++length;
+        }
+
+        if(source == end)
+        {
+            break;
+        }
+
+        uint32_t codePoint = readCodePoint(source, end);
+
+        if(codePoint != kInvalidCodePoint)
+        {
+            length += codePoint >= 0x10000 ? 2 : 1;
+        }
+    }
+
+    return length;
+}
+
+void WideStringCodec::encode(const std::string &value, uint8_t *destination)
+{
+    const uint8_t *source = reinterpret_cast<const uint8_t*>(value.data());
+    const uint8_t *end = source + value.size();
+
+    while(source != end)
+    {
+        size_t asciiCount = widenAscii(source, end - source, destination);
+        source += asciiCount;
+        destination += 2 * asciiCount;
+
+        for(; source != end && *source < 0x80; ++source)
+        {
+            destination = writeUnit(destination, *source);
+        }
+
+        if(source == end)
+        {
+            break;
+        }
+
+        uint32_t codePoint = readCodePoint(source, end);
+
+        if(codePoint == kInvalidCodePoint)
+        {
+            continue;
+        }
+
+        if(codePoint >= 0x10000)
+        {
+            codePoint -= 0x10000;
+            destination = writeUnit(destination, 0xD800 | (codePoint >> 10));
+            destination = writeUnit(destination, 0xDC00 | (codePoint & 0x3FF));
+        }
+        else
+        {
+            destination = writeUnit(destination, codePoint);
+        }
+    }
+}
+
+void WideStringCodec::decode(const uint8_t *source, size_t length, std::string &value)
+{
+    // single unit takes at most 3 bytes in UTF-8, surrogate pair takes 4
+    value.resize(3 * length);
+
+    uint8_t *begin = reinterpret_cast<uint8_t*>(&value[0]);
+    uint8_t *destination = begin;
+    size_t i = 0;
+
+    while(i < length)
+    {
+        size_t asciiCount = narrowAscii(source + 2 * i, length - i, destination);
+        i += asciiCount;
+        destination += asciiCount;
+
+        for(; i < length && source[2 * i] < 0x80 && source[2 * i + 1] == 0; ++i)
+        {
+            *destination++ = source[2 * i];
+        }
+
+        if(i == length)
+        {
+            break;
+        }
+
+        uint32_t unit = readUnit(source + 2 * i);
+        ++i;
+
+        if(unit < 0x80)
+        {
+            *destination++ = static_cast<uint8_t>(unit);
+        }
+        else if(unit < 0x800)
+        {
+            *destination++ = static_cast<uint8_t>(0xC0 | (unit >> 6));
+            *destination++ = static_cast<uint8_t>(0x80 | (unit & 0x3F));
+        }
+        else if(unit >= 0xD800 && unit <= 0xDFFF)
+        {
+            uint32_t nextUnit = i < length ? readUnit(source + 2 * i) : 0;
+
+            if(unit > 0xDBFF || nextUnit < 0xDC00 || nextUnit > 0xDFFF)
+            {
+                continue;
+            }
+
+            ++i;
+            uint32_t codePoint = 0x10000 + ((unit - 0xD800) << 10) + (nextUnit - 0xDC00);
+
+            *destination++ = static_cast<uint8_t>(0xF0 | (codePoint >> 18));
+            *destination++ = static_cast<uint8_t>(0x80 | ((codePoint >> 12) & 0x3F));
+            *destination++ = static_cast<uint8_t>(0x80 | ((codePoint >> 6) & 0x3F));
+            *destination++ = static_cast<uint8_t>(0x80 | (codePoint & 0x3F));
+        }
+        else
+        {
+            *destination++ = static_cast<uint8_t>(0xE0 | (unit >> 12));
+            *destination++ = static_cast<uint8_t>(0x80 | ((unit >> 6) & 0x3F));
+            *destination++ = static_cast<uint8_t>(0x80 | (unit & 0x3F));
+        }
+    }
+
+    value.resize(destination - begin);
+}
+
+}
+}
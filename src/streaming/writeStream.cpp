@@ -1,42 +1,70 @@
-#include <streaming/writeStream.hpp>
-
-#include <string.h>
-
-namespace eMU
-{
-namespace streaming
-{
-
-WriteStream::WriteStream(uint16_t id):
-    currentOffset_(sizeof(uint32_t)),
-    size_(reinterpret_cast<uint32_t&>(payload_[0]))
-{
-    this->writeNext<uint16_t>(id);
-}
-
-WriteStream::WriteStream():
-    WriteStream(0) {}
-
-const core::network::Payload& WriteStream::getPayload() const
-{
-    return payload_;
-}
-
-void WriteStream::writeNextWideString(const std::wstring &value)
-{
-    for(size_t i = 0; i < value.length(); ++i)
-    {
-        this->writeNext<char16_t>(value[i]);
-    }
-}
-
-void WriteStream::writeNextString(const std::string &value)
-{
-    for(size_t i = 0; i < value.length(); ++i)
-    {
-        this->writeNext<std::string::value_type>(value[i]);
-    }
-}
-
-}
-}
+#include <streaming/writeStream.hpp>
+#include <streaming/wideStringCodec.hpp>
+
+#include <string.h>
+
+namespace eMU
+{
+namespace streaming
+{
+
+WriteStream::WriteStream(uint16_t id):
+    currentOffset_(sizeof(uint32_t))
+{
+    this->writeNext<uint16_t>(id);
+}
+
+WriteStream::WriteStream():
+    WriteStream(0) {}
+
+const core::network::Payload& WriteStream::getPayload() const
+{
+    return payload_;
+}
+
+void WriteStream::writeSize()
+{
+    uint32_t size = currentOffset_ - sizeof(uint32_t);
+    memcpy(&payload_[0], &size, sizeof(size));
+}
+
+uint8_t* WriteStream::reserveNext(size_t size)
+{
+    if(size + currentOffset_ > payload_.getMaxSize())
+    {
+        throw OverflowException();
+    }
+
+    payload_.setSize(currentOffset_ + size);
+    uint8_t *data = &payload_[currentOffset_];
+
+    currentOffset_ += size;
+    this->writeSize();
+
+    return data;
+}
+
+void WriteStream::writeNextWideString(const std::wstring &value)
+{
+    uint8_t *data = this->reserveNext(value.length() * sizeof(char16_t));
+
+    for(size_t i = 0; i < value.length(); ++i)
+    {
+        char16_t character = static_cast<char16_t>(value[i]);
+        memcpy(data + i * sizeof(char16_t), &character, sizeof(character));
+    }
+}
+
+void WriteStream::writeNextWideString(const std::string &value)
+{
+    uint8_t *data = this->reserveNext(WideStringCodec::getEncodedLength(value) * sizeof(char16_t));
+    WideStringCodec::encode(value, data);
+}
+
+void WriteStream::writeNextString(const std::string &value)
+{
+    memcpy(this->reserveNext(value.length()), value.data(), value.length());
+}
+
+}
+}
@@ -0,0 +1,62 @@
+#include <bt/allocationCounter.hpp>
+
+#include <atomic>
+#include <new>
+
+namespace
+{
+std::atomic<size_t> numberOfAllocations(0);
+}
+
+void* operator new(size_t size)
+{
+    ++numberOfAllocations;
+
+    void *memory = malloc(size == 0 ? 1 : size);
+
+    if(memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+    free(memory);
+}
+
+namespace eMU
+{
+namespace bt
+{
+namespace env
+{
+
+AllocationCounter::AllocationCounter():
+    start_(numberOfAllocations) {}
+
+void AllocationCounter::restart()
+{
+    start_ = numberOfAllocations;
+}
+
+size_t AllocationCounter::getNumberOfAllocations() const
+{
+    return numberOfAllocations - start_;
+}
+
+}
+}
+}
@@ -0,0 +1,10 @@
+#include <core/common/logging.hpp>
+#include <gtest/gtest.h>
+#include <bt/bt.hpp>
+
+int main(int count, char *args[])
+{
+    testing::InitGoogleTest(&count, args);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,118 @@
+#include <core/common/concurrency.hpp>
+#include <bt/stopwatch.hpp>
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+using eMU::core::common::Concurrency;
+using eMU::bt::env::Stopwatch;
+
+class ConcurrencyBenchmark: public ::testing::Test
+{
+protected:
+    // Mimics a connection: handlers run one after another on their own strand, each one queueing the next.
+    class HandlersChain
+    {
+    public:
+        HandlersChain(boost::asio::io_service &ioService, size_t length, std::function<void()> finished):
+            strand_(ioService),
+            remaining_(length),
+            finished_(finished) {}
+
+        void start()
+        {
+            strand_.post(std::bind(&HandlersChain::step, this));
+        }
+
+    private:
+        void step()
+        {
+            if(--remaining_ == 0)
+            {
+                finished_();
+                return;
+            }
+
+            strand_.post(std::bind(&HandlersChain::step, this));
+        }
+
+        boost::asio::io_service::strand strand_;
+        size_t remaining_;
+        std::function<void()> finished_;
+    };
+
+    void runChains(Concurrency::Model model, const std::string &name)
+    {
+        Concurrency concurrency(ioService_, kNumberOfThreads, model);
+        std::atomic<size_t> runningChains(kNumberOfChains);
+        std::vector<std::unique_ptr<HandlersChain>> chains;
+
+        for(size_t i = 0; i < kNumberOfChains; ++i)
+        {
+            chains.push_back(std::unique_ptr<HandlersChain>(new HandlersChain(concurrency.getNextIoService(), kChainLength, [&]()
+            {
+                if(--runningChains == 0)
+                {
+                    concurrency.stop();
+                }
+            })));
+            chains.back()->start();
+        }
+
+        Stopwatch stopwatch;
+        concurrency.start();
+        concurrency.join();
+        stopwatch.report(name, kNumberOfChains * kChainLength);
+
+        ASSERT_EQ(0, runningChains);
+    }
+
+    static const size_t kNumberOfThreads = 4;
+    static const size_t kNumberOfChains = 64;
+    static const size_t kChainLength = 50000;
+
+    boost::asio::io_service ioService_;
+};
+
+TEST_F(ConcurrencyBenchmark, strandHandlersOnSharedIoService)
+{
+    this->runChains(Concurrency::Model::SHARED_IO_SERVICE, "64 strands, shared io_service, 4 threads");
+}
+
+TEST_F(ConcurrencyBenchmark, strandHandlersOnIoServicePerThread)
+{
+    this->runChains(Concurrency::Model::IO_SERVICE_PER_THREAD, "64 strands, io_service per thread, 4 threads");
+}
+
+TEST_F(ConcurrencyBenchmark, crossLoopPostRoundTrip)
+{
+    const size_t numberOfRoundTrips = 200000;
+
+    Concurrency concurrency(ioService_, 2, Concurrency::Model::IO_SERVICE_PER_THREAD);
+    boost::asio::io_service &first = concurrency.getIoService(0);
+    boost::asio::io_service &second = concurrency.getIoService(1);
+    size_t remaining = numberOfRoundTrips;
+
+    std::function<void()> ping;
+    std::function<void()> pong = [&]() { first.post(ping); };
+    ping = [&]()
+    {
+        if(remaining-- == 0)
+        {
+            concurrency.stop();
+            return;
+        }
+
+        second.post(pong);
+    };
+
+    first.post(ping);
+
+    Stopwatch stopwatch;
+    concurrency.start();
+    concurrency.join();
+    stopwatch.report("cross loop post round trip", numberOfRoundTrips);
+}
@@ -0,0 +1,109 @@
+#define eMU_LOG_MIN_SEVERITY debug
+
+#include <core/common/asyncLogger.hpp>
+#include <protocols/streamDispatcher.hpp>
+#include <streaming/writeStream.hpp>
+#include <streaming/readStreamView.hpp>
+#include <bt/stopwatch.hpp>
+
+#include <boost/log/core.hpp>
+#include <boost/log/sinks/sync_frontend.hpp>
+#include <boost/log/sinks/text_ostream_backend.hpp>
+#include <boost/make_shared.hpp>
+#include <gtest/gtest.h>
+#include <fstream>
+
+using eMU::core::common::AsyncLogger;
+using eMU::protocols::StreamDispatcher;
+using eMU::streaming::WriteStream;
+using eMU::streaming::ReadStreamView;
+using eMU::bt::env::Stopwatch;
+
+class LoggingBenchmark: public ::testing::Test
+{
+protected:
+    typedef boost::log::sinks::synchronous_sink<boost::log::sinks::text_ostream_backend> Sink;
+    typedef StreamDispatcher<size_t, const ReadStreamView&> Dispatcher;
+
+    LoggingBenchmark():
+        writeStream_(kStreamId),
+        stream_(writeStream_.getPayload()),
+        dispatcher_(kStreamId),
+        sink_(boost::make_shared<Sink>()),
+        handledStreams_(0)
+    {
+        dispatcher_.registerHandler(kStreamId, [this](size_t, const ReadStreamView&) { ++handledStreams_; });
+
+        // records are formatted but not printed
+        sink_->locked_backend()->add_stream(boost::make_shared<std::ofstream>("/dev/null"));
+        boost::log::core::get()->add_sink(sink_);
+    }
+
+    ~LoggingBenchmark()
+    {
+        AsyncLogger::getInstance().flush();
+        boost::log::core::get()->remove_sink(sink_);
+    }
+
+    static const uint16_t kStreamId = 0x04C7;
+    static const size_t kNumberOfStreams = 200000;
+    static const size_t kBurstSize = 1000;
+
+    WriteStream writeStream_;
+    ReadStreamView stream_;
+    Dispatcher dispatcher_;
+    boost::shared_ptr<Sink> sink_;
+    size_t handledStreams_;
+};
+
+// mirrors protocols::Server::dispatch, each received stream is logged before handling
+TEST_F(LoggingBenchmark, dispatch)
+{
+    Stopwatch stopwatch;
+
+    for(size_t hash = 0; hash < kNumberOfStreams; ++hash)
+    {
+        BOOST_LOG_TRIVIAL(info) << "[" << __FILE__ << ":" << __LINE__ << "] " << "Received, hash: " << hash << ", stream id: " << stream_.getId();
+        dispatcher_.dispatch(stream_.getId(), hash, stream_);
+    }
+
+    stopwatch.report("dispatch, synchronous log", kNumberOfStreams);
+    stopwatch.restart();
+
+    // bursts fit into thread ring, writer catches up between them
+    for(size_t hash = 0; hash < kNumberOfStreams; ++hash)
+    {
+        eMU_LOG(info) << "Received, hash: " << hash << ", stream id: " << stream_.getId();
+        dispatcher_.dispatch(stream_.getId(), hash, stream_);
+
+        if((hash + 1) % kBurstSize == 0)
+        {
+            stopwatch.pause();
+            AsyncLogger::getInstance().flush();
+            stopwatch.resume();
+        }
+    }
+
+    stopwatch.report("dispatch, asynchronous log, caller side in bursts of 1000", kNumberOfStreams);
+    stopwatch.restart();
+
+    for(size_t hash = 0; hash < kNumberOfStreams; ++hash)
+    {
+        eMU_LOG(info) << "Received, hash: " << hash << ", stream id: " << stream_.getId();
+        dispatcher_.dispatch(stream_.getId(), hash, stream_);
+    }
+
+    AsyncLogger::getInstance().flush();
+    stopwatch.report("dispatch, asynchronous log, sustained until written", kNumberOfStreams);
+    stopwatch.restart();
+
+    for(size_t hash = 0; hash < kNumberOfStreams; ++hash)
+    {
+        eMU_LOG(trace) << "Received, hash: " << hash << ", stream id: " << stream_.getId();
+        dispatcher_.dispatch(stream_.getId(), hash, stream_);
+    }
+
+    stopwatch.report("dispatch, log compiled out", kNumberOfStreams);
+
+    ASSERT_EQ(4 * kNumberOfStreams, handledStreams_);
+}
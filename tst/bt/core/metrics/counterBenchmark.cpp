@@ -0,0 +1,59 @@
+#include <core/metrics/counter.hpp>
+#include <bt/stopwatch.hpp>
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using eMU::core::metrics::Counter;
+using eMU::bt::env::Stopwatch;
+
+class CounterBenchmark: public ::testing::Test
+{
+protected:
+    template<typename Increment>
+    void runThreads(Increment increment)
+    {
+        std::vector<std::thread> threads;
+
+        for(size_t i = 0; i < kNumberOfThreads; ++i)
+        {
+            threads.push_back(std::thread([increment]()
+            {
+                for(size_t j = 0; j < kNumberOfIncrements; ++j)
+                {
+                    increment();
+                }
+            }));
+        }
+
+        for(auto &thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    static const size_t kNumberOfThreads = 4;
+    static const size_t kNumberOfIncrements = 2000000;
+};
+
+TEST_F(CounterBenchmark, incrementFromManyThreads)
+{
+    std::atomic<uint64_t> atomic(0);
+    Stopwatch stopwatch;
+
+    this->runThreads([&atomic]() { atomic.fetch_add(1, std::memory_order_relaxed); });
+
+    stopwatch.report("shared atomic increment (4 threads)", kNumberOfThreads * kNumberOfIncrements);
+
+    Counter counter;
+    stopwatch.restart();
+
+    this->runThreads([&counter]() { counter.increment(); });
+
+    stopwatch.report("sharded counter increment (4 threads)", kNumberOfThreads * kNumberOfIncrements);
+
+    ASSERT_EQ(kNumberOfThreads * kNumberOfIncrements, atomic.load());
+    ASSERT_EQ(kNumberOfThreads * kNumberOfIncrements, counter.getValue());
+}
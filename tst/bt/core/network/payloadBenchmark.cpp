@@ -0,0 +1,116 @@
+#include <core/network/payload.hpp>
+#include <core/network/readBuffer.hpp>
+#include <core/network/writeBuffer.hpp>
+#include <streaming/writeStream.hpp>
+#include <streaming/readStreamView.hpp>
+#include <bt/stopwatch.hpp>
+#include <bt/allocationCounter.hpp>
+
+#include <gtest/gtest.h>
+#include <vector>
+#include <string.h>
+
+using eMU::core::network::Payload;
+using eMU::core::network::ReadBuffer;
+using eMU::core::network::WriteBuffer;
+using eMU::streaming::WriteStream;
+using eMU::streaming::ReadStreamView;
+using eMU::bt::env::Stopwatch;
+using eMU::bt::env::AllocationCounter;
+
+class PayloadBenchmark: public ::testing::Test
+{
+protected:
+    size_t roundTrip(size_t numberOfFields)
+    {
+        WriteStream writeStream(0x1234);
+
+        for(size_t i = 0; i < numberOfFields; ++i)
+        {
+            writeStream.writeNext<uint32_t>(i);
+        }
+
+        const Payload &payload = writeStream.getPayload();
+
+        writeBuffer_.insert(payload);
+        writeBuffer_.setPendingState();
+        writeBuffer_.insert(payload);
+
+        memcpy(readBuffer_.getFreeSpace(), &writeBuffer_.getPayload()[0], writeBuffer_.getPayload().getSize());
+        readBuffer_.insert(writeBuffer_.getPayload().getSize());
+
+        writeBuffer_.swap();
+        writeBuffer_.clearPendingState();
+        writeBuffer_.clear();
+
+        ReadStreamView view(readBuffer_.getPayload());
+        size_t sum = view.getId();
+
+        for(size_t i = 0; i < numberOfFields; ++i)
+        {
+            sum += view.readNext<uint32_t>();
+        }
+
+        readBuffer_.compact();
+
+        return payload.getSize() + (sum & 1);
+    }
+
+    void run(const std::string &name, size_t numberOfFields)
+    {
+        const size_t numberOfRoundTrips = 200000;
+
+        for(size_t i = 0; i < 100; ++i)
+        {
+            this->roundTrip(numberOfFields);
+        }
+
+        size_t bytes = 0;
+        AllocationCounter allocationCounter;
+        Stopwatch stopwatch;
+
+        for(size_t i = 0; i < numberOfRoundTrips; ++i)
+        {
+            bytes += this->roundTrip(numberOfFields);
+        }
+
+        stopwatch.report(name, numberOfRoundTrips, bytes);
+
+        ASSERT_EQ(0, allocationCounter.getNumberOfAllocations());
+    }
+
+    WriteBuffer writeBuffer_;
+    ReadBuffer readBuffer_;
+    std::vector<uint8_t> legacyPayload_;
+};
+
+TEST_F(PayloadBenchmark, smallStreamRoundTripShouldNotAllocate)
+{
+    this->run("small stream build/send/receive", 8);
+}
+
+TEST_F(PayloadBenchmark, largeStreamRoundTripShouldNotAllocate)
+{
+    this->run("large stream build/send/receive", 400);
+}
+
+TEST_F(PayloadBenchmark, zeroFilledVectorBaseline)
+{
+    const size_t numberOfPayloads = 200000;
+    size_t checksum = 0;
+
+    AllocationCounter allocationCounter;
+    Stopwatch stopwatch;
+
+    for(size_t i = 0; i < numberOfPayloads; ++i)
+    {
+        legacyPayload_ = std::vector<uint8_t>(Payload::getMaxSize(), 0);
+        legacyPayload_[i % legacyPayload_.size()] = static_cast<uint8_t>(i);
+        checksum += legacyPayload_[(i * 7) % legacyPayload_.size()];
+    }
+
+    stopwatch.report("4096 byte zero-filled vector per payload (previous layout)", numberOfPayloads);
+
+    ASSERT_LE(numberOfPayloads, allocationCounter.getNumberOfAllocations());
+    ASSERT_LE(0, checksum);
+}
@@ -0,0 +1,112 @@
+#include <core/network/readBuffer.hpp>
+#include <streaming/readStreamsExtractor.hpp>
+#include <bt/stopwatch.hpp>
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include <string.h>
+
+using eMU::core::network::ReadBuffer;
+using eMU::core::network::Payload;
+using eMU::streaming::ReadStreamsExtractor;
+using eMU::bt::env::Stopwatch;
+
+class ReadBufferBenchmark: public ::testing::Test
+{
+protected:
+    ReadBufferBenchmark():
+        generator_(0x5EED) {}
+
+    void prepareStreams(size_t numberOfStreams, size_t maxStreamSize)
+    {
+        std::uniform_int_distribution<size_t> sizeDistribution(sizeof(uint16_t), maxStreamSize - ReadBuffer::getStreamHeaderSize());
+
+        for(size_t i = 0; i < numberOfStreams; ++i)
+        {
+            uint32_t streamSize = sizeDistribution(generator_);
+            uint16_t streamId = static_cast<uint16_t>(i);
+
+            size_t offset = data_.size();
+            data_.resize(offset + ReadBuffer::getStreamHeaderSize() + streamSize, static_cast<uint8_t>(i));
+            memcpy(&data_[offset], &streamSize, sizeof(streamSize));
+            memcpy(&data_[offset + ReadBuffer::getStreamHeaderSize()], &streamId, sizeof(streamId));
+        }
+    }
+
+    size_t feed(size_t maxChunkSize)
+    {
+        std::uniform_int_distribution<size_t> chunkDistribution(1, maxChunkSize);
+
+        ReadBuffer readBuffer;
+        size_t offset = 0;
+        size_t streamsCount = 0;
+        uint16_t expectedId = 0;
+
+        while(offset < data_.size())
+        {
+            size_t chunkSize = std::min(std::min(chunkDistribution(generator_), data_.size() - offset), readBuffer.getFreeSpaceSize());
+            memcpy(readBuffer.getFreeSpace(), &data_[offset], chunkSize);
+            offset += chunkSize;
+
+            EXPECT_TRUE(readBuffer.insert(chunkSize));
+
+            if(!readBuffer.getPayload().empty())
+            {
+                ReadStreamsExtractor extractor(readBuffer.getPayload());
+                EXPECT_TRUE(extractor.extract());
+
+                for(const auto &stream : extractor.getStreams())
+                {
+                    EXPECT_EQ(expectedId++, stream.getId());
+                    ++streamsCount;
+                }
+
+                readBuffer.compact();
+            }
+        }
+
+        EXPECT_EQ(0, readBuffer.getPendingSize());
+
+        return streamsCount;
+    }
+
+    std::mt19937 generator_;
+    std::vector<uint8_t> data_;
+};
+
+TEST_F(ReadBufferBenchmark, randomlyFragmentedSmallStreams)
+{
+    const size_t numberOfStreams = 200000;
+    prepareStreams(numberOfStreams, 64);
+
+    Stopwatch stopwatch;
+    size_t streamsCount = feed(Payload::getMaxSize());
+    stopwatch.report("small streams, chunks up to 4096 bytes", streamsCount, data_.size());
+
+    ASSERT_EQ(numberOfStreams, streamsCount);
+}
+
+TEST_F(ReadBufferBenchmark, randomlyFragmentedLargeStreams)
+{
+    const size_t numberOfStreams = 20000;
+    prepareStreams(numberOfStreams, Payload::getMaxSize());
+
+    Stopwatch stopwatch;
+    size_t streamsCount = feed(Payload::getMaxSize());
+    stopwatch.report("large streams, chunks up to 4096 bytes", streamsCount, data_.size());
+
+    ASSERT_EQ(numberOfStreams, streamsCount);
+}
+
+TEST_F(ReadBufferBenchmark, streamsSplitIntoTinyChunks)
+{
+    const size_t numberOfStreams = 50000;
+    prepareStreams(numberOfStreams, 256);
+
+    Stopwatch stopwatch;
+    size_t streamsCount = feed(16);
+    stopwatch.report("medium streams, chunks up to 16 bytes", streamsCount, data_.size());
+
+    ASSERT_EQ(numberOfStreams, streamsCount);
+}
@@ -0,0 +1,153 @@
+#include <core/network/tcp/usersFactory.hpp>
+#include <core/network/tcp/protocol.hpp>
+#include <core/common/factory.hpp>
+#include <bt/stopwatch.hpp>
+
+#include <gtest/gtest.h>
+#include <random>
+#include <thread>
+#include <vector>
+
+using eMU::core::network::tcp::UsersFactory;
+using eMU::core::network::tcp::NetworkUser;
+using eMU::core::network::tcp::Connection;
+using eMU::core::network::tcp::Protocol;
+using eMU::core::common::Factory;
+using eMU::bt::env::Stopwatch;
+
+class UsersFactoryBenchmark: public ::testing::Test
+{
+protected:
+    void prepareConnections(size_t numberOfUsers)
+    {
+        connections_.reserve(numberOfUsers);
+
+        for(size_t i = 0; i < numberOfUsers; ++i)
+        {
+            connections_.push_back(Connection::Pointer(new Connection(ioService_, protocol_)));
+        }
+    }
+
+    template<typename Function>
+    void runInThreads(Function function)
+    {
+        std::vector<std::thread> threads;
+
+        for(size_t i = 0; i < kNumberOfThreads; ++i)
+        {
+            threads.push_back(std::thread(function, i));
+        }
+
+        for(auto &thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    void run(size_t numberOfUsers)
+    {
+        this->prepareConnections(numberOfUsers);
+
+        UsersFactory<NetworkUser> usersFactory;
+        std::vector<NetworkUser::Hash> hashes(numberOfUsers);
+        size_t usersPerThread = numberOfUsers / kNumberOfThreads;
+
+        Stopwatch stopwatch;
+        this->runInThreads([&](size_t thread)
+        {
+            for(size_t i = thread * usersPerThread; i < (thread + 1) * usersPerThread; ++i)
+            {
+                hashes[i] = usersFactory.create(connections_[i]).getHash();
+            }
+        });
+        stopwatch.report(std::to_string(numberOfUsers) + " users, create, 8 threads", numberOfUsers);
+
+        ASSERT_EQ(numberOfUsers, usersFactory.size());
+
+        const size_t lookupsPerThread = 500000;
+        std::vector<size_t> misses(kNumberOfThreads, 0);
+
+        stopwatch.restart();
+        this->runInThreads([&](size_t thread)
+        {
+            std::mt19937 generator(thread);
+            std::uniform_int_distribution<size_t> userDistribution(0, numberOfUsers - 1);
+
+            for(size_t i = 0; i < lookupsPerThread; ++i)
+            {
+                size_t user = userDistribution(generator);
+
+                if(&usersFactory.find(hashes[user]) != &usersFactory.find(connections_[user]))
+                {
+                    ++misses[thread];
+                }
+            }
+        });
+        stopwatch.report(std::to_string(numberOfUsers) + " users, find by hash and connection, 8 threads", 2 * kNumberOfThreads * lookupsPerThread);
+
+        stopwatch.restart();
+        this->runInThreads([&](size_t thread)
+        {
+            for(size_t i = thread * usersPerThread; i < (thread + 1) * usersPerThread; ++i)
+            {
+                usersFactory.destroy(usersFactory.find(hashes[i]));
+            }
+        });
+        stopwatch.report(std::to_string(numberOfUsers) + " users, destroy, 8 threads", numberOfUsers);
+
+        ASSERT_TRUE(usersFactory.empty());
+        ASSERT_EQ(std::vector<size_t>(kNumberOfThreads, 0), misses);
+    }
+
+    static const size_t kNumberOfThreads = 8;
+
+    boost::asio::io_service ioService_;
+    Protocol protocol_;
+    std::vector<Connection::Pointer> connections_;
+};
+
+TEST_F(UsersFactoryBenchmark, tenThousandUsers)
+{
+    this->run(10000);
+}
+
+TEST_F(UsersFactoryBenchmark, hundredThousandUsers)
+{
+    this->run(100000);
+}
+
+TEST_F(UsersFactoryBenchmark, tenThousandUsersLinearFactoryBaseline)
+{
+    const size_t numberOfUsers = 10000;
+    const size_t numberOfLookups = 20000;
+
+    this->prepareConnections(numberOfUsers);
+
+    Factory<NetworkUser> factory;
+    std::vector<NetworkUser::Hash> hashes;
+
+    for(const auto &connection : connections_)
+    {
+        hashes.push_back(factory.create(connection).getHash());
+    }
+
+    std::mt19937 generator(0);
+    std::uniform_int_distribution<size_t> userDistribution(0, numberOfUsers - 1);
+    size_t misses = 0;
+
+    Stopwatch stopwatch;
+
+    for(size_t i = 0; i < numberOfLookups; ++i)
+    {
+        size_t user = userDistribution(generator);
+
+        if(&factory.find(hashes[user]) != &factory.find(connections_[user]))
+        {
+            ++misses;
+        }
+    }
+
+    stopwatch.report("10000 users, linear factory find by hash and connection, 1 thread", 2 * numberOfLookups);
+
+    ASSERT_EQ(0, misses);
+}
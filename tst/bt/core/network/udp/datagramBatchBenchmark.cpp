@@ -0,0 +1,170 @@
+#include <core/network/udp/datagramBatch.hpp>
+#include <core/network/udp/writeBufferFactory.hpp>
+#include <bt/stopwatch.hpp>
+#include <bt/allocationCounter.hpp>
+
+#include <gtest/gtest.h>
+#include <map>
+#include <netinet/in.h>
+#include <unistd.h>
+
+using eMU::core::network::Payload;
+using eMU::core::network::WriteBuffer;
+using eMU::core::network::udp::DatagramBatch;
+using eMU::core::network::udp::WriteBufferFactory;
+using eMU::bt::env::Stopwatch;
+using eMU::bt::env::AllocationCounter;
+
+class DatagramBatchBenchmark: public ::testing::Test
+{
+protected:
+    DatagramBatchBenchmark():
+        sender_(this->openSocket()),
+        receiver_(this->openSocket())
+    {
+        socklen_t length = receiverEndpoint_.capacity();
+        getsockname(receiver_, receiverEndpoint_.data(), &length);
+        receiverEndpoint_.resize(length);
+
+        payload_.setSize(kDatagramSize);
+        memset(&payload_[0], 0x5A, kDatagramSize);
+    }
+
+    ~DatagramBatchBenchmark()
+    {
+        close(sender_);
+        close(receiver_);
+    }
+
+    int openSocket()
+    {
+        int descriptor = socket(AF_INET, SOCK_DGRAM, 0);
+
+        // burst of kBurstSize datagrams has to fit into receive buffer
+        int bufferSize = 1024 * 1024;
+        setsockopt(descriptor, SOL_SOCKET, SO_RCVBUF, &bufferSize, sizeof(bufferSize));
+
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bind(descriptor, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+
+        return descriptor;
+    }
+
+    static const size_t kDatagramSize = 64;
+    static const size_t kBurstSize = 256;
+    static const size_t kNumberOfBursts = 400;
+
+    int sender_;
+    int receiver_;
+    boost::asio::ip::udp::endpoint receiverEndpoint_;
+    Payload payload_;
+};
+
+TEST_F(DatagramBatchBenchmark, loopbackBurst)
+{
+    uint8_t buffer[4096];
+    size_t receivedDatagrams = 0;
+    Stopwatch stopwatch;
+
+    for(size_t burst = 0; burst < kNumberOfBursts; ++burst)
+    {
+        for(size_t i = 0; i < kBurstSize; ++i)
+        {
+            sendto(sender_, &payload_[0], kDatagramSize, 0, receiverEndpoint_.data(), receiverEndpoint_.size());
+        }
+
+        for(size_t i = 0; i < kBurstSize; ++i)
+        {
+            receivedDatagrams += recvfrom(receiver_, buffer, sizeof(buffer), MSG_DONTWAIT, nullptr, nullptr) > 0 ? 1 : 0;
+        }
+    }
+
+    stopwatch.report("udp loopback sendto/recvfrom per datagram (64 B)", kNumberOfBursts * kBurstSize, receivedDatagrams * kDatagramSize);
+
+    ASSERT_EQ(kNumberOfBursts * kBurstSize, receivedDatagrams);
+
+    DatagramBatch batch;
+    receivedDatagrams = 0;
+    stopwatch.restart();
+
+    for(size_t burst = 0; burst < kNumberOfBursts; ++burst)
+    {
+        for(size_t i = 0; i < kBurstSize; i += DatagramBatch::kMaxNumberOfDatagrams)
+        {
+            for(size_t j = 0; j < DatagramBatch::kMaxNumberOfDatagrams; ++j)
+            {
+                batch.add(receiverEndpoint_, payload_);
+            }
+
+            batch.send(sender_);
+        }
+
+        for(size_t received = batch.receive(receiver_); received > 0; received = batch.receive(receiver_))
+        {
+            receivedDatagrams += received;
+        }
+    }
+
+    stopwatch.report("udp loopback sendmmsg/recvmmsg batches of 32 (64 B)", kNumberOfBursts * kBurstSize, receivedDatagrams * kDatagramSize);
+
+    ASSERT_EQ(kNumberOfBursts * kBurstSize, receivedDatagrams);
+}
+
+TEST_F(DatagramBatchBenchmark, endpointBuffers)
+{
+    const size_t kNumberOfEndpoints = 64;
+    const size_t kNumberOfRounds = 20000;
+
+    std::vector<boost::asio::ip::udp::endpoint> endpoints;
+
+    for(size_t i = 0; i < kNumberOfEndpoints; ++i)
+    {
+        endpoints.push_back(boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4(0x0A000001 + i), 55901));
+    }
+
+    // reproduces former map of buffers created and erased around every send
+    std::map<boost::asio::ip::udp::endpoint, WriteBuffer> buffers;
+    AllocationCounter allocationCounter;
+    Stopwatch stopwatch;
+
+    for(size_t round = 0; round < kNumberOfRounds; ++round)
+    {
+        for(const auto &endpoint : endpoints)
+        {
+            buffers[endpoint] = WriteBuffer();
+            buffers[endpoint].insert(payload_);
+        }
+
+        for(const auto &endpoint : endpoints)
+        {
+            buffers.erase(endpoint);
+        }
+    }
+
+    stopwatch.report("std::map endpoint buffers, insert + erase (64 endpoints)", kNumberOfRounds * kNumberOfEndpoints);
+    size_t mapAllocations = allocationCounter.getNumberOfAllocations();
+
+    WriteBufferFactory writeBufferFactory;
+    allocationCounter.restart();
+    stopwatch.restart();
+
+    for(size_t round = 0; round < kNumberOfRounds; ++round)
+    {
+        for(const auto &endpoint : endpoints)
+        {
+            writeBufferFactory.get(endpoint).insert(payload_);
+        }
+
+        for(const auto &endpoint : endpoints)
+        {
+            writeBufferFactory.erase(endpoint);
+        }
+    }
+
+    stopwatch.report("flat hash of pooled endpoint buffers, insert + erase (64 endpoints)", kNumberOfRounds * kNumberOfEndpoints);
+
+    ASSERT_LE(kNumberOfRounds * kNumberOfEndpoints, mapAllocations);
+    ASSERT_GE(kNumberOfEndpoints * 2, allocationCounter.getNumberOfAllocations());
+}
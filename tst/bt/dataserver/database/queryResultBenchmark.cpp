@@ -0,0 +1,79 @@
+#include <dataserver/database/queryResult.hpp>
+#include <bt/allocationCounter.hpp>
+#include <bt/stopwatch.hpp>
+
+#include <gtest/gtest.h>
+
+using eMU::dataserver::database::QueryResult;
+using eMU::dataserver::database::Row;
+using eMU::bt::env::AllocationCounter;
+using eMU::bt::env::Stopwatch;
+
+class QueryResultBenchmark: public ::testing::Test
+{
+protected:
+    static const size_t kNumberOfValues = 6;
+    static const size_t kMaxRowSize = 64;
+
+    // mirrors MySqlInterface, result is reserved upfront from number of rows and max field lengths
+    void fill(QueryResult &queryResult, size_t numberOfRows)
+    {
+        queryResult.reserve(numberOfRows, numberOfRows * kNumberOfValues, numberOfRows * kMaxRowSize);
+
+        for(size_t i = 0; i < numberOfRows; ++i)
+        {
+            queryResult.createRow();
+            queryResult.insert("12", 2); queryResult.insert("23", 2); queryResult.insert("145", 3);
+            queryResult.insert("characterName", 13); queryResult.insert("44", 2); queryResult.insert("1", 1);
+        }
+    }
+
+    size_t read(const QueryResult &queryResult)
+    {
+        size_t level = queryResult.getFieldIndex("level");
+        size_t race = queryResult.getFieldIndex("race");
+        size_t sum = 0;
+
+        for(const auto &row : queryResult.getRows())
+        {
+            sum += row.getValue<uint32_t>(level) + row.getValue<uint32_t>(race);
+        }
+
+        return sum;
+    }
+
+    size_t countAllocations(size_t numberOfRows)
+    {
+        AllocationCounter allocationCounter;
+
+        QueryResult queryResult(fields_);
+        this->fill(queryResult, numberOfRows);
+        EXPECT_EQ(numberOfRows * (145 + 44), this->read(queryResult));
+
+        return allocationCounter.getNumberOfAllocations();
+    }
+
+    Row::Fields fields_ = {{"hairColor", 0}, {"hairType", 1}, {"level", 2}, {"name", 3}, {"race", 4}, {"tutorialState", 5}};
+};
+
+TEST_F(QueryResultBenchmark, numberOfAllocationsShouldNotDependOnNumberOfRows)
+{
+    EXPECT_EQ(this->countAllocations(5), this->countAllocations(5000));
+}
+
+TEST_F(QueryResultBenchmark, fillAndReadCharactersList)
+{
+    const size_t numberOfResults = 20000;
+    const size_t numberOfRows = 5;
+
+    Stopwatch stopwatch;
+
+    for(size_t i = 0; i < numberOfResults; ++i)
+    {
+        QueryResult queryResult(fields_);
+        this->fill(queryResult, numberOfRows);
+        ASSERT_EQ(numberOfRows * (145 + 44), this->read(queryResult));
+    }
+
+    stopwatch.report("characters list result, 5 rows", numberOfResults);
+}
@@ -0,0 +1,143 @@
+#include <dataserver/transactions/charactersListRequest.hpp>
+#include <dataserver/context.hpp>
+#include <dataserver/protocol.hpp>
+#include <dataserver/user.hpp>
+#include <streaming/readStream.hpp>
+#include <streaming/dataserver/charactersListResponse.hpp>
+#include <mt/dataserver/database/sqlInterfaceStub.hpp>
+#include <bt/stopwatch.hpp>
+
+#include <gtest/gtest.h>
+
+using eMU::dataserver::Context;
+using eMU::dataserver::Protocol;
+using eMU::dataserver::User;
+using eMU::dataserver::CharactersCache;
+using eMU::dataserver::database::QueryResult;
+using eMU::dataserver::database::SqlInterface;
+using eMU::mt::env::dataserver::database::SqlInterfaceStub;
+using eMU::core::network::tcp::Connection;
+using eMU::core::network::tcp::NetworkUser;
+using eMU::streaming::ReadStream;
+using eMU::bt::env::Stopwatch;
+
+namespace transactions = eMU::dataserver::transactions;
+namespace streaming = eMU::streaming;
+
+namespace
+{
+
+// reproduces former behaviour, database was pinged before each request
+class PingingCharactersListRequest: public transactions::CharactersListRequest
+{
+public:
+    PingingCharactersListRequest(User &user,
+                                 SqlInterface &sqlInterface,
+                                 const streaming::dataserver::CharactersListRequest &request,
+                                 eMU::dataserver::CharactersCache &charactersCache):
+        transactions::CharactersListRequest(user, sqlInterface, request, charactersCache) {}
+
+private:
+    bool isValid() const
+    {
+        return sqlInterface_.isAlive();
+    }
+};
+
+}
+
+class DatabaseTransactionBenchmark: public ::testing::Test
+{
+protected:
+    DatabaseTransactionBenchmark():
+        dataserverContext_(sqlInterface_, 1),
+        dataserverProtocol_(dataserverContext_),
+        connection_(new Connection(ioService_, dataserverProtocol_)),
+        user_(connection_),
+        request_(ReadStream(streaming::dataserver::CharactersListRequest(NetworkUser::Hash(0x1234), "account").getWriteStream().getPayload()))
+    {
+        queryResult_ = QueryResult({{"hairColor", 0}, {"hairType", 1}, {"level", 2}, {"name", 3}, {"race", 4}, {"tutorialState", 5}});
+        queryResult_.createRow();
+
+        for(const char *value : {"12", "23", "45", "andrew", "44", "0"})
+        {
+            queryResult_.insert(value);
+        }
+
+        sqlInterface_.setLatency(kRoundTripTime);
+    }
+
+    template<typename TransactionType>
+    void run(const std::string &name)
+    {
+        for(size_t i = 0; i < kNumberOfRequests; ++i)
+        {
+            sqlInterface_.pushQueryStatus(true);
+            sqlInterface_.pushQueryResult(queryResult_);
+        }
+
+        Stopwatch stopwatch;
+
+        for(size_t i = 0; i < kNumberOfRequests; ++i)
+        {
+            TransactionType(user_, sqlInterface_, request_, dataserverContext_.getCharactersCache()).handle();
+        }
+
+        stopwatch.report(name, kNumberOfRequests);
+    }
+
+    static const size_t kNumberOfRequests = 2000;
+    static const std::chrono::microseconds kRoundTripTime;
+
+    SqlInterfaceStub sqlInterface_;
+    Context dataserverContext_;
+    Protocol dataserverProtocol_;
+    boost::asio::io_service ioService_;
+    Connection::Pointer connection_;
+    User user_;
+    streaming::dataserver::CharactersListRequest request_;
+    QueryResult queryResult_;
+};
+
+const size_t DatabaseTransactionBenchmark::kNumberOfRequests;
+const std::chrono::microseconds DatabaseTransactionBenchmark::kRoundTripTime(200);
+
+TEST_F(DatabaseTransactionBenchmark, charactersListWithPingBeforeEachRequest)
+{
+    this->run<PingingCharactersListRequest>("characters list, ping + query, 200 us round trip");
+
+    EXPECT_EQ(2 * kNumberOfRequests, sqlInterface_.getNumberOfRoundTrips());
+}
+
+TEST_F(DatabaseTransactionBenchmark, charactersListRelyingOnHealthChecker)
+{
+    this->run<transactions::CharactersListRequest>("characters list, query only, 200 us round trip");
+
+    EXPECT_EQ(kNumberOfRequests, sqlInterface_.getNumberOfRoundTrips());
+}
+
+TEST_F(DatabaseTransactionBenchmark, charactersListServedFromCache)
+{
+    CharactersCache &charactersCache = dataserverContext_.getCharactersCache();
+    charactersCache.configure(1024 * 1024, std::chrono::minutes(1));
+
+    sqlInterface_.pushQueryStatus(true);
+    sqlInterface_.pushQueryResult(queryResult_);
+    transactions::CharactersListRequest(user_, sqlInterface_, request_, charactersCache).handle();
+
+    Stopwatch stopwatch;
+
+    for(size_t i = 0; i < kNumberOfRequests; ++i)
+    {
+        streaming::common::CharacterInfoContainer characters;
+        ASSERT_TRUE(charactersCache.find(request_.getAccountId(), characters));
+
+        streaming::dataserver::CharactersListResponse response(request_.getUserHash(), characters);
+        user_.getConnection().send(response.getWriteStream().getPayload());
+    }
+
+    stopwatch.report("characters list, cache hit", kNumberOfRequests);
+
+    EXPECT_EQ(1, sqlInterface_.getNumberOfRoundTrips());
+    EXPECT_EQ(kNumberOfRequests, charactersCache.getNumberOfHits());
+}
@@ -0,0 +1,82 @@
+#include <loginserver/gameserversList.hpp>
+#include <streaming/loginserver/gameserversListResponse.hpp>
+#include <core/network/writeBuffer.hpp>
+#include <core/common/xmlReader.hpp>
+#include <bt/stopwatch.hpp>
+#include <bt/allocationCounter.hpp>
+
+#include <gtest/gtest.h>
+
+using eMU::loginserver::GameserversList;
+using eMU::streaming::loginserver::GameserversListResponse;
+using eMU::core::network::WriteBuffer;
+using eMU::core::common::XmlReader;
+using eMU::bt::env::Stopwatch;
+using eMU::bt::env::AllocationCounter;
+
+class GameserversListBenchmark: public ::testing::Test
+{
+protected:
+    GameserversListBenchmark()
+    {
+        std::string xmlContent = "<servers>";
+
+        for(size_t i = 0; i < kNumberOfServers; ++i)
+        {
+            xmlContent += "<server code=\"" + std::to_string(i) + "\" name=\"eMU_Gameserver_" + std::to_string(i) + "\" address=\"127.0.0.1\" port=\"55901\"/>";
+        }
+
+        xmlContent += "</servers>";
+
+        XmlReader xmlReader(xmlContent);
+        gameserversList_.initialize(xmlReader);
+
+        // write buffer gets its chunk on first insert
+        writeBuffer_.insert(*gameserversList_.getListResponse());
+        writeBuffer_.clear();
+    }
+
+    void append(const eMU::core::network::Payload &payload)
+    {
+        writeBuffer_.insert(payload);
+        bytes_ += writeBuffer_.getPayload().getSize();
+        writeBuffer_.clear();
+    }
+
+    static const size_t kNumberOfServers = 20;
+    static const size_t kNumberOfRequests = 100000;
+
+    GameserversList gameserversList_;
+    WriteBuffer writeBuffer_;
+    size_t bytes_ = 0;
+};
+
+TEST_F(GameserversListBenchmark, encodePerRequest)
+{
+    Stopwatch stopwatch;
+
+    for(size_t i = 0; i < kNumberOfRequests; ++i)
+    {
+        GameserversListResponse response(gameserversList_.getServers());
+        this->append(response.getWriteStream().getPayload());
+    }
+
+    stopwatch.report("gameservers list, encoded per request (20 servers)", kNumberOfRequests, bytes_);
+}
+
+TEST_F(GameserversListBenchmark, preEncodedResponseShouldNotAllocate)
+{
+    AllocationCounter allocationCounter;
+    Stopwatch stopwatch;
+
+    for(size_t i = 0; i < kNumberOfRequests; ++i)
+    {
+        GameserversList::PayloadPointer listResponse = gameserversList_.getListResponse();
+        this->append(*listResponse);
+    }
+
+    size_t numberOfAllocations = allocationCounter.getNumberOfAllocations();
+    stopwatch.report("gameservers list, pre-encoded (20 servers)", kNumberOfRequests, bytes_);
+
+    ASSERT_EQ(0, numberOfAllocations);
+}
@@ -0,0 +1,109 @@
+#include <protocols/streamDispatcher.hpp>
+#include <streaming/writeStream.hpp>
+#include <streaming/readStreamView.hpp>
+#include <bt/stopwatch.hpp>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+using eMU::protocols::StreamDispatcher;
+using eMU::streaming::WriteStream;
+using eMU::streaming::ReadStreamView;
+using eMU::bt::env::Stopwatch;
+
+class DispatchBenchmark: public ::testing::Test
+{
+protected:
+    DispatchBenchmark():
+        counters_(kNumberOfStreamIds + 1, 0)
+    {
+        for(uint16_t i = 1; i <= kNumberOfStreamIds; ++i)
+        {
+            writeStreams_.push_back(WriteStream(kStreamIdBase + i));
+        }
+
+        for(size_t i = 0; i < kNumberOfStreams; ++i)
+        {
+            streams_.push_back(ReadStreamView(writeStreams_[(i * 7) % kNumberOfStreamIds].getPayload()));
+        }
+    }
+
+    // reproduces former comparison chain, ids are checked in registration order
+    bool dispatchIfChain(const ReadStreamView &stream)
+    {
+        uint16_t streamId = stream.getId();
+
+        for(uint16_t i = 1; i <= kNumberOfStreamIds; ++i)
+        {
+            if(streamId == kStreamIdBase + i)
+            {
+                this->handle(i, stream);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void handle(uint16_t index, const ReadStreamView &stream)
+    {
+        counters_[index] += stream.getId();
+    }
+
+    static const uint16_t kStreamIdBase = 0x0136;
+    static const uint16_t kNumberOfStreamIds = 9;
+    static const size_t kNumberOfStreams = 1000;
+    static const size_t kNumberOfIterations = 10000;
+
+    std::vector<WriteStream> writeStreams_;
+    std::vector<ReadStreamView> streams_;
+    std::vector<uint64_t> counters_;
+};
+
+TEST_F(DispatchBenchmark, dispatch)
+{
+    Stopwatch stopwatch;
+
+    for(size_t i = 0; i < kNumberOfIterations; ++i)
+    {
+        for(const auto &stream : streams_)
+        {
+            ASSERT_TRUE(this->dispatchIfChain(stream));
+        }
+    }
+
+    stopwatch.report("if chain dispatch (9 stream ids)", kNumberOfIterations * kNumberOfStreams);
+
+    StreamDispatcher<const ReadStreamView&> dispatcher(kStreamIdBase);
+
+    for(uint16_t i = 1; i <= kNumberOfStreamIds; ++i)
+    {
+        dispatcher.registerHandler(kStreamIdBase + i, [this, i](const ReadStreamView &stream) { this->handle(i, stream); });
+    }
+
+    uint64_t dispatchedStreams = 0;
+
+    for(uint16_t i = 1; i <= kNumberOfStreamIds; ++i)
+    {
+        dispatchedStreams -= dispatcher.getNumberOfHandledStreams(kStreamIdBase + i);
+    }
+
+    stopwatch.restart();
+
+    for(size_t i = 0; i < kNumberOfIterations; ++i)
+    {
+        for(const auto &stream : streams_)
+        {
+            ASSERT_TRUE(dispatcher.dispatch(stream.getId(), stream));
+        }
+    }
+
+    stopwatch.report("table dispatch with metrics (9 stream ids)", kNumberOfIterations * kNumberOfStreams);
+
+    for(uint16_t i = 1; i <= kNumberOfStreamIds; ++i)
+    {
+        dispatchedStreams += dispatcher.getNumberOfHandledStreams(kStreamIdBase + i);
+    }
+
+    ASSERT_EQ(kNumberOfIterations * kNumberOfStreams, dispatchedStreams);
+}
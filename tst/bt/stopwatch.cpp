@@ -0,0 +1,71 @@
+#include <bt/stopwatch.hpp>
+
+#include <iostream>
+#include <iomanip>
+
+namespace eMU
+{
+namespace bt
+{
+namespace env
+{
+
+Stopwatch::Stopwatch():
+    start_(std::chrono::steady_clock::now()),
+    accumulated_(0),
+    paused_(false) {}
+
+void Stopwatch::restart()
+{
+    start_ = std::chrono::steady_clock::now();
+    accumulated_ = std::chrono::steady_clock::duration(0);
+    paused_ = false;
+}
+
+double Stopwatch::getElapsedSeconds() const
+{
+    if(paused_)
+    {
+        return std::chrono::duration<double>(accumulated_).count();
+    }
+
+    return std::chrono::duration<double>(accumulated_ + (std::chrono::steady_clock::now() - start_)).count();
+}
+
+void Stopwatch::pause()
+{
+    if(!paused_)
+    {
+        accumulated_ += std::chrono::steady_clock::now() - start_;
+        paused_ = true;
+    }
+}
+
+void Stopwatch::resume()
+{
+    if(paused_)
+    {
+        start_ = std::chrono::steady_clock::now();
+        paused_ = false;
+    }
+}
+
+void Stopwatch::report(const std::string &name, size_t operations, size_t bytes) const
+{
+    double seconds = this->getElapsedSeconds();
+
+    std::cout << "[ BENCH    ] " << name << ": " << operations << " ops in " << std::fixed << std::setprecision(3) << seconds * 1000 << " ms"
+              << ", " << std::setprecision(0) << operations / seconds << " ops/s"
+              << ", " << std::setprecision(1) << seconds * 1e9 / operations << " ns/op";
+
+    if(bytes > 0)
+    {
+        std::cout << ", " << std::setprecision(1) << bytes / seconds / (1024 * 1024) << " MiB/s";
+    }
+
+    std::cout << std::endl;
+}
+
+}
+}
+}
@@ -0,0 +1,150 @@
+#include <streaming/gameserver/charactersListResponse.hpp>
+#include <streaming/gameserver/streamIds.hpp>
+#include <streaming/writeStream.hpp>
+#include <streaming/readStreamView.hpp>
+#include <bt/stopwatch.hpp>
+
+#include <gtest/gtest.h>
+#include <string.h>
+
+using eMU::streaming::WriteStream;
+using eMU::streaming::ReadStreamView;
+using eMU::streaming::gameserver::CharactersListResponse;
+using eMU::streaming::common::CharacterListInfo;
+using eMU::streaming::common::CharacterInfoContainer;
+using eMU::bt::env::Stopwatch;
+
+class SchemaBenchmark: public ::testing::Test
+{
+protected:
+    SchemaBenchmark():
+        characters_({CharacterListInfo("andrew", 12, 1, 2, 3, 0),
+                     CharacterListInfo("greg", 150, 4, 5, 6, 1),
+                     CharacterListInfo("MightyWarrior", 200, 2, 1, 1, 0),
+                     CharacterListInfo("darkknight", 88, 0, 3, 7, 1),
+                     CharacterListInfo("elf", 1, 3, 0, 0, 0)}) {}
+
+    // reproduces former field by field encoder of characters list response
+    WriteStream encodePerField()
+    {
+        WriteStream writeStream(eMU::streaming::gameserver::streamIds::kCharactersListResponse);
+        writeStream.writeNext<uint32_t>(0);
+        writeStream.writeNext<uint32_t>(0);
+        writeStream.writeNext<uint32_t>(0);
+        writeStream.writeNext<uint16_t>(characters_.size());
+
+        for(const auto &characterInfo : characters_)
+        {
+            writeStream.writeNext<uint32_t>(0);
+            writeStream.writeNext<uint32_t>(characterInfo.name_.length());
+            writeStream.writeNextWideString(characterInfo.name_);
+            writeStream.writeNext<uint8_t>(characterInfo.level_);
+            writeStream.writeNext<uint8_t>(0);
+            writeStream.writeNext<uint8_t>(1);
+            writeStream.writeNext<uint8_t>(characterInfo.race_);
+            writeStream.writeNext<uint16_t>(0);
+            writeStream.writeNext<uint8_t>(characterInfo.hairType_);
+            writeStream.writeNext<uint8_t>(characterInfo.hairColor_);
+            writeStream.writeNext<uint32_t>(0);
+            writeStream.writeNext<uint32_t>(0);
+            writeStream.writeNext<uint16_t>(0);
+            writeStream.writeNext<uint16_t>(characterInfo.tutorialState_);
+        }
+
+        return writeStream;
+    }
+
+    size_t decodePerField(const WriteStream &writeStream)
+    {
+        ReadStreamView readStream(writeStream.getPayload());
+        readStream.readNext<uint32_t>();
+        readStream.readNext<uint32_t>();
+        readStream.readNext<uint32_t>();
+
+        CharacterInfoContainer characters;
+        uint16_t charactersCount = readStream.readNext<uint16_t>();
+
+        for(uint16_t i = 0; i < charactersCount; ++i)
+        {
+            readStream.readNext<uint32_t>();
+            uint32_t characterNameLength = readStream.readNext<uint32_t>();
+
+            CharacterListInfo characterListInfo;
+            characterListInfo.name_ = readStream.readNextWideStringAsUtf8(characterNameLength);
+            characterListInfo.level_ = readStream.readNext<uint8_t>();
+            readStream.readNext<uint8_t>();
+            readStream.readNext<uint8_t>();
+            characterListInfo.race_ = readStream.readNext<uint8_t>();
+            readStream.readNext<uint16_t>();
+            characterListInfo.hairType_ = readStream.readNext<uint8_t>();
+            characterListInfo.hairColor_ = readStream.readNext<uint8_t>();
+            readStream.readNext<uint32_t>();
+            readStream.readNext<uint32_t>();
+            readStream.readNext<uint16_t>();
+            characterListInfo.tutorialState_ = readStream.readNext<uint16_t>();
+
+            characters.push_back(characterListInfo);
+        }
+
+        return characters.size();
+    }
+
+    static const size_t kNumberOfMessages = 200000;
+
+    CharacterInfoContainer characters_;
+};
+
+TEST_F(SchemaBenchmark, encode)
+{
+    size_t bytes = 0;
+    Stopwatch stopwatch;
+
+    for(size_t i = 0; i < kNumberOfMessages; ++i)
+    {
+        bytes += this->encodePerField().getPayload().getSize();
+    }
+
+    stopwatch.report("characters list response encode, field by field (5 characters)", kNumberOfMessages, bytes);
+
+    bytes = 0;
+    stopwatch.restart();
+
+    for(size_t i = 0; i < kNumberOfMessages; ++i)
+    {
+        bytes += CharactersListResponse(characters_).getWriteStream().getPayload().getSize();
+    }
+
+    stopwatch.report("characters list response encode, schema (5 characters)", kNumberOfMessages, bytes);
+
+    WriteStream expectedStream = this->encodePerField();
+    CharactersListResponse response(characters_);
+    const WriteStream &writeStream = response.getWriteStream();
+
+    ASSERT_EQ(expectedStream.getPayload().getSize(), writeStream.getPayload().getSize());
+    ASSERT_EQ(0, memcmp(&expectedStream.getPayload()[0], &writeStream.getPayload()[0], writeStream.getPayload().getSize()));
+}
+
+TEST_F(SchemaBenchmark, decode)
+{
+    WriteStream writeStream = this->encodePerField();
+    size_t numberOfCharacters = 0;
+    Stopwatch stopwatch;
+
+    for(size_t i = 0; i < kNumberOfMessages; ++i)
+    {
+        numberOfCharacters += this->decodePerField(writeStream);
+    }
+
+    stopwatch.report("characters list response decode, field by field (5 characters)", kNumberOfMessages, writeStream.getPayload().getSize() * kNumberOfMessages);
+
+    stopwatch.restart();
+
+    for(size_t i = 0; i < kNumberOfMessages; ++i)
+    {
+        numberOfCharacters -= CharactersListResponse(ReadStreamView(writeStream.getPayload())).getCharacters().size();
+    }
+
+    stopwatch.report("characters list response decode, schema (5 characters)", kNumberOfMessages, writeStream.getPayload().getSize() * kNumberOfMessages);
+
+    ASSERT_EQ(0, numberOfCharacters);
+}
@@ -0,0 +1,155 @@
+#include <streaming/writeStream.hpp>
+#include <streaming/readStreamView.hpp>
+#include <streaming/wideStringCodec.hpp>
+#include <bt/stopwatch.hpp>
+
+#include <boost/locale/encoding_utf.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+using eMU::streaming::WriteStream;
+using eMU::streaming::ReadStreamView;
+using eMU::streaming::WideStringCodec;
+using eMU::bt::env::Stopwatch;
+
+class WideStringBenchmark: public ::testing::Test
+{
+protected:
+    WideStringBenchmark():
+        names_({"andrew", "greg", "eMU_Gameserver_1", "MightyWarrior", "Wizard", "darkknight",
+                "\xC5\xBC\xC3\xB3\xC5\x82w", "Zaj\xC4\x85" "czek", "elf", "BladeMaster"}) {}
+
+    // reproduces former path, names went through std::wstring and were written unit by unit
+    size_t encodePerCharacter()
+    {
+        WriteStream writeStream(0x1234);
+
+        for(const auto &name : names_)
+        {
+            std::wstring wideName = boost::locale::conv::utf_to_utf<std::wstring::value_type>(name);
+            writeStream.writeNext<uint32_t>(wideName.length());
+
+            for(size_t i = 0; i < wideName.length(); ++i)
+            {
+                writeStream.writeNext<char16_t>(wideName[i]);
+            }
+        }
+
+        return writeStream.getPayload().getSize();
+    }
+
+    size_t encodeInBulk()
+    {
+        WriteStream writeStream(0x1234);
+
+        for(const auto &name : names_)
+        {
+            writeStream.writeNext<uint32_t>(WideStringCodec::getEncodedLength(name));
+            writeStream.writeNextWideString(name);
+        }
+
+        return writeStream.getPayload().getSize();
+    }
+
+    size_t decodePerCharacter(const WriteStream &writeStream)
+    {
+        ReadStreamView view(writeStream.getPayload());
+        size_t size = 0;
+
+        for(size_t i = 0; i < names_.size(); ++i)
+        {
+            uint32_t length = view.readNext<uint32_t>();
+            std::wstring wideName;
+
+            for(size_t j = 0; j < length; ++j)
+            {
+                wideName.push_back(view.readNext<char16_t>());
+            }
+
+            size += boost::locale::conv::utf_to_utf<std::string::value_type>(wideName).size();
+        }
+
+        return size;
+    }
+
+    size_t decodeInBulk(const WriteStream &writeStream)
+    {
+        ReadStreamView view(writeStream.getPayload());
+        size_t size = 0;
+
+        for(size_t i = 0; i < names_.size(); ++i)
+        {
+            size += view.readNextWideStringAsUtf8(view.readNext<uint32_t>()).size();
+        }
+
+        return size;
+    }
+
+    WriteStream prepareStream()
+    {
+        WriteStream writeStream(0x1234);
+
+        for(const auto &name : names_)
+        {
+            writeStream.writeNext<uint32_t>(WideStringCodec::getEncodedLength(name));
+            writeStream.writeNextWideString(name);
+        }
+
+        return writeStream;
+    }
+
+    static const size_t kNumberOfMessages = 200000;
+
+    std::vector<std::string> names_;
+};
+
+TEST_F(WideStringBenchmark, encode)
+{
+    size_t bytes = 0;
+    Stopwatch stopwatch;
+
+    for(size_t i = 0; i < kNumberOfMessages; ++i)
+    {
+        bytes += this->encodePerCharacter();
+    }
+
+    stopwatch.report("wide strings encode, per character through std::wstring (10 names)", kNumberOfMessages, bytes);
+
+    bytes = 0;
+    stopwatch.restart();
+
+    for(size_t i = 0; i < kNumberOfMessages; ++i)
+    {
+        bytes += this->encodeInBulk();
+    }
+
+    stopwatch.report("wide strings encode, bulk codec (10 names)", kNumberOfMessages, bytes);
+
+    ASSERT_EQ(this->encodePerCharacter(), this->encodeInBulk());
+}
+
+TEST_F(WideStringBenchmark, decode)
+{
+    WriteStream writeStream = this->prepareStream();
+    size_t bytes = 0;
+    Stopwatch stopwatch;
+
+    for(size_t i = 0; i < kNumberOfMessages; ++i)
+    {
+        bytes += this->decodePerCharacter(writeStream);
+    }
+
+    stopwatch.report("wide strings decode, per character through std::wstring (10 names)", kNumberOfMessages, bytes);
+
+    bytes = 0;
+    stopwatch.restart();
+
+    for(size_t i = 0; i < kNumberOfMessages; ++i)
+    {
+        bytes += this->decodeInBulk(writeStream);
+    }
+
+    stopwatch.report("wide strings decode, bulk codec (10 names)", kNumberOfMessages, bytes);
+
+    ASSERT_EQ(this->decodePerCharacter(writeStream), this->decodeInBulk(writeStream));
+}
@@ -1,30 +1,35 @@
-#include <mt/asioStub/ioService.hpp>
-
-namespace eMU
-{
-namespace mt
-{
-namespace env
-{
-namespace asioStub
-{
-
-io_service::strand::strand(io_service& service)
-{
-
-}
-
-size_t io_service::run()
-{
-    return 0;
-}
-
-void io_service::stop()
-{
-
-}
-
-}
-}
-}
-}
+#include <mt/asioStub/ioService.hpp>
+
+namespace eMU
+{
+namespace mt
+{
+namespace env
+{
+namespace asioStub
+{
+
+io_service::strand::strand(io_service& service)
+{
+
+}
+
+io_service::work::work(io_service& service)
+{
+
+}
+
+size_t io_service::run()
+{
+    return 0;
+}
+
+void io_service::stop()
+{
+
+}
+
+}
+}
+}
+}
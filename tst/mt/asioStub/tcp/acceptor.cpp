@@ -1,34 +1,43 @@
-#include <mt/asioStub/tcp/acceptor.hpp>
-
-namespace eMU
-{
-namespace mt
-{
-namespace env
-{
-namespace asioStub
-{
-namespace ip
-{
-namespace tcp
-{
-
-acceptor::acceptor(io_service &ioService, const boost::asio::ip::tcp::endpoint &endpoint):
-    ioService_(ioService) {}
-
-void acceptor::async_accept(socket &socket, const AcceptHandler &handler)
-{
-
-}
-
-io_service& acceptor::get_io_service()
-{
-    return ioService_;
-}
-
-}
-}
-}
-}
-}
-}
+#include <mt/asioStub/tcp/acceptor.hpp>
+
+namespace eMU
+{
+namespace mt
+{
+namespace env
+{
+namespace asioStub
+{
+namespace ip
+{
+namespace tcp
+{
+
+acceptor::acceptor(io_service &ioService, const boost::asio::ip::tcp::endpoint &endpoint):
+    ioService_(ioService) {}
+
+acceptor::acceptor(io_service &ioService):
+    ioService_(ioService) {}
+
+void acceptor::open(const boost::asio::ip::tcp &protocol) {}
+
+void acceptor::bind(const boost::asio::ip::tcp::endpoint &endpoint) {}
+
+void acceptor::listen() {}
+
+void acceptor::async_accept(socket &socket, const AcceptHandler &handler)
+{
+
+}
+
+io_service& acceptor::get_io_service()
+{
+    return ioService_;
+}
+
+}
+}
+}
+}
+}
+}
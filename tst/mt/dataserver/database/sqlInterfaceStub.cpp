@@ -1,76 +1,121 @@
-#include <mt/dataserver/database/sqlInterfaceStub.hpp>
-
-namespace eMU
-{
-namespace mt
-{
-namespace env
-{
-namespace dataserver
-{
-namespace database
-{
-
-SqlInterfaceStub::SqlInterfaceStub():
-    isAlive_(true) {}
-
-bool SqlInterfaceStub::initialize() { return true; }
-
-bool SqlInterfaceStub::connect(const std::string &hostname, uint16_t port, const std::string &userName,
-                               const std::string &password, const std::string &databaseName) { return true; }
-
-void SqlInterfaceStub::cleanup() {}
-std::string SqlInterfaceStub::getErrorMessage() { return ""; }
-
-bool SqlInterfaceStub::executeQuery(std::string query)
-{
-    EXPECT_FALSE(queriesStatus_.empty()) << "Unexpected database query execution!";
-
-    bool status = queriesStatus_.front();
-    queriesStatus_.pop();
-
-    return status;
-}
-
-eMU::dataserver::database::QueryResult SqlInterfaceStub::fetchQueryResult()
-{
-    EXPECT_FALSE(queriesResult_.empty()) << "No results to fetch!";
-
-    eMU::dataserver::database::QueryResult result = queriesResult_.front();
-    queriesResult_.pop();
-
-    return result;
-}
-
-bool SqlInterfaceStub::isAlive()
-{
-    return isAlive_;
-}
-
-void SqlInterfaceStub::setAlive()
-{
-    isAlive_ = true;
-}
-
-void SqlInterfaceStub::setDied()
-{
-    isAlive_ = false;
-}
-
-void SqlInterfaceStub::pushQueryStatus(bool status)
-{
-    queriesStatus_.push(status);
-}
-
-void SqlInterfaceStub::pushQueryResult(const eMU::dataserver::database::QueryResult &queryResult)
-{
-    queriesResult_.push(queryResult);
-}
-
-
-}
-}
-}
-}
-}
-
+#include <mt/dataserver/database/sqlInterfaceStub.hpp>
+
+#include <thread>
+
+namespace eMU
+{
+namespace mt
+{
+namespace env
+{
+namespace dataserver
+{
+namespace database
+{
+
+SqlInterfaceStub::SqlInterfaceStub():
+    isAlive_(true),
+    latency_(0),
+    numberOfRoundTrips_(0) {}
+
+bool SqlInterfaceStub::initialize() { return true; }
+
+bool SqlInterfaceStub::connect(const std::string &hostname, uint16_t port, const std::string &userName,
+                               const std::string &password, const std::string &databaseName) { return true; }
+
+void SqlInterfaceStub::cleanup() {}
+std::string SqlInterfaceStub::getErrorMessage() { return ""; }
+
+bool SqlInterfaceStub::executeQuery(std::string query)
+{
+    EXPECT_FALSE(queriesStatus_.empty()) << "Unexpected database query execution!";
+    this->roundTrip();
+
+    bool status = queriesStatus_.front();
+    queriesStatus_.pop();
+
+    return status;
+}
+
+bool SqlInterfaceStub::executeStatement(eMU::dataserver::database::Statement::Id statementId,
+                                        const eMU::dataserver::database::Statement::Parameters &parameters)
+{
+    EXPECT_EQ(eMU::dataserver::database::Statement::getNumberOfParameters(statementId), parameters.size());
+
+    return this->executeQuery(eMU::dataserver::database::Statement::getText(statementId));
+}
+
+eMU::dataserver::database::QueryResult SqlInterfaceStub::fetchQueryResult()
+{
+    EXPECT_FALSE(queriesResult_.empty()) << "No results to fetch!";
+
+    eMU::dataserver::database::QueryResult result = queriesResult_.front();
+    queriesResult_.pop();
+
+    return result;
+}
+
+bool SqlInterfaceStub::isAlive()
+{
+    this->roundTrip();
+    return isAlive_;
+}
+
+bool SqlInterfaceStub::isConnected()
+{
+    return isAlive_;
+}
+
+bool SqlInterfaceStub::reconnect()
+{
+    this->roundTrip();
+    return isAlive_;
+}
+
+void SqlInterfaceStub::setAlive()
+{
+    isAlive_ = true;
+}
+
+void SqlInterfaceStub::setDied()
+{
+    isAlive_ = false;
+}
+
+void SqlInterfaceStub::setLatency(std::chrono::microseconds latency)
+{
+    latency_ = latency;
+}
+
+size_t SqlInterfaceStub::getNumberOfRoundTrips() const
+{
+    return numberOfRoundTrips_;
+}
+
+void SqlInterfaceStub::roundTrip()
+{
+    ++numberOfRoundTrips_;
+
+    if(latency_.count() > 0)
+    {
+        std::this_thread::sleep_for(latency_);
+    }
+}
+
+void SqlInterfaceStub::pushQueryStatus(bool status)
+{
+    queriesStatus_.push(status);
+}
+
+void SqlInterfaceStub::pushQueryResult(const eMU::dataserver::database::QueryResult &queryResult)
+{
+    queriesResult_.push(queryResult);
+}
+
+
+}
+}
+}
+}
+}
+
@@ -22,7 +22,6 @@
 using eMU::dataserver::Context;
 using eMU::dataserver::Protocol;
 using eMU::dataserver::database::QueryResult;
-using eMU::dataserver::database::Row;
 using eMU::core::network::tcp::Connection;
 using eMU::core::network::tcp::NetworkUser;
 using eMU::core::network::Payload;
@@ -53,7 +52,7 @@ protected:
     void SetUp()
     {
         connection_->accept();
-        ASSERT_EQ(1, dataserverContext_.getUsersFactory().getObjects().size());
+        ASSERT_EQ(1, dataserverContext_.getUsersFactory().size());
     }
 
     void TearDown()
@@ -61,7 +60,7 @@ protected:
         ASSERT_FALSE(connection_->getSocket().isUnread());
 
         connection_->getSocket().disconnect();
-        ASSERT_EQ(0, dataserverContext_.getUsersFactory().getObjects().size());
+        ASSERT_EQ(0, dataserverContext_.getUsersFactory().size());
     }
 
     void faultIndicationDueToQueryExecutionFailScenario(const Payload &payload)
@@ -107,9 +106,9 @@ protected:
 TEST_F(DataserverTest, CheckAccountShouldBeSuccesful)
 {
     QueryResult queryResult;
-    Row &row = queryResult.createRow(Row::Fields());
+    queryResult.createRow();
     CheckAccountResult checkAccountResult = CheckAccountResult::AccountInUse;
-    row.insert(boost::lexical_cast<Row::Value>(static_cast<uint32_t>(checkAccountResult)));
+    queryResult.insert(std::to_string(static_cast<uint32_t>(checkAccountResult)));
 
     sqlInterface_.pushQueryResult(queryResult);
     sqlInterface_.pushQueryStatus(true);
@@ -166,6 +165,87 @@ TEST_F(DataserverTest, CharactersList)
     ASSERT_TRUE(response.getCharacters().empty());
 }
 
+TEST_F(DataserverTest, CharactersListShouldBeSelectedInBatchWhenBatchingIsEnabled)
+{
+    dataserverContext_.getCharactersListBatcher().configure(8, std::chrono::microseconds(0));
+
+    QueryResult queryResult({{"accountId", 0}, {"hairColor", 1}, {"hairType", 2}, {"level", 3}, {"name", 4}, {"race", 5}, {"tutorialState", 6}});
+    queryResult.createRow();
+    queryResult.insert("mu2emu"); queryResult.insert("1"); queryResult.insert("2"); queryResult.insert("150"); queryResult.insert("knight"); queryResult.insert("3"); queryResult.insert("0");
+
+    sqlInterface_.pushQueryResult(queryResult);
+    sqlInterface_.pushQueryStatus(true);
+
+    IO_CHECK(connection_->getSocket().send(CharactersListRequest(userHash_, "mu2emu").getWriteStream().getPayload()));
+
+    ASSERT_TRUE(connection_->getSocket().isUnread());
+    const ReadStream &readStream = connection_->getSocket().receive();
+    ASSERT_EQ(streamIds::kCharactersListResponse, readStream.getId());
+
+    CharactersListResponse response(readStream);
+    ASSERT_EQ(userHash_, response.getUserHash());
+    ASSERT_EQ(1, response.getCharacters().size());
+    EXPECT_EQ("knight", response.getCharacters()[0].name_);
+    EXPECT_EQ(150, response.getCharacters()[0].level_);
+
+    EXPECT_EQ(1, dataserverContext_.getCharactersListBatcher().getNumberOfBatches());
+}
+
+TEST_F(DataserverTest, RepeatedCharactersListShouldBeServedFromCacheUntilCharacterIsCreated)
+{
+    dataserverContext_.getCharactersCache().configure(1024 * 1024, std::chrono::minutes(1));
+
+    QueryResult queryResult({{"hairColor", 0}, {"hairType", 1}, {"level", 2}, {"name", 3}, {"race", 4}, {"tutorialState", 5}});
+    queryResult.createRow();
+    queryResult.insert("1"); queryResult.insert("2"); queryResult.insert("150"); queryResult.insert("knight"); queryResult.insert("3"); queryResult.insert("0");
+
+    sqlInterface_.pushQueryResult(queryResult);
+    sqlInterface_.pushQueryStatus(true);
+
+    for(size_t i = 0; i < 2; ++i)
+    {
+        IO_CHECK(connection_->getSocket().send(CharactersListRequest(userHash_, "mu2emu").getWriteStream().getPayload()));
+
+        ASSERT_TRUE(connection_->getSocket().isUnread());
+        const ReadStream &readStream = connection_->getSocket().receive();
+        ASSERT_EQ(streamIds::kCharactersListResponse, readStream.getId());
+
+        CharactersListResponse response(readStream);
+        ASSERT_EQ(1, response.getCharacters().size());
+        EXPECT_EQ("knight", response.getCharacters()[0].name_);
+    }
+
+    EXPECT_EQ(1, dataserverContext_.getCharactersCache().getNumberOfHits());
+    EXPECT_EQ(1, dataserverContext_.getCharactersCache().getNumberOfMisses());
+
+    QueryResult createResult;
+    createResult.createRow();
+    createResult.insert(std::to_string(static_cast<uint32_t>(CharacterCreateResult::Succeed)));
+
+    sqlInterface_.pushQueryResult(createResult);
+    sqlInterface_.pushQueryStatus(true);
+
+    IO_CHECK(connection_->getSocket().send(CharacterCreateRequest(userHash_, "MU2EMU",
+                                                                  CharacterViewInfo("mu2c", 2, 4, 6,
+                                                                                      8, 9, 11, 13, 15)).getWriteStream().getPayload()));
+
+    ASSERT_TRUE(connection_->getSocket().isUnread());
+    ASSERT_EQ(streamIds::kCharacterCreateResponse, ReadStream(connection_->getSocket().receive()).getId());
+
+    sqlInterface_.pushQueryResult(QueryResult());
+    sqlInterface_.pushQueryStatus(true);
+
+    IO_CHECK(connection_->getSocket().send(CharactersListRequest(userHash_, "mu2emu").getWriteStream().getPayload()));
+
+    ASSERT_TRUE(connection_->getSocket().isUnread());
+    const ReadStream &readStream = connection_->getSocket().receive();
+    ASSERT_EQ(streamIds::kCharactersListResponse, readStream.getId());
+    EXPECT_TRUE(CharactersListResponse(readStream).getCharacters().empty());
+
+    EXPECT_EQ(1, dataserverContext_.getCharactersCache().getNumberOfInvalidations());
+    EXPECT_EQ(2, dataserverContext_.getCharactersCache().getNumberOfMisses());
+}
+
 TEST_F(DataserverTest, CharacterCreateRequest_QueryExecutionFailTriggersFaultIndication)
 {
     faultIndicationDueToQueryExecutionFailScenario(CharacterCreateRequest(userHash_, "acc",
@@ -190,9 +270,9 @@ TEST_F(DataserverTest, CharacterCreateRequest_WhenConnectionToDatabaseIsDiedThen
 TEST_F(DataserverTest, CharacterCreate)
 {
     QueryResult queryResult;
-    Row &row = queryResult.createRow(Row::Fields());
+    queryResult.createRow();
     CharacterCreateResult result = CharacterCreateResult::Succeed;
-    row.insert(boost::lexical_cast<Row::Value>(static_cast<uint32_t>(result)));
+    queryResult.insert(std::to_string(static_cast<uint32_t>(result)));
 
     sqlInterface_.pushQueryResult(queryResult);
     sqlInterface_.pushQueryStatus(true);
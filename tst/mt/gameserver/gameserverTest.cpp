@@ -20,6 +20,7 @@
 #include <streaming/dataserver/characterCreateRequest.hpp>
 #include <streaming/dataserver/characterCreateResponse.hpp>
 #include <streaming/dataserver/streamIds.hpp>
+#include <streaming/readStream.hpp>
 
 #include <mt/asioStub/ioService.hpp>
 #include <mt/check.hpp>
@@ -64,7 +65,7 @@ protected:
 
         registerUserScenario(UserRegistrationResult::Succeed);
         connection_->accept();
-        ASSERT_EQ(1, gameserverContext_.getUsersFactory().getObjects().size());
+        ASSERT_EQ(1, gameserverContext_.getUsersFactory().size());
     }
 
     void prepareDataserverConnection()
@@ -112,7 +113,7 @@ protected:
         ASSERT_FALSE(gameserverContext_.getUdpConnection()->getSocket().isUnread());
 
         connection_->disconnect();
-        ASSERT_EQ(0, gameserverContext_.getUsersFactory().getObjects().size());
+        ASSERT_EQ(0, gameserverContext_.getUsersFactory().size());
 
         gameserverContext_.getUdpConnection()->unregisterConnection();
     }
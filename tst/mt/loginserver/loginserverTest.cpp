@@ -23,6 +23,8 @@
 #include <streaming/gameserver/streamIds.hpp>
 #include <streaming/gameserver/registerUserRequest.hpp>
 #include <streaming/gameserver/registerUserResponse.hpp>
+#include <streaming/gameserver/loadIndication.hpp>
+#include <streaming/readStream.hpp>
 
 #include <gtest/gtest.h>
 
@@ -49,6 +51,7 @@ using eMU::streaming::dataserver::FaultIndication;
 using eMU::streaming::gameserver::RegisterUserRequest;
 using eMU::streaming::gameserver::RegisterUserResponse;
 using eMU::streaming::gameserver::UserRegistrationResult;
+using eMU::streaming::gameserver::LoadIndication;
 
 class LoginserverTest: public ::testing::Test
 {
@@ -68,7 +71,7 @@ protected:
         prepareUdpConnection();
 
         connection_->accept();
-        ASSERT_EQ(1, loginserverContext_.getUsersFactory().getObjects().size());
+        ASSERT_EQ(1, loginserverContext_.getUsersFactory().size());
     }
 
     void initializeGameserversList()
@@ -155,7 +158,7 @@ protected:
         ASSERT_FALSE(loginserverContext_.getUdpConnection()->getSocket().isUnread());
 
         connection_->getSocket().disconnect();
-        ASSERT_EQ(0, loginserverContext_.getUsersFactory().getObjects().size());
+        ASSERT_EQ(0, loginserverContext_.getUsersFactory().size());
 
         loginserverContext_.getUdpConnection()->unregisterConnection();
     }
@@ -237,7 +240,7 @@ TEST_F(LoginserverTest, WhenUserRegistrationResultIsFailedThenConnectionShouldBe
     gameserverDetailsScenario(loginserverContext_.getUsersFactory().getObjects().back()->getHash(), UserRegistrationResult::Failed);
 
     ASSERT_FALSE(connection_->isOpen());
-    ASSERT_EQ(0, loginserverContext_.getUsersFactory().getObjects().size());
+    ASSERT_EQ(0, loginserverContext_.getUsersFactory().size());
 }
 
 TEST_F(LoginserverTest, WhenUserRegistrationResultProvidedInvalidUserHashThenNothingHappens)
@@ -245,5 +248,19 @@ TEST_F(LoginserverTest, WhenUserRegistrationResultProvidedInvalidUserHashThenNot
     gameserverDetailsScenario(NetworkUser::Hash(0x5317), UserRegistrationResult::Failed);
 
     ASSERT_TRUE(connection_->isOpen());
-    ASSERT_EQ(1, loginserverContext_.getUsersFactory().getObjects().size());
+    ASSERT_EQ(1, loginserverContext_.getUsersFactory().size());
+}
+
+TEST_F(LoginserverTest, WhenLoadIndicationReceivedThenLoadShouldBeAdvertisedInGameserversList)
+{
+    IO_CHECK(loginserverContext_.getUdpConnection()->getSocket().send(LoadIndication(1, 30, 120).getWriteStream().getPayload()));
+
+    IO_CHECK(connection_->getSocket().send(GameserversListRequest().getWriteStream().getPayload()));
+
+    ASSERT_TRUE(connection_->getSocket().isUnread());
+    GameserversListResponse response(connection_->getSocket().receive());
+
+    ASSERT_EQ(2, response.getServers().size());
+    ASSERT_EQ(0, response.getServers()[0].load_);
+    ASSERT_EQ(25, response.getServers()[1].load_);
 }
@@ -1,24 +1,26 @@
-#include <ut/asioStub/ioService.hpp>
-
-namespace eMU
-{
-namespace ut
-{
-namespace env
-{
-namespace asioStub
-{
-
-io_service::strand::strand(io_service& service) {}
-
-size_t io_service::run()
-{
-    return 0;
-}
-
-void io_service::stop() {}
-
-}
-}
-}
-}
+#include <ut/asioStub/ioService.hpp>
+
+namespace eMU
+{
+namespace ut
+{
+namespace env
+{
+namespace asioStub
+{
+
+io_service::strand::strand(io_service& service) {}
+
+io_service::work::work(io_service& service) {}
+
+size_t io_service::run()
+{
+    return 0;
+}
+
+void io_service::stop() {}
+
+}
+}
+}
+}
@@ -1,29 +1,38 @@
-#include <ut/asioStub/tcp/acceptor.hpp>
-
-namespace eMU
-{
-namespace ut
-{
-namespace env
-{
-namespace asioStub
-{
-namespace ip
-{
-namespace tcp
-{
-
-acceptor::acceptor(io_service &ioService, const boost::asio::ip::tcp::endpoint &endpoint):
-    ioService_(ioService) {}
-
-io_service& acceptor::get_io_service()
-{
-    return ioService_;
-}
-
-}
-}
-}
-}
-}
-}
+#include <ut/asioStub/tcp/acceptor.hpp>
+
+namespace eMU
+{
+namespace ut
+{
+namespace env
+{
+namespace asioStub
+{
+namespace ip
+{
+namespace tcp
+{
+
+acceptor::acceptor(io_service &ioService, const boost::asio::ip::tcp::endpoint &endpoint):
+    ioService_(ioService) {}
+
+acceptor::acceptor(io_service &ioService):
+    ioService_(ioService) {}
+
+void acceptor::open(const boost::asio::ip::tcp &protocol) {}
+
+void acceptor::bind(const boost::asio::ip::tcp::endpoint &endpoint) {}
+
+void acceptor::listen() {}
+
+io_service& acceptor::get_io_service()
+{
+    return ioService_;
+}
+
+}
+}
+}
+}
+}
+}
@@ -0,0 +1,103 @@
+#define eMU_LOG_MIN_SEVERITY debug
+
+#include <core/common/asyncLogger.hpp>
+
+#include <boost/log/core.hpp>
+#include <boost/log/sinks/sync_frontend.hpp>
+#include <boost/log/sinks/text_ostream_backend.hpp>
+#include <boost/make_shared.hpp>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+using eMU::core::common::AsyncLogger;
+
+class AsyncLoggerTest: public ::testing::Test
+{
+protected:
+    typedef boost::log::sinks::synchronous_sink<boost::log::sinks::text_ostream_backend> Sink;
+
+    AsyncLoggerTest():
+        stream_(boost::make_shared<std::ostringstream>()),
+        sink_(boost::make_shared<Sink>())
+    {
+        AsyncLogger::getInstance().flush();
+
+        sink_->locked_backend()->add_stream(stream_);
+        boost::log::core::get()->add_sink(sink_);
+    }
+
+    ~AsyncLoggerTest()
+    {
+        boost::log::core::get()->remove_sink(sink_);
+    }
+
+    std::string getOutput()
+    {
+        AsyncLogger::getInstance().flush();
+        sink_->flush();
+
+        return stream_->str();
+    }
+
+    std::string getLocation(int line)
+    {
+        std::ostringstream location;
+        location << "[" << __FILE__ << ":" << line << "] ";
+
+        return location.str();
+    }
+
+    boost::shared_ptr<std::ostringstream> stream_;
+    boost::shared_ptr<Sink> sink_;
+};
+
+TEST_F(AsyncLoggerTest, ArgumentsShouldBeFormattedAsInStream)
+{
+    std::string text = "text";
+    uint8_t character = 'x';
+
+    int line = __LINE__; eMU_LOG(info) << text << ", " << -12 << ", " << 34u << ", " << character << ", " << 1.5 << ", " << true << ", " << 'c';
+
+    ASSERT_EQ(this->getLocation(line) + "text, -12, 34, x, 1.5, 1, c\n", this->getOutput());
+}
+
+TEST_F(AsyncLoggerTest, LongRecordShouldBeTruncated)
+{
+    std::string text(1000, 'a');
+
+    eMU_LOG(info) << "text: " << text << ", rest: " << 5;
+
+    std::string output = this->getOutput();
+
+    ASSERT_GT(text.length(), output.length());
+    ASSERT_EQ(std::string(20, 'a') + "...\n", output.substr(output.length() - 24));
+}
+
+TEST_F(AsyncLoggerTest, RecordsBelowMinimalSeverityShouldNotEvaluateArguments)
+{
+    size_t numberOfCalls = 0;
+    auto argument = [&numberOfCalls]() { return ++numberOfCalls; };
+
+    eMU_LOG(trace) << argument();
+    eMU_LOG(debug) << argument();
+
+    ASSERT_EQ(1, numberOfCalls);
+}
+
+TEST_F(AsyncLoggerTest, RecordsShouldBeWrittenWhenRingIsFull)
+{
+    uint64_t numberOfWrittenRecords = AsyncLogger::getInstance().getNumberOfWrittenRecords();
+    uint64_t numberOfSynchronousRecords = AsyncLogger::getInstance().getNumberOfSynchronousRecords();
+
+    for(size_t i = 0; i < 3000; ++i)
+    {
+        eMU_LOG(debug) << "record: " << i;
+    }
+
+    std::string output = this->getOutput();
+
+    ASSERT_EQ(3000, AsyncLogger::getInstance().getNumberOfWrittenRecords() - numberOfWrittenRecords
+                    + AsyncLogger::getInstance().getNumberOfSynchronousRecords() - numberOfSynchronousRecords);
+    ASSERT_NE(std::string::npos, output.find("record: 2999\n"));
+}
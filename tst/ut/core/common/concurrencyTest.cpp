@@ -0,0 +1,49 @@
+#include <core/common/concurrency.hpp>
+
+#include <gtest/gtest.h>
+
+using eMU::core::common::Concurrency;
+using eMU::ut::env::asioStub::io_service;
+
+class ConcurrencyTest: public ::testing::Test
+{
+protected:
+    io_service ioService_;
+};
+
+TEST_F(ConcurrencyTest, sharedModelShouldHandOutTheSameIoService)
+{
+    Concurrency concurrency(ioService_, 4);
+
+    EXPECT_EQ(Concurrency::Model::SHARED_IO_SERVICE, concurrency.getModel());
+    ASSERT_EQ(1, concurrency.getNumberOfIoServices());
+
+    for(size_t i = 0; i < 8; ++i)
+    {
+        EXPECT_EQ(&ioService_, &concurrency.getNextIoService());
+    }
+}
+
+TEST_F(ConcurrencyTest, ioServicePerThreadModelShouldCreateIoServiceForEachThread)
+{
+    Concurrency concurrency(ioService_, 4, Concurrency::Model::IO_SERVICE_PER_THREAD);
+
+    ASSERT_EQ(4, concurrency.getNumberOfIoServices());
+    EXPECT_EQ(&ioService_, &concurrency.getIoService(0));
+
+    for(size_t i = 1; i < concurrency.getNumberOfIoServices(); ++i)
+    {
+        EXPECT_NE(&ioService_, &concurrency.getIoService(i));
+        EXPECT_NE(&concurrency.getIoService(i - 1), &concurrency.getIoService(i));
+    }
+}
+
+TEST_F(ConcurrencyTest, ioServicesShouldBeHandedOutRoundRobin)
+{
+    Concurrency concurrency(ioService_, 3, Concurrency::Model::IO_SERVICE_PER_THREAD);
+
+    for(size_t i = 0; i < 2 * concurrency.getNumberOfIoServices(); ++i)
+    {
+        EXPECT_EQ(&concurrency.getIoService(i % concurrency.getNumberOfIoServices()), &concurrency.getNextIoService());
+    }
+}
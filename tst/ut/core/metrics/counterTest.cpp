@@ -0,0 +1,55 @@
+#include <core/metrics/counter.hpp>
+#include <core/metrics/gauge.hpp>
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using eMU::core::metrics::Counter;
+using eMU::core::metrics::Gauge;
+
+TEST(CounterTest, incrementsShouldBeSummedAcrossThreads)
+{
+    Counter counter;
+    std::vector<std::thread> threads;
+
+    for(size_t i = 0; i < 2 * Counter::kNumberOfShards; ++i)
+    {
+        threads.push_back(std::thread([&counter]()
+        {
+            for(size_t j = 0; j < 1000; ++j)
+            {
+                counter.increment();
+            }
+
+            counter.increment(5);
+        }));
+    }
+
+    for(auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(2 * Counter::kNumberOfShards * 1005, counter.getValue());
+}
+
+TEST(CounterTest, newCounterShouldBeZero)
+{
+    Counter counter;
+
+    ASSERT_EQ(0, counter.getValue());
+}
+
+TEST(GaugeTest, valueCanGoBothWays)
+{
+    Gauge gauge;
+
+    gauge.increment();
+    gauge.increment();
+    gauge.decrement();
+    ASSERT_EQ(1, gauge.getValue());
+
+    gauge.set(-10);
+    ASSERT_EQ(-10, gauge.getValue());
+}
@@ -0,0 +1,60 @@
+#include <core/metrics/histogram.hpp>
+
+#include <gtest/gtest.h>
+
+using eMU::core::metrics::Histogram;
+
+TEST(HistogramTest, smallValuesShouldBeExact)
+{
+    for(uint64_t value = 0; value < Histogram::kSubBucketCount; ++value)
+    {
+        ASSERT_EQ(value, Histogram::getBucketUpperBound(Histogram::getBucketIndex(value)));
+    }
+}
+
+TEST(HistogramTest, bucketShouldBoundValueWithLimitedRelativeError)
+{
+    const uint64_t values[] = {8, 9, 15, 16, 17, 100, 1000, 123456, 1ull << 40, (1ull << 40) + 12345, ~0ull};
+
+    for(uint64_t value : values)
+    {
+        size_t index = Histogram::getBucketIndex(value);
+        uint64_t upperBound = Histogram::getBucketUpperBound(index);
+
+        ASSERT_LT(index, Histogram::kNumberOfBuckets);
+        ASSERT_GE(upperBound, value);
+        ASSERT_LE(upperBound - value, value / Histogram::kSubBucketCount);
+    }
+}
+
+TEST(HistogramTest, bucketsShouldBeOrdered)
+{
+    for(size_t i = 1; i < Histogram::kNumberOfBuckets; ++i)
+    {
+        ASSERT_LT(Histogram::getBucketUpperBound(i - 1), Histogram::getBucketUpperBound(i));
+        ASSERT_EQ(i, Histogram::getBucketIndex(Histogram::getBucketUpperBound(i)));
+    }
+}
+
+TEST(HistogramTest, percentilesShouldFollowRecordedValues)
+{
+    Histogram histogram;
+
+    ASSERT_EQ(0, histogram.getValueAtPercentile(50));
+
+    for(uint64_t value = 1; value <= 1000; ++value)
+    {
+        histogram.record(value);
+    }
+
+    ASSERT_EQ(1000, histogram.getCount());
+    ASSERT_EQ(500500, histogram.getSum());
+    ASSERT_EQ(1000, histogram.getMax());
+
+    uint64_t median = histogram.getValueAtPercentile(50);
+    ASSERT_GE(median, 500);
+    ASSERT_LE(median, 500 + 500 / Histogram::kSubBucketCount);
+
+    ASSERT_EQ(1000, histogram.getValueAtPercentile(100));
+    ASSERT_EQ(1, histogram.getValueAtPercentile(0));
+}
@@ -0,0 +1,55 @@
+#include <core/metrics/registry.hpp>
+
+#include <gtest/gtest.h>
+
+using eMU::core::metrics::Registry;
+
+class RegistryTest: public ::testing::Test
+{
+protected:
+    Registry registry_;
+};
+
+TEST_F(RegistryTest, sameNameAndLabelsShouldYieldSameMetric)
+{
+    ASSERT_EQ(&registry_.getCounter("requests_total", "Requests."), &registry_.getCounter("requests_total", "Requests."));
+    ASSERT_NE(&registry_.getCounter("requests_total", "Requests.", "kind=\"a\""), &registry_.getCounter("requests_total", "Requests.", "kind=\"b\""));
+    ASSERT_EQ(&registry_.getHistogram("latency", "Latency."), &registry_.getHistogram("latency", "Latency."));
+}
+
+TEST_F(RegistryTest, countersAndGaugesShouldBeFormatted)
+{
+    registry_.getCounter("requests_total", "Handled requests.", "kind=\"a\"").increment(3);
+    registry_.getCounter("requests_total", "Handled requests.", "kind=\"b\"").increment();
+    registry_.getGauge("connections", "Open connections.").set(7);
+    registry_.addGaugeCallback("queue_depth", "Queued jobs.", []() { return 12; });
+
+    std::string expectedText = "# HELP connections Open connections.\n"
+                               "# TYPE connections gauge\n"
+                               "connections 7\n"
+                               "# HELP queue_depth Queued jobs.\n"
+                               "# TYPE queue_depth gauge\n"
+                               "queue_depth 12\n"
+                               "# HELP requests_total Handled requests.\n"
+                               "# TYPE requests_total counter\n"
+                               "requests_total{kind=\"a\"} 3\n"
+                               "requests_total{kind=\"b\"} 1\n";
+
+    ASSERT_EQ(expectedText, registry_.format());
+}
+
+TEST_F(RegistryTest, histogramShouldBeFormattedAsSummary)
+{
+    registry_.getHistogram("latency", "Handling time.", "stream_id=\"5\"").record(4);
+
+    std::string expectedText = "# HELP latency Handling time.\n"
+                               "# TYPE latency summary\n"
+                               "latency{stream_id=\"5\",quantile=\"0.5\"} 4\n"
+                               "latency{stream_id=\"5\",quantile=\"0.9\"} 4\n"
+                               "latency{stream_id=\"5\",quantile=\"0.99\"} 4\n"
+                               "latency{stream_id=\"5\",quantile=\"0.999\"} 4\n"
+                               "latency_sum{stream_id=\"5\"} 4\n"
+                               "latency_count{stream_id=\"5\"} 1\n";
+
+    ASSERT_EQ(expectedText, registry_.format());
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <core/network/payloadPool.hpp>
+#include <core/network/payload.hpp>
+
+using eMU::core::network::PayloadPool;
+using eMU::core::network::Payload;
+
+class PayloadPoolTest: public ::testing::Test
+{
+protected:
+    PayloadPoolTest():
+        pool_(PayloadPool::getThreadInstance()) {}
+
+    PayloadPool &pool_;
+};
+
+TEST_F(PayloadPoolTest, releasedChunkShouldBeReused)
+{
+    uint8_t *chunk = pool_.acquire();
+    size_t numberOfAllocatedChunks = pool_.getNumberOfAllocatedChunks();
+
+    PayloadPool::release(chunk);
+
+    ASSERT_EQ(chunk, pool_.acquire());
+    ASSERT_EQ(numberOfAllocatedChunks, pool_.getNumberOfAllocatedChunks());
+
+    PayloadPool::release(chunk);
+}
+
+TEST_F(PayloadPoolTest, largePayloadShouldReturnChunkToPoolOnDestruction)
+{
+    size_t numberOfCachedChunks = pool_.getNumberOfCachedChunks();
+
+    {
+        Payload payload;
+        payload.setSize(Payload::getMaxSize());
+    }
+
+    ASSERT_LE(numberOfCachedChunks, pool_.getNumberOfCachedChunks());
+
+    size_t numberOfAllocatedChunks = pool_.getNumberOfAllocatedChunks();
+
+    for(size_t i = 0; i < 100; ++i)
+    {
+        Payload payload;
+        payload.setSize(Payload::getMaxSize());
+    }
+
+    ASSERT_EQ(numberOfAllocatedChunks, pool_.getNumberOfAllocatedChunks());
+}
+
+TEST_F(PayloadPoolTest, numberOfCachedChunksShouldBeLimited)
+{
+    std::vector<uint8_t*> chunks;
+
+    for(size_t i = 0; i < PayloadPool::getMaxNumberOfCachedChunks() + 1; ++i)
+    {
+        chunks.push_back(pool_.acquire());
+    }
+
+    for(uint8_t *chunk : chunks)
+    {
+        PayloadPool::release(chunk);
+    }
+
+    ASSERT_EQ(PayloadPool::getMaxNumberOfCachedChunks(), pool_.getNumberOfCachedChunks());
+}
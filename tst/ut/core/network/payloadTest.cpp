@@ -1,36 +1,106 @@
-#include <gtest/gtest.h>
-
-#include <core/network/payload.hpp>
-
-using eMU::core::network::Payload;
-
-class PayloadTest: public ::testing::Test
-{
-protected:
-    PayloadTest() {}
-
-    Payload payload_;
-};
-
-TEST_F(PayloadTest, checkMaxSize)
-{
-    ASSERT_EQ(4096, Payload::getMaxSize());
-}
-
-TEST_F(PayloadTest, empty)
-{
-    ASSERT_TRUE(payload_.empty());
-
-    payload_.setSize(1);
-    ASSERT_FALSE(payload_.empty());
-}
-
-TEST_F(PayloadTest, setSizeShouldThrowExceptionWhenValueIsOutOfBound)
-{
-    ASSERT_THROW(payload_.setSize(Payload::getMaxSize() + 1), Payload::SizeOutOfBoundException);
-}
-
-TEST_F(PayloadTest, construct)
-{
-    ASSERT_EQ(0, payload_.getSize());
-}
+#include <gtest/gtest.h>
+
+#include <core/network/payload.hpp>
+
+using eMU::core::network::Payload;
+
+class PayloadTest: public ::testing::Test
+{
+protected:
+    PayloadTest() {}
+
+    Payload payload_;
+};
+
+TEST_F(PayloadTest, checkMaxSize)
+{
+    ASSERT_EQ(4096, Payload::getMaxSize());
+}
+
+TEST_F(PayloadTest, empty)
+{
+    ASSERT_TRUE(payload_.empty());
+
+    payload_.setSize(1);
+    ASSERT_FALSE(payload_.empty());
+}
+
+TEST_F(PayloadTest, setSizeShouldThrowExceptionWhenValueIsOutOfBound)
+{
+    ASSERT_THROW(payload_.setSize(Payload::getMaxSize() + 1), Payload::SizeOutOfBoundException);
+}
+
+TEST_F(PayloadTest, construct)
+{
+    ASSERT_EQ(0, payload_.getSize());
+}
+
+TEST_F(PayloadTest, smallPayloadShouldUseInlineCapacity)
+{
+    payload_.setSize(Payload::getInlineCapacity());
+
+    ASSERT_EQ(Payload::getInlineCapacity(), payload_.getCapacity());
+}
+
+TEST_F(PayloadTest, writingBeyondInlineCapacityShouldKeepAlreadyWrittenBytes)
+{
+    for(size_t i = 0; i < Payload::getMaxSize(); ++i)
+    {
+        payload_[i] = static_cast<uint8_t>(i);
+    }
+
+    payload_.setSize(Payload::getMaxSize());
+
+    ASSERT_EQ(Payload::getMaxSize(), payload_.getCapacity());
+
+    for(size_t i = 0; i < Payload::getMaxSize(); ++i)
+    {
+        ASSERT_EQ(static_cast<uint8_t>(i), payload_[i]);
+    }
+}
+
+TEST_F(PayloadTest, clearShouldOnlyResetSize)
+{
+    payload_.setSize(Payload::getMaxSize());
+    const uint8_t *data = &payload_[0];
+
+    payload_.clear();
+
+    ASSERT_TRUE(payload_.empty());
+    ASSERT_EQ(Payload::getMaxSize(), payload_.getCapacity());
+    ASSERT_EQ(data, &payload_[0]);
+}
+
+TEST_F(PayloadTest, copyShouldContainOnlyUsedBytes)
+{
+    payload_.reserve(Payload::getMaxSize());
+    payload_[0] = 0x10;
+    payload_[1] = 0x20;
+    payload_.setSize(2);
+
+    Payload copy(payload_);
+
+    ASSERT_EQ(2, copy.getSize());
+    ASSERT_EQ(Payload::getInlineCapacity(), copy.getCapacity());
+    ASSERT_EQ(0x10, copy[0]);
+    ASSERT_EQ(0x20, copy[1]);
+}
+
+TEST_F(PayloadTest, moveShouldTakeOverLargeBuffer)
+{
+    payload_.setSize(Payload::getMaxSize());
+    payload_[Payload::getMaxSize() - 1] = 0xAB;
+    const uint8_t *data = &payload_[0];
+
+    Payload moved(std::move(payload_));
+
+    ASSERT_EQ(data, &moved[0]);
+    ASSERT_EQ(Payload::getMaxSize(), moved.getSize());
+    ASSERT_EQ(0xAB, moved[Payload::getMaxSize() - 1]);
+    ASSERT_TRUE(payload_.empty());
+}
+
+TEST_F(PayloadTest, reserveShouldThrowExceptionWhenValueIsOutOfBound)
+{
+    ASSERT_THROW(payload_.reserve(Payload::getMaxSize() + 1), Payload::SizeOutOfBoundException);
+}
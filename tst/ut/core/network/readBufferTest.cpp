@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <core/network/readBuffer.hpp>
+#include <ut/core/network/samplePayloads.hpp>
+
+using eMU::ut::env::core::network::SamplePayloads;
+using eMU::core::network::ReadBuffer;
+using eMU::core::network::Payload;
+
+class ReadBufferTest: public ::testing::Test
+{
+protected:
+    void receive(const Payload &payload, size_t offset, size_t size)
+    {
+        ASSERT_GE(readBuffer_.getFreeSpaceSize(), size);
+        memcpy(readBuffer_.getFreeSpace(), &payload[offset], size);
+    }
+
+    SamplePayloads samplePayloads_;
+    ReadBuffer readBuffer_;
+};
+
+TEST_F(ReadBufferTest, construct)
+{
+    EXPECT_TRUE(readBuffer_.getPayload().empty());
+    EXPECT_EQ(0, readBuffer_.getPendingSize());
+    EXPECT_EQ(Payload::getMaxSize(), readBuffer_.getFreeSpaceSize());
+}
+
+TEST_F(ReadBufferTest, insertCompleteStreams)
+{
+    receive(samplePayloads_.streamsPayload_, 0, samplePayloads_.streamsPayload_.getSize());
+
+    ASSERT_TRUE(readBuffer_.insert(samplePayloads_.streamsPayload_.getSize()));
+
+    ASSERT_EQ(samplePayloads_.streamsPayload_.getSize(), readBuffer_.getPayload().getSize());
+    EXPECT_EQ(0, readBuffer_.getPendingSize());
+    EXPECT_EQ(memcmp(&samplePayloads_.streamsPayload_[0], &readBuffer_.getPayload()[0], samplePayloads_.streamsPayload_.getSize()), 0);
+
+    readBuffer_.compact();
+
+    EXPECT_TRUE(readBuffer_.getPayload().empty());
+    EXPECT_EQ(Payload::getMaxSize(), readBuffer_.getFreeSpaceSize());
+}
+
+TEST_F(ReadBufferTest, incompleteHeaderShouldBeKeptPending)
+{
+    size_t chunkSize = ReadBuffer::getStreamHeaderSize() - 1;
+    receive(samplePayloads_.streamsPayload_, 0, chunkSize);
+
+    ASSERT_TRUE(readBuffer_.insert(chunkSize));
+
+    EXPECT_TRUE(readBuffer_.getPayload().empty());
+    EXPECT_EQ(chunkSize, readBuffer_.getPendingSize());
+    EXPECT_EQ(Payload::getMaxSize() - chunkSize, readBuffer_.getFreeSpaceSize());
+}
+
+TEST_F(ReadBufferTest, streamSplitIntoManyChunksShouldBeCompletedInOrder)
+{
+    size_t offset = 0;
+
+    while(offset < samplePayloads_.firstStreamSize_ - 1)
+    {
+        receive(samplePayloads_.streamsPayload_, offset, 1);
+        ASSERT_TRUE(readBuffer_.insert(1));
+        ASSERT_TRUE(readBuffer_.getPayload().empty());
+
+        readBuffer_.compact();
+        ++offset;
+    }
+
+    receive(samplePayloads_.streamsPayload_, offset, 1);
+    ASSERT_TRUE(readBuffer_.insert(1));
+
+    ASSERT_EQ(samplePayloads_.firstStreamSize_, readBuffer_.getPayload().getSize());
+    EXPECT_EQ(memcmp(&samplePayloads_.streamsPayload_[0], &readBuffer_.getPayload()[0], samplePayloads_.firstStreamSize_), 0);
+}
+
+TEST_F(ReadBufferTest, compactShouldMoveIncompleteStreamToFront)
+{
+    size_t receivedSize = samplePayloads_.firstStreamSize_ + 7;
+    receive(samplePayloads_.streamsPayload_, 0, receivedSize);
+
+    ASSERT_TRUE(readBuffer_.insert(receivedSize));
+    ASSERT_EQ(samplePayloads_.firstStreamSize_, readBuffer_.getPayload().getSize());
+    ASSERT_EQ(7, readBuffer_.getPendingSize());
+
+    readBuffer_.compact();
+
+    size_t restSize = samplePayloads_.streamsPayload_.getSize() - receivedSize;
+    receive(samplePayloads_.streamsPayload_, receivedSize, restSize);
+    ASSERT_TRUE(readBuffer_.insert(restSize));
+
+    size_t secondStreamSize = samplePayloads_.streamsPayload_.getSize() - samplePayloads_.firstStreamSize_;
+    ASSERT_EQ(secondStreamSize, readBuffer_.getPayload().getSize());
+    EXPECT_EQ(memcmp(&samplePayloads_.streamsPayload_[samplePayloads_.firstStreamSize_], &readBuffer_.getPayload()[0], secondStreamSize), 0);
+}
+
+TEST_F(ReadBufferTest, insertShouldReturnFalseWhenStreamSizeIsOutOfBound)
+{
+    uint32_t streamSize = Payload::getMaxSize();
+    memcpy(readBuffer_.getFreeSpace(), &streamSize, sizeof(streamSize));
+
+    EXPECT_FALSE(readBuffer_.insert(sizeof(streamSize)));
+}
+
+TEST_F(ReadBufferTest, clear)
+{
+    receive(samplePayloads_.streamsPayload_, 0, samplePayloads_.firstStreamSize_ + 1);
+    readBuffer_.insert(samplePayloads_.firstStreamSize_ + 1);
+
+    readBuffer_.clear();
+
+    EXPECT_TRUE(readBuffer_.getPayload().empty());
+    EXPECT_EQ(0, readBuffer_.getPendingSize());
+}
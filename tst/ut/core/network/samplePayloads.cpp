@@ -1,37 +1,54 @@
-#include <ut/core/network/samplePayloads.hpp>
-
-namespace eMU
-{
-namespace ut
-{
-namespace env
-{
-namespace core
-{
-namespace network
-{
-
-SamplePayloads::SamplePayloads()
-{
-    preparePayload(fullFilledPayload_, eMU::core::network::Payload::getMaxSize());
-    preparePayload(halfFilledPayload_, eMU::core::network::Payload::getMaxSize() / 2);
-    preparePayload(payload1_, 30);
-    preparePayload(payload2_, 60);
-    preparePayload(payload3_, 90);
-}
-
-void SamplePayloads::preparePayload(eMU::core::network::Payload &payload, size_t bytes)
-{
-    for(size_t i = 0; i < bytes; ++i)
-    {
-        payload[i] = static_cast<uint8_t>(i + 1);
-    }
-
-    payload.setSize(bytes);
-}
-
-}
-}
-}
-}
-}
+#include <ut/core/network/samplePayloads.hpp>
+
+namespace eMU
+{
+namespace ut
+{
+namespace env
+{
+namespace core
+{
+namespace network
+{
+
+SamplePayloads::SamplePayloads():
+    firstStreamSize_(24)
+{
+    preparePayload(fullFilledPayload_, eMU::core::network::Payload::getMaxSize());
+    preparePayload(halfFilledPayload_, eMU::core::network::Payload::getMaxSize() / 2);
+    preparePayload(payload1_, 30);
+    preparePayload(payload2_, 60);
+    preparePayload(payload3_, 90);
+
+    appendStream(streamsPayload_, firstStreamSize_);
+    appendStream(streamsPayload_, 40);
+}
+
+void SamplePayloads::preparePayload(eMU::core::network::Payload &payload, size_t bytes)
+{
+    for(size_t i = 0; i < bytes; ++i)
+    {
+        payload[i] = static_cast<uint8_t>(i + 1);
+    }
+
+    payload.setSize(bytes);
+}
+
+void SamplePayloads::appendStream(eMU::core::network::Payload &payload, size_t bytes)
+{
+    size_t offset = payload.getSize();
+    reinterpret_cast<uint32_t&>(payload[offset]) = bytes - sizeof(uint32_t);
+
+    for(size_t i = sizeof(uint32_t); i < bytes; ++i)
+    {
+        payload[offset + i] = static_cast<uint8_t>(i + 1);
+    }
+
+    payload.setSize(offset + bytes);
+}
+
+}
+}
+}
+}
+}
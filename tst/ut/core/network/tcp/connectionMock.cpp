@@ -1,24 +1,24 @@
-#include <ut/core/network/tcp/connectionMock.hpp>
-
-namespace eMU
-{
-namespace ut
-{
-namespace env
-{
-namespace core
-{
-namespace network
-{
-namespace tcp
-{
-
-ConnectionMock::ConnectionMock():
-    Connection(ioService_, protocol_) {}
-
-}
-}
-}
-}
-}
-}
+#include <ut/core/network/tcp/connectionMock.hpp>
+
+namespace eMU
+{
+namespace ut
+{
+namespace env
+{
+namespace core
+{
+namespace network
+{
+namespace tcp
+{
+
+ConnectionMock::ConnectionMock():
+    Connection(ioService_, protocol_) {}
+
+}
+}
+}
+}
+}
+}
@@ -1,299 +1,428 @@
-#include <gtest/gtest.h>
-#include <gmock/gmock.h>
-#include <core/network/tcp/connection.hpp>
-#include <core/network/tcp/protocol.hpp>
-#include <ut/core/network/samplePayloads.hpp>
-
-using ::testing::SaveArg;
-using ::testing::SetArgReferee;
-using ::testing::Return;
-using ::testing::_;
-using ::testing::Throw;
-
-using eMU::ut::env::core::network::SamplePayloads;
-
-using eMU::core::network::tcp::Protocol;
-using eMU::core::network::tcp::Connection;
-using eMU::core::network::Payload;
-
-namespace asioStub = eMU::ut::env::asioStub;
-
-class TcpConnectionTest: public ::testing::Test
-{
-protected:
-    class ProtocolMock: public Protocol
-    {
-    public:
-        MOCK_METHOD1(attach, bool(Connection::Pointer connection));
-        MOCK_METHOD1(detach, void(Connection::Pointer connection));
-        MOCK_METHOD1(dispatch, bool(Connection::Pointer connection));
-    };
-
-    TcpConnectionTest():
-        connection_(new Connection(ioService_, protocol_)),
-        endpoint_(boost::asio::ip::tcp::v4(), 55962) {}
-
-    asioStub::io_service ioService_;
-    ProtocolMock protocol_;
-    Connection::Pointer connection_;
-    boost::asio::ip::tcp::endpoint endpoint_;
-
-    boost::asio::mutable_buffer receiveBuffer_;
-    boost::asio::mutable_buffer sendBuffer_;
-
-    SamplePayloads samplePayloads_;
-};
-
-TEST_F(TcpConnectionTest, close)
-{
-    EXPECT_CALL(connection_->getSocket(), shutdown(boost::asio::ip::tcp::socket::shutdown_both));
-    EXPECT_CALL(connection_->getSocket(), close());
-
-    connection_->close();
-}
-
-TEST_F(TcpConnectionTest, disconnectShouldTriggerCloseEvent)
-{
-    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(true));
-    EXPECT_CALL(protocol_, detach(connection_));
-
-    connection_->disconnect();
-}
-
-TEST_F(TcpConnectionTest, disconnectAtNotOpenedSocketShouldNotTriggerCloseEvent)
-{
-    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(false));
-
-    connection_->disconnect();
-}
-
-TEST_F(TcpConnectionTest, receiveWithEofErrorShouldTriggerCloseEvent)
-{
-    EXPECT_CALL(connection_->getSocket(), async_receive(_, _));
-
-    connection_->queueReceive();
-
-    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(true));
-    EXPECT_CALL(protocol_, detach(connection_));
-
-    connection_->receiveHandler(boost::asio::error::eof, 0);
-}
-
-TEST_F(TcpConnectionTest, receive)
-{
-    EXPECT_CALL(connection_->getSocket(), async_receive(_, _)).WillOnce(SaveArg<0>(&receiveBuffer_));
-
-    connection_->queueReceive();
-
-    ASSERT_TRUE(boost::asio::buffer_cast<const uint8_t*>(receiveBuffer_) != nullptr);
-    ASSERT_EQ(Payload::getMaxSize(), boost::asio::buffer_size(receiveBuffer_));
-
-    memcpy(boost::asio::buffer_cast<uint8_t*>(receiveBuffer_), &samplePayloads_.payload1_[0], samplePayloads_.payload1_.getSize());
-
-    EXPECT_CALL(connection_->getSocket(), async_receive(_, _));
-    EXPECT_CALL(protocol_, dispatch(connection_)).WillOnce(Return(true));
-
-    connection_->receiveHandler(boost::system::error_code(), samplePayloads_.payload1_.getSize());
-
-    ASSERT_EQ(samplePayloads_.payload1_.getSize(), connection_->getReadPayload().getSize());
-    EXPECT_EQ(memcmp(&samplePayloads_.payload1_[0], &connection_->getReadPayload()[0], samplePayloads_.payload1_.getSize()), 0);
-}
-
-TEST_F(TcpConnectionTest, receiveErrorShouldTriggerCloseEvent)
-{
-    EXPECT_CALL(connection_->getSocket(), async_receive(_, _));
-
-    connection_->queueReceive();
-
-    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(true));
-    EXPECT_CALL(protocol_, detach(connection_));
-
-    connection_->receiveHandler(boost::asio::error::broken_pipe, 0);
-}
-
-TEST_F(TcpConnectionTest, whenDispatchFailedThenCloseEventShouldBeTrigger)
-{
-    EXPECT_CALL(connection_->getSocket(), async_receive(_, _));
-
-    connection_->queueReceive();
-
-    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(true));
-    EXPECT_CALL(protocol_, dispatch(connection_)).WillOnce((Return(false)));
-    EXPECT_CALL(protocol_, detach(connection_));
-
-    connection_->receiveHandler(boost::system::error_code(), samplePayloads_.payload1_.getSize());
-}
-
-TEST_F(TcpConnectionTest, receiveErrorShouldNotTriggerCloseEventWhenSocketIsNotOpen)
-{
-    EXPECT_CALL(connection_->getSocket(), async_receive(_, _));
-
-    connection_->queueReceive();
-
-    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(false));
-
-    connection_->receiveHandler(boost::asio::error::broken_pipe, 0);
-}
-
-TEST_F(TcpConnectionTest, receiveWithOperationAbortedErrorShouldNotTriggerCloseEvent)
-{
-    EXPECT_CALL(connection_->getSocket(), async_receive(_, _));
-
-    connection_->queueReceive();
-
-    connection_->receiveHandler(boost::asio::error::operation_aborted, 0);
-}
-
-TEST_F(TcpConnectionTest, send)
-{
-    EXPECT_CALL(connection_->getSocket(), async_send(_, _)).WillOnce(SaveArg<0>(&sendBuffer_));
-
-    connection_->send(samplePayloads_.payload2_);
-
-    ASSERT_EQ(samplePayloads_.payload2_.getSize(), boost::asio::buffer_size(sendBuffer_));
-    EXPECT_EQ(memcmp(&samplePayloads_.payload2_[0],boost::asio::buffer_cast<const uint8_t*>(sendBuffer_), samplePayloads_.payload2_.getSize()), 0);
-}
-
-TEST_F(TcpConnectionTest, PendingBuffersShouldBeSendTogether)
-{
-    size_t attempts = 3;
-
-    for(size_t i = 0; i < attempts; ++i)
-    {
-        boost::asio::mutable_buffer sendBuffer1;
-        EXPECT_CALL(connection_->getSocket(), async_send(_, _)).WillOnce(SaveArg<0>(&sendBuffer1));
-        connection_->send(samplePayloads_.payload1_);
-
-        ASSERT_EQ(samplePayloads_.payload1_.getSize(), boost::asio::buffer_size(sendBuffer1));
-        EXPECT_EQ(memcmp(&samplePayloads_.payload1_[0], boost::asio::buffer_cast<const uint8_t*>(sendBuffer1), samplePayloads_.payload1_.getSize()), 0);
-
-        connection_->send(samplePayloads_.halfFilledPayload_);
-        connection_->send(samplePayloads_.halfFilledPayload_);
-
-        boost::asio::mutable_buffer sendBuffer2;
-        EXPECT_CALL(connection_->getSocket(), async_send(_, _)).WillOnce(SaveArg<0>(&sendBuffer2));
-
-        connection_->sendHandler(boost::system::error_code(), samplePayloads_.payload1_.getSize());
-
-        ASSERT_EQ(samplePayloads_.fullFilledPayload_.getSize(), boost::asio::buffer_size(sendBuffer2));
-        EXPECT_EQ(memcmp(&samplePayloads_.fullFilledPayload_[0], boost::asio::buffer_cast<const uint8_t*>(sendBuffer2), samplePayloads_.fullFilledPayload_.getSize()), 0);
-
-        connection_->sendHandler(boost::system::error_code(), samplePayloads_.fullFilledPayload_.getSize());
-    }
-}
-
-TEST_F(TcpConnectionTest, sendErrorShouldTriggerCloseEvent)
-{
-    EXPECT_CALL(connection_->getSocket(), async_send(_, _));
-    connection_->send(samplePayloads_.payload3_);
-
-    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(true));
-    EXPECT_CALL(protocol_, detach(connection_));
-
-    connection_->sendHandler(boost::asio::error::bad_descriptor, 0);
-}
-
-TEST_F(TcpConnectionTest, sendErrorShouldNotTiggerCloseEventWhenSocketIsNotOpen)
-{
-    EXPECT_CALL(connection_->getSocket(), async_send(_, _));
-    connection_->send(samplePayloads_.payload1_);
-
-    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(false));
-
-    connection_->sendHandler(boost::asio::error::already_started, 0);
-}
-
-TEST_F(TcpConnectionTest, overflowSecondarySendBufferShouldTriggerCloseEvent)
-{
-    EXPECT_CALL(connection_->getSocket(), async_send(_, _));
-
-    Payload payload1(samplePayloads_.payload1_);
-    connection_->send(payload1);
-
-    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(true));
-    EXPECT_CALL(protocol_, detach(connection_));
-
-    connection_->send(samplePayloads_.fullFilledPayload_);
-    connection_->send(samplePayloads_.halfFilledPayload_);
-}
-
-TEST_F(TcpConnectionTest, sendWithOperationAbortedErrorShouldNotTriggerCloseEvent)
-{
-    EXPECT_CALL(connection_->getSocket(), async_send(_, _));
-    connection_->send(samplePayloads_.payload2_);
-
-    connection_->sendHandler(boost::asio::error::operation_aborted, 0);
-}
-
-TEST_F(TcpConnectionTest, connectShouldReturnFalseWhenErrorOccuredAndCloseSocketIfOpened)
-{
-    EXPECT_CALL(connection_->getSocket(), connect(endpoint_, _)).WillOnce(SetArgReferee<1>(boost::asio::error::access_denied));
-
-    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(true));
-    EXPECT_CALL(connection_->getSocket(), close());
-    EXPECT_CALL(connection_->getSocket(), shutdown(boost::asio::ip::tcp::socket::shutdown_both));
-
-    ASSERT_FALSE(connection_->connect(endpoint_));
-}
-
-TEST_F(TcpConnectionTest, connectShouldReturnFalseWhenErrorOccuredAndDoNotCloseSocketIfNotOpened)
-{
-    EXPECT_CALL(connection_->getSocket(), connect(endpoint_, _)).WillOnce(SetArgReferee<1>(boost::asio::error::access_denied));
-
-    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(false));
-
-    ASSERT_FALSE(connection_->connect(endpoint_));
-}
-
-TEST_F(TcpConnectionTest, connectShouldReturnFalseWhenAttachFailed)
-{
-    EXPECT_CALL(protocol_, attach(connection_)).WillOnce(Return(false));
-    EXPECT_CALL(connection_->getSocket(), close());
-    EXPECT_CALL(connection_->getSocket(), shutdown(boost::asio::ip::tcp::socket::shutdown_both));
-    EXPECT_CALL(connection_->getSocket(), connect(endpoint_, _)).WillOnce(SetArgReferee<1>(boost::system::error_code()));
-
-    ASSERT_FALSE(connection_->connect(endpoint_));
-}
-
-TEST_F(TcpConnectionTest, connectShouldReturnTrueWhenNoErrorOccured)
-{
-    EXPECT_CALL(protocol_, attach(connection_)).WillOnce(Return(true));
-    EXPECT_CALL(connection_->getSocket(), connect(endpoint_, _)).WillOnce(SetArgReferee<1>(boost::system::error_code()));
-    EXPECT_CALL(connection_->getSocket(), async_receive(_, _));
-
-    ASSERT_TRUE(connection_->connect(endpoint_));
-}
-
-TEST_F(TcpConnectionTest, thrownExceptionFromShutdownDuringCloseOperationShouldBeCaught)
-{
-    EXPECT_CALL(connection_->getSocket(), shutdown(boost::asio::ip::tcp::socket::shutdown_both)).WillOnce(Throw(boost::system::system_error(boost::asio::error::bad_descriptor)));
-
-    connection_->close();
-}
-
-
-TEST_F(TcpConnectionTest, thrownExceptionFromCloseDuringCloseOperationShouldBeCaught)
-{
-    EXPECT_CALL(connection_->getSocket(), shutdown(boost::asio::ip::tcp::socket::shutdown_both));
-    EXPECT_CALL(connection_->getSocket(), close()).WillOnce(Throw(boost::system::system_error(boost::asio::error::fd_set_failure)));
-
-    connection_->close();
-}
-
-TEST_F(TcpConnectionTest, acceptShouldQueueReceiveWhenAttachIsSucceed)
-{
-    EXPECT_CALL(connection_->getSocket(), async_receive(_, _));
-    EXPECT_CALL(protocol_, attach(connection_)).WillOnce(Return(true));
-
-    connection_->accept();
-}
-
-TEST_F(TcpConnectionTest, acceptShouldCloseConnectionWhenAttachIsFailed)
-{
-    EXPECT_CALL(connection_->getSocket(), shutdown(boost::asio::ip::tcp::socket::shutdown_both));
-    EXPECT_CALL(connection_->getSocket(), close()).WillOnce(Throw(boost::system::system_error(boost::asio::error::fd_set_failure)));
-    EXPECT_CALL(protocol_, attach(connection_)).WillOnce(Return(false));
-
-    connection_->accept();
-}
-
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <core/network/tcp/connection.hpp>
+#include <core/network/tcp/protocol.hpp>
+#include <ut/core/network/samplePayloads.hpp>
+
+using ::testing::SaveArg;
+using ::testing::SetArgReferee;
+using ::testing::Return;
+using ::testing::_;
+using ::testing::Throw;
+using ::testing::DoAll;
+using ::testing::Invoke;
+
+using eMU::ut::env::core::network::SamplePayloads;
+
+using eMU::core::network::tcp::Protocol;
+using eMU::core::network::tcp::Connection;
+using eMU::core::network::Payload;
+
+namespace asioStub = eMU::ut::env::asioStub;
+
+class TcpConnectionTest: public ::testing::Test
+{
+public:
+    void saveReadPayload(Connection::Pointer connection)
+    {
+        dispatchedPayload_ = connection->getReadPayload();
+    }
+
+protected:
+    class ProtocolMock: public Protocol
+    {
+    public:
+        MOCK_METHOD1(attach, bool(Connection::Pointer connection));
+        MOCK_METHOD1(detach, void(Connection::Pointer connection));
+        MOCK_METHOD1(dispatch, bool(Connection::Pointer connection));
+        MOCK_METHOD1(writeQueueCongested, void(Connection::Pointer connection));
+        MOCK_METHOD1(writeQueueDrained, void(Connection::Pointer connection));
+    };
+
+    std::vector<uint8_t> gather(const std::vector<boost::asio::const_buffer> &buffers) const
+    {
+        std::vector<uint8_t> data(boost::asio::buffer_size(buffers));
+        boost::asio::buffer_copy(boost::asio::buffer(data), buffers);
+
+        return data;
+    }
+
+    TcpConnectionTest():
+        connection_(new Connection(ioService_, protocol_)),
+        endpoint_(boost::asio::ip::tcp::v4(), 55962) {}
+
+    asioStub::io_service ioService_;
+    ProtocolMock protocol_;
+    Connection::Pointer connection_;
+    boost::asio::ip::tcp::endpoint endpoint_;
+
+    boost::asio::mutable_buffer receiveBuffer_;
+    std::vector<boost::asio::const_buffer> sendBuffers_;
+
+    SamplePayloads samplePayloads_;
+    Payload dispatchedPayload_;
+};
+
+TEST_F(TcpConnectionTest, close)
+{
+    EXPECT_CALL(connection_->getSocket(), shutdown(boost::asio::ip::tcp::socket::shutdown_both));
+    EXPECT_CALL(connection_->getSocket(), close());
+
+    connection_->close();
+}
+
+TEST_F(TcpConnectionTest, disconnectShouldTriggerCloseEvent)
+{
+    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(true));
+    EXPECT_CALL(protocol_, detach(connection_));
+
+    connection_->disconnect();
+}
+
+TEST_F(TcpConnectionTest, disconnectAtNotOpenedSocketShouldNotTriggerCloseEvent)
+{
+    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(false));
+
+    connection_->disconnect();
+}
+
+TEST_F(TcpConnectionTest, receiveWithEofErrorShouldTriggerCloseEvent)
+{
+    EXPECT_CALL(connection_->getSocket(), async_receive(_, _));
+
+    connection_->queueReceive();
+
+    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(true));
+    EXPECT_CALL(protocol_, detach(connection_));
+
+    connection_->receiveHandler(boost::asio::error::eof, 0);
+}
+
+TEST_F(TcpConnectionTest, receive)
+{
+    EXPECT_CALL(connection_->getSocket(), async_receive(_, _)).WillOnce(SaveArg<0>(&receiveBuffer_));
+
+    connection_->queueReceive();
+
+    ASSERT_TRUE(boost::asio::buffer_cast<const uint8_t*>(receiveBuffer_) != nullptr);
+    ASSERT_EQ(Payload::getMaxSize(), boost::asio::buffer_size(receiveBuffer_));
+
+    memcpy(boost::asio::buffer_cast<uint8_t*>(receiveBuffer_), &samplePayloads_.streamsPayload_[0], samplePayloads_.streamsPayload_.getSize());
+
+    EXPECT_CALL(connection_->getSocket(), async_receive(_, _));
+    EXPECT_CALL(protocol_, dispatch(connection_)).WillOnce(DoAll(Invoke(this, &TcpConnectionTest::saveReadPayload), Return(true)));
+
+    connection_->receiveHandler(boost::system::error_code(), samplePayloads_.streamsPayload_.getSize());
+
+    ASSERT_EQ(samplePayloads_.streamsPayload_.getSize(), dispatchedPayload_.getSize());
+    EXPECT_EQ(memcmp(&samplePayloads_.streamsPayload_[0], &dispatchedPayload_[0], samplePayloads_.streamsPayload_.getSize()), 0);
+}
+
+TEST_F(TcpConnectionTest, partiallyReceivedStreamShouldBeDispatchedWhenCompleted)
+{
+    size_t firstChunkSize = 3;
+
+    EXPECT_CALL(connection_->getSocket(), async_receive(_, _)).WillOnce(SaveArg<0>(&receiveBuffer_));
+    connection_->queueReceive();
+
+    memcpy(boost::asio::buffer_cast<uint8_t*>(receiveBuffer_), &samplePayloads_.streamsPayload_[0], firstChunkSize);
+
+    EXPECT_CALL(connection_->getSocket(), async_receive(_, _)).WillOnce(SaveArg<0>(&receiveBuffer_));
+    EXPECT_CALL(protocol_, dispatch(connection_)).Times(0);
+    connection_->receiveHandler(boost::system::error_code(), firstChunkSize);
+
+    ASSERT_EQ(Payload::getMaxSize() - firstChunkSize, boost::asio::buffer_size(receiveBuffer_));
+
+    size_t secondChunkSize = samplePayloads_.streamsPayload_.getSize() - firstChunkSize;
+    memcpy(boost::asio::buffer_cast<uint8_t*>(receiveBuffer_), &samplePayloads_.streamsPayload_[firstChunkSize], secondChunkSize);
+
+    EXPECT_CALL(connection_->getSocket(), async_receive(_, _)).WillOnce(SaveArg<0>(&receiveBuffer_));
+    EXPECT_CALL(protocol_, dispatch(connection_)).WillOnce(DoAll(Invoke(this, &TcpConnectionTest::saveReadPayload), Return(true)));
+    connection_->receiveHandler(boost::system::error_code(), secondChunkSize);
+
+    ASSERT_EQ(samplePayloads_.streamsPayload_.getSize(), dispatchedPayload_.getSize());
+    EXPECT_EQ(memcmp(&samplePayloads_.streamsPayload_[0], &dispatchedPayload_[0], samplePayloads_.streamsPayload_.getSize()), 0);
+    ASSERT_EQ(Payload::getMaxSize(), boost::asio::buffer_size(receiveBuffer_));
+}
+
+TEST_F(TcpConnectionTest, onlyCompleteStreamsShouldBeDispatchedFromCoalescedRead)
+{
+    size_t incompleteSize = samplePayloads_.firstStreamSize_ + 10;
+
+    EXPECT_CALL(connection_->getSocket(), async_receive(_, _)).WillOnce(SaveArg<0>(&receiveBuffer_));
+    connection_->queueReceive();
+
+    memcpy(boost::asio::buffer_cast<uint8_t*>(receiveBuffer_), &samplePayloads_.streamsPayload_[0], incompleteSize);
+
+    EXPECT_CALL(connection_->getSocket(), async_receive(_, _)).WillOnce(SaveArg<0>(&receiveBuffer_));
+    EXPECT_CALL(protocol_, dispatch(connection_)).WillOnce(DoAll(Invoke(this, &TcpConnectionTest::saveReadPayload), Return(true)));
+    connection_->receiveHandler(boost::system::error_code(), incompleteSize);
+
+    ASSERT_EQ(samplePayloads_.firstStreamSize_, dispatchedPayload_.getSize());
+    EXPECT_EQ(memcmp(&samplePayloads_.streamsPayload_[0], &dispatchedPayload_[0], samplePayloads_.firstStreamSize_), 0);
+    ASSERT_EQ(Payload::getMaxSize() - (incompleteSize - samplePayloads_.firstStreamSize_), boost::asio::buffer_size(receiveBuffer_));
+}
+
+TEST_F(TcpConnectionTest, receivedStreamWithSizeOutOfBoundShouldTriggerCloseEvent)
+{
+    EXPECT_CALL(connection_->getSocket(), async_receive(_, _)).WillOnce(SaveArg<0>(&receiveBuffer_));
+    connection_->queueReceive();
+
+    reinterpret_cast<uint32_t&>(*boost::asio::buffer_cast<uint8_t*>(receiveBuffer_)) = Payload::getMaxSize();
+
+    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(true));
+    EXPECT_CALL(protocol_, dispatch(connection_)).Times(0);
+    EXPECT_CALL(protocol_, detach(connection_));
+
+    connection_->receiveHandler(boost::system::error_code(), sizeof(uint32_t));
+}
+
+TEST_F(TcpConnectionTest, receiveErrorShouldTriggerCloseEvent)
+{
+    EXPECT_CALL(connection_->getSocket(), async_receive(_, _));
+
+    connection_->queueReceive();
+
+    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(true));
+    EXPECT_CALL(protocol_, detach(connection_));
+
+    connection_->receiveHandler(boost::asio::error::broken_pipe, 0);
+}
+
+TEST_F(TcpConnectionTest, whenDispatchFailedThenCloseEventShouldBeTrigger)
+{
+    EXPECT_CALL(connection_->getSocket(), async_receive(_, _)).WillOnce(SaveArg<0>(&receiveBuffer_));
+
+    connection_->queueReceive();
+
+    memcpy(boost::asio::buffer_cast<uint8_t*>(receiveBuffer_), &samplePayloads_.streamsPayload_[0], samplePayloads_.streamsPayload_.getSize());
+
+    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(true));
+    EXPECT_CALL(protocol_, dispatch(connection_)).WillOnce((Return(false)));
+    EXPECT_CALL(protocol_, detach(connection_));
+
+    connection_->receiveHandler(boost::system::error_code(), samplePayloads_.streamsPayload_.getSize());
+}
+
+TEST_F(TcpConnectionTest, receiveErrorShouldNotTriggerCloseEventWhenSocketIsNotOpen)
+{
+    EXPECT_CALL(connection_->getSocket(), async_receive(_, _));
+
+    connection_->queueReceive();
+
+    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(false));
+
+    connection_->receiveHandler(boost::asio::error::broken_pipe, 0);
+}
+
+TEST_F(TcpConnectionTest, receiveWithOperationAbortedErrorShouldNotTriggerCloseEvent)
+{
+    EXPECT_CALL(connection_->getSocket(), async_receive(_, _));
+
+    connection_->queueReceive();
+
+    connection_->receiveHandler(boost::asio::error::operation_aborted, 0);
+}
+
+TEST_F(TcpConnectionTest, send)
+{
+    EXPECT_CALL(connection_->getSocket(), async_send(_, _)).WillOnce(SaveArg<0>(&sendBuffers_));
+
+    connection_->send(samplePayloads_.payload2_);
+
+    std::vector<uint8_t> sentData = gather(sendBuffers_);
+    ASSERT_EQ(samplePayloads_.payload2_.getSize(), sentData.size());
+    EXPECT_EQ(memcmp(&samplePayloads_.payload2_[0], &sentData[0], samplePayloads_.payload2_.getSize()), 0);
+}
+
+TEST_F(TcpConnectionTest, PendingBuffersShouldBeSendTogether)
+{
+    size_t attempts = 3;
+
+    for(size_t i = 0; i < attempts; ++i)
+    {
+        std::vector<boost::asio::const_buffer> sendBuffers1;
+        EXPECT_CALL(connection_->getSocket(), async_send(_, _)).WillOnce(SaveArg<0>(&sendBuffers1));
+        connection_->send(samplePayloads_.payload1_);
+
+        std::vector<uint8_t> sentData1 = gather(sendBuffers1);
+        ASSERT_EQ(samplePayloads_.payload1_.getSize(), sentData1.size());
+        EXPECT_EQ(memcmp(&samplePayloads_.payload1_[0], &sentData1[0], samplePayloads_.payload1_.getSize()), 0);
+
+        connection_->send(samplePayloads_.halfFilledPayload_);
+        connection_->send(samplePayloads_.halfFilledPayload_);
+
+        std::vector<boost::asio::const_buffer> sendBuffers2;
+        EXPECT_CALL(connection_->getSocket(), async_send(_, _)).WillOnce(SaveArg<0>(&sendBuffers2));
+
+        connection_->sendHandler(boost::system::error_code(), samplePayloads_.payload1_.getSize());
+
+        std::vector<uint8_t> sentData2 = gather(sendBuffers2);
+        ASSERT_EQ(samplePayloads_.fullFilledPayload_.getSize(), sentData2.size());
+        EXPECT_EQ(memcmp(&samplePayloads_.fullFilledPayload_[0], &sentData2[0], samplePayloads_.fullFilledPayload_.getSize()), 0);
+
+        connection_->sendHandler(boost::system::error_code(), samplePayloads_.fullFilledPayload_.getSize());
+    }
+}
+
+TEST_F(TcpConnectionTest, partiallySentDataShouldBeQueuedAgain)
+{
+    EXPECT_CALL(connection_->getSocket(), async_send(_, _)).WillOnce(SaveArg<0>(&sendBuffers_));
+    connection_->send(samplePayloads_.payload3_);
+
+    size_t bytesTransferred = 10;
+    EXPECT_CALL(connection_->getSocket(), async_send(_, _)).WillOnce(SaveArg<0>(&sendBuffers_));
+    connection_->sendHandler(boost::system::error_code(), bytesTransferred);
+
+    std::vector<uint8_t> sentData = gather(sendBuffers_);
+    ASSERT_EQ(samplePayloads_.payload3_.getSize() - bytesTransferred, sentData.size());
+    EXPECT_EQ(memcmp(&samplePayloads_.payload3_[bytesTransferred], &sentData[0], sentData.size()), 0);
+
+    connection_->sendHandler(boost::system::error_code(), sentData.size());
+}
+
+TEST_F(TcpConnectionTest, sendErrorShouldTriggerCloseEvent)
+{
+    EXPECT_CALL(connection_->getSocket(), async_send(_, _));
+    connection_->send(samplePayloads_.payload3_);
+
+    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(true));
+    EXPECT_CALL(protocol_, detach(connection_));
+
+    connection_->sendHandler(boost::asio::error::bad_descriptor, 0);
+}
+
+TEST_F(TcpConnectionTest, sendErrorShouldNotTiggerCloseEventWhenSocketIsNotOpen)
+{
+    EXPECT_CALL(connection_->getSocket(), async_send(_, _));
+    connection_->send(samplePayloads_.payload1_);
+
+    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(false));
+
+    connection_->sendHandler(boost::asio::error::already_started, 0);
+}
+
+TEST_F(TcpConnectionTest, dataQueuedBeyondSingleBufferShouldBeSentInsteadOfClosingConnection)
+{
+    EXPECT_CALL(connection_->getSocket(), async_send(_, _));
+    connection_->send(samplePayloads_.payload1_);
+
+    EXPECT_CALL(protocol_, detach(_)).Times(0);
+
+    connection_->send(samplePayloads_.fullFilledPayload_);
+    connection_->send(samplePayloads_.halfFilledPayload_);
+
+    EXPECT_CALL(connection_->getSocket(), async_send(_, _)).WillOnce(SaveArg<0>(&sendBuffers_));
+    connection_->sendHandler(boost::system::error_code(), samplePayloads_.payload1_.getSize());
+
+    std::vector<uint8_t> sentData = gather(sendBuffers_);
+    ASSERT_EQ(samplePayloads_.fullFilledPayload_.getSize() + samplePayloads_.halfFilledPayload_.getSize(), sentData.size());
+    EXPECT_EQ(memcmp(&samplePayloads_.fullFilledPayload_[0], &sentData[0], samplePayloads_.fullFilledPayload_.getSize()), 0);
+    EXPECT_EQ(memcmp(&samplePayloads_.halfFilledPayload_[0], &sentData[samplePayloads_.fullFilledPayload_.getSize()], samplePayloads_.halfFilledPayload_.getSize()), 0);
+}
+
+TEST_F(TcpConnectionTest, protocolShouldBeNotifiedWhenWriteQueueCrossesWatermarks)
+{
+    protocol_.setWriteQueueWatermarks(samplePayloads_.fullFilledPayload_.getSize(), samplePayloads_.payload1_.getSize());
+
+    EXPECT_CALL(connection_->getSocket(), async_send(_, _));
+    connection_->send(samplePayloads_.halfFilledPayload_);
+    ASSERT_FALSE(connection_->isWriteQueueCongested());
+
+    EXPECT_CALL(protocol_, writeQueueCongested(connection_));
+    connection_->send(samplePayloads_.halfFilledPayload_);
+    connection_->send(samplePayloads_.payload1_);
+    ASSERT_TRUE(connection_->isWriteQueueCongested());
+
+    EXPECT_CALL(connection_->getSocket(), async_send(_, _));
+    connection_->sendHandler(boost::system::error_code(), samplePayloads_.halfFilledPayload_.getSize());
+    ASSERT_TRUE(connection_->isWriteQueueCongested());
+
+    EXPECT_CALL(protocol_, writeQueueDrained(connection_));
+    EXPECT_CALL(connection_->getSocket(), async_send(_, _));
+    connection_->sendHandler(boost::system::error_code(), samplePayloads_.halfFilledPayload_.getSize());
+    ASSERT_FALSE(connection_->isWriteQueueCongested());
+
+    connection_->sendHandler(boost::system::error_code(), samplePayloads_.payload1_.getSize());
+}
+
+TEST_F(TcpConnectionTest, sendWithOperationAbortedErrorShouldNotTriggerCloseEvent)
+{
+    EXPECT_CALL(connection_->getSocket(), async_send(_, _));
+    connection_->send(samplePayloads_.payload2_);
+
+    connection_->sendHandler(boost::asio::error::operation_aborted, 0);
+}
+
+TEST_F(TcpConnectionTest, connectShouldReturnFalseWhenErrorOccuredAndCloseSocketIfOpened)
+{
+    EXPECT_CALL(connection_->getSocket(), connect(endpoint_, _)).WillOnce(SetArgReferee<1>(boost::asio::error::access_denied));
+
+    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(true));
+    EXPECT_CALL(connection_->getSocket(), close());
+    EXPECT_CALL(connection_->getSocket(), shutdown(boost::asio::ip::tcp::socket::shutdown_both));
+
+    ASSERT_FALSE(connection_->connect(endpoint_));
+}
+
+TEST_F(TcpConnectionTest, connectShouldReturnFalseWhenErrorOccuredAndDoNotCloseSocketIfNotOpened)
+{
+    EXPECT_CALL(connection_->getSocket(), connect(endpoint_, _)).WillOnce(SetArgReferee<1>(boost::asio::error::access_denied));
+
+    EXPECT_CALL(connection_->getSocket(), is_open()).WillOnce(Return(false));
+
+    ASSERT_FALSE(connection_->connect(endpoint_));
+}
+
+TEST_F(TcpConnectionTest, connectShouldReturnFalseWhenAttachFailed)
+{
+    EXPECT_CALL(protocol_, attach(connection_)).WillOnce(Return(false));
+    EXPECT_CALL(connection_->getSocket(), close());
+    EXPECT_CALL(connection_->getSocket(), shutdown(boost::asio::ip::tcp::socket::shutdown_both));
+    EXPECT_CALL(connection_->getSocket(), connect(endpoint_, _)).WillOnce(SetArgReferee<1>(boost::system::error_code()));
+
+    ASSERT_FALSE(connection_->connect(endpoint_));
+}
+
+TEST_F(TcpConnectionTest, connectShouldReturnTrueWhenNoErrorOccured)
+{
+    EXPECT_CALL(protocol_, attach(connection_)).WillOnce(Return(true));
+    EXPECT_CALL(connection_->getSocket(), connect(endpoint_, _)).WillOnce(SetArgReferee<1>(boost::system::error_code()));
+    EXPECT_CALL(connection_->getSocket(), async_receive(_, _));
+
+    ASSERT_TRUE(connection_->connect(endpoint_));
+}
+
+TEST_F(TcpConnectionTest, thrownExceptionFromShutdownDuringCloseOperationShouldBeCaught)
+{
+    EXPECT_CALL(connection_->getSocket(), shutdown(boost::asio::ip::tcp::socket::shutdown_both)).WillOnce(Throw(boost::system::system_error(boost::asio::error::bad_descriptor)));
+
+    connection_->close();
+}
+
+
+TEST_F(TcpConnectionTest, thrownExceptionFromCloseDuringCloseOperationShouldBeCaught)
+{
+    EXPECT_CALL(connection_->getSocket(), shutdown(boost::asio::ip::tcp::socket::shutdown_both));
+    EXPECT_CALL(connection_->getSocket(), close()).WillOnce(Throw(boost::system::system_error(boost::asio::error::fd_set_failure)));
+
+    connection_->close();
+}
+
+TEST_F(TcpConnectionTest, acceptShouldQueueReceiveWhenAttachIsSucceed)
+{
+    EXPECT_CALL(connection_->getSocket(), async_receive(_, _));
+    EXPECT_CALL(protocol_, attach(connection_)).WillOnce(Return(true));
+
+    connection_->accept();
+}
+
+TEST_F(TcpConnectionTest, acceptShouldCloseConnectionWhenAttachIsFailed)
+{
+    EXPECT_CALL(connection_->getSocket(), shutdown(boost::asio::ip::tcp::socket::shutdown_both));
+    EXPECT_CALL(connection_->getSocket(), close()).WillOnce(Throw(boost::system::system_error(boost::asio::error::fd_set_failure)));
+    EXPECT_CALL(protocol_, attach(connection_)).WillOnce(Return(false));
+
+    connection_->accept();
+}
+
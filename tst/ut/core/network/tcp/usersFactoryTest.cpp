@@ -0,0 +1,114 @@
+#include <core/network/tcp/usersFactory.hpp>
+#include <ut/core/network/tcp/connectionMock.hpp>
+
+#include <gtest/gtest.h>
+#include <thread>
+
+using eMU::core::network::tcp::UsersFactory;
+using eMU::core::network::tcp::NetworkUser;
+using eMU::core::network::tcp::Connection;
+using eMU::ut::env::core::network::tcp::ConnectionMock;
+
+class UsersFactoryTest: public ::testing::Test
+{
+protected:
+    UsersFactoryTest():
+        connection_(new ConnectionMock()) {}
+
+    UsersFactory<NetworkUser> usersFactory_;
+    Connection::Pointer connection_;
+};
+
+TEST_F(UsersFactoryTest, createdUserShouldBeFoundByHashAndConnection)
+{
+    NetworkUser &user = usersFactory_.create(connection_);
+
+    ASSERT_EQ(1, usersFactory_.size());
+    ASSERT_TRUE(usersFactory_.exists(user.getHash()));
+    ASSERT_TRUE(usersFactory_.exists(connection_));
+    ASSERT_EQ(&user, &usersFactory_.find(user.getHash()));
+    ASSERT_EQ(&user, &usersFactory_.find(connection_));
+}
+
+TEST_F(UsersFactoryTest, destroyedUserShouldNotExist)
+{
+    NetworkUser &user = usersFactory_.create(connection_);
+    NetworkUser::Hash hash = user.getHash();
+
+    usersFactory_.destroy(user);
+
+    ASSERT_TRUE(usersFactory_.empty());
+    ASSERT_FALSE(usersFactory_.exists(hash));
+    ASSERT_FALSE(usersFactory_.exists(connection_));
+    ASSERT_THROW(usersFactory_.find(hash), UsersFactory<NetworkUser>::ObjectNotFoundException);
+    ASSERT_THROW(usersFactory_.find(connection_), UsersFactory<NetworkUser>::ObjectNotFoundException);
+}
+
+TEST_F(UsersFactoryTest, destroyUserNotBelongsToFactoryShouldThrowException)
+{
+    NetworkUser user(connection_);
+
+    ASSERT_THROW(usersFactory_.destroy(user), UsersFactory<NetworkUser>::ObjectNotFoundException);
+}
+
+TEST_F(UsersFactoryTest, getObjectsShouldReturnAllUsers)
+{
+    NetworkUser &user1 = usersFactory_.create(connection_);
+    NetworkUser &user2 = usersFactory_.create(Connection::Pointer(new ConnectionMock()));
+
+    UsersFactory<NetworkUser>::ObjectsContainer users = usersFactory_.getObjects();
+
+    ASSERT_EQ(2, users.size());
+    ASSERT_NE(users.end(), std::find(users.begin(), users.end(), &user1));
+    ASSERT_NE(users.end(), std::find(users.begin(), users.end(), &user2));
+}
+
+TEST_F(UsersFactoryTest, concurrentlyCreatedAndDestroyedUsersShouldBeIndexedConsistently)
+{
+    const size_t numberOfThreads = 4;
+    const size_t numberOfUsersPerThread = 500;
+
+    std::vector<std::vector<Connection::Pointer>> connections(numberOfThreads);
+
+    for(auto &threadConnections : connections)
+    {
+        for(size_t i = 0; i < numberOfUsersPerThread; ++i)
+        {
+            threadConnections.push_back(Connection::Pointer(new ConnectionMock()));
+        }
+    }
+
+    std::vector<std::thread> threads;
+
+    for(size_t i = 0; i < numberOfThreads; ++i)
+    {
+        threads.push_back(std::thread([this, &connections, i]()
+        {
+            for(const auto &connection : connections[i])
+            {
+                NetworkUser &user = usersFactory_.create(connection);
+                EXPECT_EQ(&user, &usersFactory_.find(user.getHash()));
+            }
+
+            for(size_t j = 0; j < connections[i].size(); j += 2)
+            {
+                usersFactory_.destroy(usersFactory_.find(connections[i][j]));
+            }
+        }));
+    }
+
+    for(auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(numberOfThreads * numberOfUsersPerThread / 2, usersFactory_.size());
+
+    for(const auto &threadConnections : connections)
+    {
+        for(size_t j = 0; j < threadConnections.size(); ++j)
+        {
+            ASSERT_EQ(j % 2 == 1, usersFactory_.exists(threadConnections[j]));
+        }
+    }
+}
@@ -0,0 +1,107 @@
+#include <core/network/udp/datagramBatch.hpp>
+
+#include <gtest/gtest.h>
+#include <netinet/in.h>
+#include <unistd.h>
+
+using eMU::core::network::Payload;
+using eMU::core::network::udp::DatagramBatch;
+
+class DatagramBatchTest: public ::testing::Test
+{
+protected:
+    DatagramBatchTest():
+        sender_(this->openSocket()),
+        receiver_(this->openSocket()) {}
+
+    ~DatagramBatchTest()
+    {
+        close(sender_);
+        close(receiver_);
+    }
+
+    int openSocket()
+    {
+        int descriptor = socket(AF_INET, SOCK_DGRAM, 0);
+
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bind(descriptor, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+
+        return descriptor;
+    }
+
+    boost::asio::ip::udp::endpoint getEndpoint(int descriptor)
+    {
+        boost::asio::ip::udp::endpoint endpoint;
+        socklen_t length = endpoint.capacity();
+        getsockname(descriptor, endpoint.data(), &length);
+        endpoint.resize(length);
+
+        return endpoint;
+    }
+
+    Payload createPayload(uint8_t value, size_t size)
+    {
+        Payload payload;
+        payload.setSize(size);
+
+        for(size_t i = 0; i < size; ++i)
+        {
+            payload[i] = value;
+        }
+
+        return payload;
+    }
+
+    int sender_;
+    int receiver_;
+    DatagramBatch batch_;
+};
+
+TEST_F(DatagramBatchTest, datagramsShouldBeSentAndReceivedInBatch)
+{
+    std::vector<Payload> payloads = {this->createPayload(1, 10), this->createPayload(2, 300), this->createPayload(3, Payload::getMaxSize())};
+
+    for(const auto &payload : payloads)
+    {
+        ASSERT_TRUE(batch_.add(this->getEndpoint(receiver_), payload));
+    }
+
+    ASSERT_EQ(3, batch_.size());
+    ASSERT_EQ(3, batch_.send(sender_));
+    ASSERT_TRUE(batch_.empty());
+
+    ASSERT_EQ(3, batch_.receive(receiver_));
+
+    for(size_t i = 0; i < payloads.size(); ++i)
+    {
+        ASSERT_EQ(payloads[i].getSize(), batch_.getPayload(i).getSize());
+        ASSERT_EQ(0, memcmp(&payloads[i][0], &batch_.getPayload(i)[0], payloads[i].getSize()));
+        ASSERT_EQ(this->getEndpoint(sender_), batch_.getEndpoint(i));
+    }
+
+    ASSERT_EQ(0, batch_.receive(receiver_));
+}
+
+TEST_F(DatagramBatchTest, batchShouldBeLimited)
+{
+    Payload payload = this->createPayload(1, 10);
+
+    for(size_t i = 0; i < DatagramBatch::kMaxNumberOfDatagrams; ++i)
+    {
+        ASSERT_TRUE(batch_.add(this->getEndpoint(receiver_), payload));
+    }
+
+    ASSERT_FALSE(batch_.add(this->getEndpoint(receiver_), payload));
+}
+
+TEST_F(DatagramBatchTest, invalidSocketShouldMoveNothing)
+{
+    Payload payload = this->createPayload(1, 10);
+    batch_.add(this->getEndpoint(receiver_), payload);
+
+    ASSERT_EQ(0, batch_.send(-1));
+    ASSERT_EQ(0, batch_.receive(-1));
+}
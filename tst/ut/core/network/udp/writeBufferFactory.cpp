@@ -1,56 +1,111 @@
-#include <gtest/gtest.h>
-#include <gmock/gmock.h>
-
-#include <core/network/udp/writeBufferFactory.hpp>
-#include <ut/core/network/samplePayloads.hpp>
-
-using eMU::ut::env::core::network::SamplePayloads;
-
-using eMU::core::network::WriteBuffer;
-using eMU::core::network::udp::WriteBufferFactory;
-
-bool operator==(const WriteBuffer &left, const WriteBuffer &right)
-{
-    return left.getPayload().getSize() == right.getPayload().getSize() &&
-           memcmp(&left.getPayload()[0], &right.getPayload()[0], left.getPayload().getSize()) == 0 &&
-           left.getSecondPayload().getSize() == right.getSecondPayload().getSize() &&
-           memcmp(&left.getSecondPayload()[0], &right.getSecondPayload()[0], left.getSecondPayload().getSize()) == 0 &&
-           left.isPending() == right.isPending();
-}
-
-class WriteBufferFactoryTest: public ::testing::Test
-{
-protected:
-    SamplePayloads samplePayloads_;
-    WriteBufferFactory writeBufferFactory_;
-};
-
-TEST_F(WriteBufferFactoryTest, ShouldReturnSameBufferForSameEndpoint)
-{
-    boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string("1.2.3.4"), 1234);
-    WriteBuffer &writeBuffer = writeBufferFactory_.get(endpoint);
-
-    writeBuffer.insert(samplePayloads_.payload1_);
-    writeBuffer.setPendingState();
-    writeBuffer.insert(samplePayloads_.payload2_);
-
-    WriteBuffer &writeBuffer2 = writeBufferFactory_.get(endpoint);
-
-    EXPECT_TRUE(writeBuffer == writeBuffer2);
-}
-
-TEST_F(WriteBufferFactoryTest, ShouldRemoveBufferForGivenEndpoint)
-{
-    boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string("1.2.3.4"), 1234);
-    WriteBuffer &writeBuffer = writeBufferFactory_.get(endpoint);
-
-    writeBuffer.insert(samplePayloads_.payload1_);
-    writeBuffer.setPendingState();
-    writeBuffer.insert(samplePayloads_.payload2_);
-
-    ASSERT_TRUE(writeBufferFactory_.erase(endpoint));
-
-    WriteBuffer &writeBuffer2 = writeBufferFactory_.get(endpoint);
-
-    ASSERT_TRUE(WriteBuffer() == writeBuffer2);
-}
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <core/network/udp/writeBufferFactory.hpp>
+#include <ut/core/network/samplePayloads.hpp>
+
+using eMU::ut::env::core::network::SamplePayloads;
+
+using eMU::core::network::WriteBuffer;
+using eMU::core::network::udp::WriteBufferFactory;
+
+bool operator==(const WriteBuffer &left, const WriteBuffer &right)
+{
+    return left.getPayload().getSize() == right.getPayload().getSize() &&
+           memcmp(&left.getPayload()[0], &right.getPayload()[0], left.getPayload().getSize()) == 0 &&
+           left.getSecondPayload().getSize() == right.getSecondPayload().getSize() &&
+           memcmp(&left.getSecondPayload()[0], &right.getSecondPayload()[0], left.getSecondPayload().getSize()) == 0 &&
+           left.isPending() == right.isPending();
+}
+
+class WriteBufferFactoryTest: public ::testing::Test
+{
+protected:
+    SamplePayloads samplePayloads_;
+    WriteBufferFactory writeBufferFactory_;
+};
+
+TEST_F(WriteBufferFactoryTest, ShouldReturnSameBufferForSameEndpoint)
+{
+    boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string("1.2.3.4"), 1234);
+    WriteBuffer &writeBuffer = writeBufferFactory_.get(endpoint);
+
+    writeBuffer.insert(samplePayloads_.payload1_);
+    writeBuffer.setPendingState();
+    writeBuffer.insert(samplePayloads_.payload2_);
+
+    WriteBuffer &writeBuffer2 = writeBufferFactory_.get(endpoint);
+
+    EXPECT_TRUE(writeBuffer == writeBuffer2);
+}
+
+TEST_F(WriteBufferFactoryTest, ShouldRemoveBufferForGivenEndpoint)
+{
+    boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string("1.2.3.4"), 1234);
+    WriteBuffer &writeBuffer = writeBufferFactory_.get(endpoint);
+
+    writeBuffer.insert(samplePayloads_.payload1_);
+    writeBuffer.setPendingState();
+    writeBuffer.insert(samplePayloads_.payload2_);
+
+    ASSERT_TRUE(writeBufferFactory_.erase(endpoint));
+
+    WriteBuffer &writeBuffer2 = writeBufferFactory_.get(endpoint);
+
+    ASSERT_TRUE(WriteBuffer() == writeBuffer2);
+}
+
+TEST_F(WriteBufferFactoryTest, ShouldKeepBuffersOfManyEndpointsApart)
+{
+    const uint16_t kNumberOfEndpoints = 1000;
+
+    for(uint16_t i = 0; i < kNumberOfEndpoints; ++i)
+    {
+        boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address_v4(0x0A000000 + i % 10), 1000 + i);
+        writeBufferFactory_.get(endpoint).getPayload().setSize(i + 1);
+    }
+
+    ASSERT_EQ(kNumberOfEndpoints, writeBufferFactory_.size());
+
+    for(uint16_t i = 0; i < kNumberOfEndpoints; i += 2)
+    {
+        ASSERT_TRUE(writeBufferFactory_.erase(boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4(0x0A000000 + i % 10), 1000 + i)));
+    }
+
+    ASSERT_EQ(kNumberOfEndpoints / 2, writeBufferFactory_.size());
+
+    for(uint16_t i = 1; i < kNumberOfEndpoints; i += 2)
+    {
+        boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address_v4(0x0A000000 + i % 10), 1000 + i);
+        ASSERT_EQ(i + 1, writeBufferFactory_.get(endpoint).getPayload().getSize());
+    }
+
+    ASSERT_EQ(kNumberOfEndpoints / 2, writeBufferFactory_.size());
+}
+
+TEST_F(WriteBufferFactoryTest, ErasedBufferShouldBeReusedForNextEndpoint)
+{
+    boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string("1.2.3.4"), 1234);
+    boost::asio::ip::udp::endpoint endpoint2(boost::asio::ip::address::from_string("1.2.3.4"), 1235);
+
+    for(size_t i = 0; i < 10; ++i)
+    {
+        writeBufferFactory_.get(i % 2 ? endpoint : endpoint2).insert(samplePayloads_.payload1_);
+        ASSERT_TRUE(writeBufferFactory_.erase(i % 2 ? endpoint : endpoint2));
+    }
+
+    ASSERT_EQ(1, writeBufferFactory_.getNumberOfPooledBuffers());
+    ASSERT_TRUE(WriteBuffer() == writeBufferFactory_.get(endpoint));
+}
+
+TEST_F(WriteBufferFactoryTest, ShouldDistinguishIpv6Endpoints)
+{
+    boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string("::1"), 1234);
+    boost::asio::ip::udp::endpoint endpoint2(boost::asio::ip::address::from_string("fe80::1"), 1234);
+
+    writeBufferFactory_.get(endpoint).insert(samplePayloads_.payload1_);
+
+    ASSERT_TRUE(WriteBuffer() == writeBufferFactory_.get(endpoint2));
+    ASSERT_FALSE(WriteBuffer() == writeBufferFactory_.get(endpoint));
+    ASSERT_FALSE(writeBufferFactory_.erase(boost::asio::ip::udp::endpoint(boost::asio::ip::address::from_string("::1"), 1235)));
+}
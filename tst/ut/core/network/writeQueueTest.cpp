@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <core/network/writeQueue.hpp>
+#include <ut/core/network/samplePayloads.hpp>
+
+using eMU::ut::env::core::network::SamplePayloads;
+using eMU::core::network::WriteQueue;
+using eMU::core::network::Payload;
+
+class WriteQueueTest: public ::testing::Test
+{
+protected:
+    std::vector<uint8_t> gather()
+    {
+        const WriteQueue::BufferSequence &buffers = writeQueue_.getBuffers();
+
+        std::vector<uint8_t> data(boost::asio::buffer_size(buffers));
+        boost::asio::buffer_copy(boost::asio::buffer(data), buffers);
+
+        return data;
+    }
+
+    SamplePayloads samplePayloads_;
+    WriteQueue writeQueue_;
+};
+
+TEST_F(WriteQueueTest, construct)
+{
+    EXPECT_TRUE(writeQueue_.empty());
+    EXPECT_FALSE(writeQueue_.isPending());
+    EXPECT_TRUE(writeQueue_.getBuffers().empty());
+}
+
+TEST_F(WriteQueueTest, pushedPayloadsShouldBeSpreadOverSegments)
+{
+    writeQueue_.push(samplePayloads_.halfFilledPayload_);
+    writeQueue_.push(samplePayloads_.fullFilledPayload_);
+
+    ASSERT_EQ(samplePayloads_.halfFilledPayload_.getSize() + samplePayloads_.fullFilledPayload_.getSize(), writeQueue_.getSize());
+    ASSERT_EQ(2, writeQueue_.getBuffers().size());
+
+    std::vector<uint8_t> data = this->gather();
+    EXPECT_EQ(memcmp(&samplePayloads_.halfFilledPayload_[0], &data[0], samplePayloads_.halfFilledPayload_.getSize()), 0);
+    EXPECT_EQ(memcmp(&samplePayloads_.fullFilledPayload_[0], &data[samplePayloads_.halfFilledPayload_.getSize()], samplePayloads_.fullFilledPayload_.getSize()), 0);
+}
+
+TEST_F(WriteQueueTest, consumeShouldSkipSentBytes)
+{
+    writeQueue_.push(samplePayloads_.fullFilledPayload_);
+    writeQueue_.push(samplePayloads_.payload2_);
+
+    size_t bytesTransferred = samplePayloads_.fullFilledPayload_.getSize() + 10;
+    writeQueue_.consume(bytesTransferred);
+
+    ASSERT_EQ(samplePayloads_.payload2_.getSize() - 10, writeQueue_.getSize());
+
+    std::vector<uint8_t> data = this->gather();
+    ASSERT_EQ(writeQueue_.getSize(), data.size());
+    EXPECT_EQ(memcmp(&samplePayloads_.payload2_[10], &data[0], data.size()), 0);
+
+    writeQueue_.consume(data.size());
+
+    EXPECT_TRUE(writeQueue_.empty());
+    EXPECT_TRUE(writeQueue_.getBuffers().empty());
+}
+
+TEST_F(WriteQueueTest, numberOfBuffersPerSendShouldBeLimited)
+{
+    for(size_t i = 0; i <= WriteQueue::getMaxNumberOfBuffersPerSend(); ++i)
+    {
+        writeQueue_.push(samplePayloads_.fullFilledPayload_);
+    }
+
+    ASSERT_EQ(WriteQueue::getMaxNumberOfBuffersPerSend(), writeQueue_.getBuffers().size());
+    ASSERT_EQ((WriteQueue::getMaxNumberOfBuffersPerSend() + 1) * Payload::getMaxSize(), writeQueue_.getSize());
+}
+
+TEST_F(WriteQueueTest, clear)
+{
+    writeQueue_.push(samplePayloads_.fullFilledPayload_);
+    writeQueue_.push(samplePayloads_.fullFilledPayload_);
+    writeQueue_.setPendingState();
+
+    writeQueue_.clear();
+
+    EXPECT_TRUE(writeQueue_.empty());
+    EXPECT_FALSE(writeQueue_.isPending());
+    EXPECT_TRUE(writeQueue_.getBuffers().empty());
+}
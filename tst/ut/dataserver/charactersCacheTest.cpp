@@ -0,0 +1,152 @@
+#include <dataserver/charactersCache.hpp>
+
+#include <gtest/gtest.h>
+#include <thread>
+
+using eMU::dataserver::CharactersCache;
+using eMU::streaming::common::CharacterInfoContainer;
+using eMU::streaming::common::CharacterListInfo;
+
+class CharactersCacheTest: public ::testing::Test
+{
+protected:
+    CharactersCacheTest():
+        characters_({CharacterListInfo("andrew", 12, 1, 2, 3, 0), CharacterListInfo("greg", 150, 4, 5, 6, 1)})
+    {
+        cache_.configure(1024 * 1024, std::chrono::minutes(1));
+    }
+
+    void insert(const std::string &accountId)
+    {
+        cache_.insert(accountId, characters_, cache_.getGeneration());
+    }
+
+    bool contains(const std::string &accountId)
+    {
+        CharacterInfoContainer characters;
+        return cache_.find(accountId, characters);
+    }
+
+    CharactersCache cache_;
+    CharacterInfoContainer characters_;
+};
+
+TEST_F(CharactersCacheTest, findShouldReturnInsertedCharacters)
+{
+    this->insert("account");
+
+    CharacterInfoContainer characters;
+    ASSERT_TRUE(cache_.find("account", characters));
+
+    ASSERT_EQ(2, characters.size());
+    EXPECT_EQ("andrew", characters[0].name_);
+    EXPECT_EQ(150, characters[1].level_);
+
+    EXPECT_EQ(1, cache_.getNumberOfHits());
+    EXPECT_EQ(0, cache_.getNumberOfMisses());
+    EXPECT_GT(cache_.getMemorySize(), 0);
+}
+
+TEST_F(CharactersCacheTest, emptyListShouldBeCachedAsWell)
+{
+    cache_.insert("account", CharacterInfoContainer(), cache_.getGeneration());
+
+    CharacterInfoContainer characters = characters_;
+    ASSERT_TRUE(cache_.find("account", characters));
+    EXPECT_TRUE(characters.empty());
+}
+
+TEST_F(CharactersCacheTest, accountIdShouldBeCaseInsensitive)
+{
+    this->insert("Account");
+
+    EXPECT_TRUE(this->contains("aCCOUNT"));
+
+    cache_.invalidate("ACCOUNT");
+
+    EXPECT_FALSE(this->contains("Account"));
+}
+
+TEST_F(CharactersCacheTest, WhenAccountIsNotCachedThenMissShouldBeCounted)
+{
+    EXPECT_FALSE(this->contains("account"));
+
+    EXPECT_EQ(0, cache_.getNumberOfHits());
+    EXPECT_EQ(1, cache_.getNumberOfMisses());
+}
+
+TEST_F(CharactersCacheTest, invalidate)
+{
+    this->insert("account");
+
+    cache_.invalidate("account");
+
+    EXPECT_FALSE(this->contains("account"));
+    EXPECT_EQ(1, cache_.getNumberOfInvalidations());
+    EXPECT_EQ(0, cache_.size());
+    EXPECT_EQ(0, cache_.getMemorySize());
+}
+
+TEST_F(CharactersCacheTest, WhenInvalidationHappenedAfterGenerationWasTakenThenInsertShouldBeIgnored)
+{
+    uint64_t generation = cache_.getGeneration();
+    cache_.invalidate("account");
+
+    cache_.insert("account", characters_, generation);
+
+    EXPECT_FALSE(this->contains("account"));
+}
+
+TEST_F(CharactersCacheTest, WhenTimeToLiveIsExceededThenEntryShouldBeDropped)
+{
+    cache_.configure(1024 * 1024, std::chrono::milliseconds(1));
+    this->insert("account");
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    EXPECT_FALSE(this->contains("account"));
+    EXPECT_EQ(1, cache_.getNumberOfEvictions());
+    EXPECT_EQ(0, cache_.size());
+}
+
+TEST_F(CharactersCacheTest, WhenMemoryLimitIsExceededThenLeastRecentlyUsedEntryShouldBeEvicted)
+{
+    this->insert("first");
+    size_t entrySize = cache_.getMemorySize();
+
+    cache_.configure(2 * entrySize, std::chrono::minutes(1));
+    this->insert("second");
+
+    ASSERT_TRUE(this->contains("first"));
+
+    this->insert("third");
+
+    EXPECT_EQ(2, cache_.size());
+    EXPECT_EQ(1, cache_.getNumberOfEvictions());
+    EXPECT_TRUE(this->contains("first"));
+    EXPECT_FALSE(this->contains("second"));
+    EXPECT_TRUE(this->contains("third"));
+    EXPECT_LE(cache_.getMemorySize(), 2 * entrySize);
+}
+
+TEST_F(CharactersCacheTest, WhenCacheIsDisabledThenNothingShouldBeCached)
+{
+    cache_.configure(0, std::chrono::minutes(1));
+    this->insert("account");
+
+    EXPECT_FALSE(cache_.isEnabled());
+    EXPECT_FALSE(this->contains("account"));
+    EXPECT_EQ(0, cache_.getNumberOfMisses());
+}
+
+TEST_F(CharactersCacheTest, reinsertShouldReplaceEntry)
+{
+    this->insert("account");
+    cache_.insert("account", {CharacterListInfo("newbie", 1, 0, 0, 0, 0)}, cache_.getGeneration());
+
+    CharacterInfoContainer characters;
+    ASSERT_TRUE(cache_.find("account", characters));
+    ASSERT_EQ(1, characters.size());
+    EXPECT_EQ("newbie", characters[0].name_);
+    EXPECT_EQ(1, cache_.size());
+}
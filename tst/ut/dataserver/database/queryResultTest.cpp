@@ -0,0 +1,91 @@
+#include <dataserver/database/queryResult.hpp>
+
+#include <gtest/gtest.h>
+
+using eMU::dataserver::database::QueryResult;
+using eMU::dataserver::database::Row;
+
+class QueryResultTest: public ::testing::Test
+{
+protected:
+    QueryResultTest():
+        queryResult_({{"id", 0}, {"name", 1}, {"balance", 2}})
+    {
+        queryResult_.createRow();
+        queryResult_.insert("17"); queryResult_.insert("andrew"); queryResult_.insert("-4500");
+
+        queryResult_.createRow();
+        queryResult_.insert("65535"); queryResult_.insert(""); queryResult_.insert("");
+    }
+
+    QueryResult queryResult_;
+};
+
+TEST_F(QueryResultTest, emptyResult)
+{
+    QueryResult queryResult;
+
+    EXPECT_EQ(0, queryResult.getNumberOfRows());
+    EXPECT_TRUE(queryResult.getRows().empty());
+    EXPECT_FALSE(queryResult.getRows().begin() != queryResult.getRows().end());
+}
+
+TEST_F(QueryResultTest, valuesShouldBeAccessibleByIndexAndByName)
+{
+    ASSERT_EQ(2, queryResult_.getRows().size());
+
+    Row row = queryResult_.getRows()[0];
+    ASSERT_EQ(3, row.getNumberOfValues());
+    EXPECT_EQ(17, row.getValue<uint32_t>(0));
+    EXPECT_EQ("andrew", row.getValue<std::string>(1));
+    EXPECT_EQ(-4500, row.getValue<int32_t>("balance"));
+
+    row = queryResult_.getRow(1);
+    EXPECT_EQ(65535, row.getValue<uint16_t>("id"));
+    EXPECT_EQ("", row.getValue<std::string>("name"));
+}
+
+TEST_F(QueryResultTest, fieldIndexShouldBeResolvedOnce)
+{
+    size_t name = queryResult_.getFieldIndex("name");
+    std::vector<std::string> names;
+
+    for(const auto &row : queryResult_.getRows())
+    {
+        names.push_back(row.getValue<std::string>(name));
+    }
+
+    ASSERT_EQ(2, names.size());
+    EXPECT_EQ("andrew", names[0]);
+    EXPECT_EQ("", names[1]);
+}
+
+TEST_F(QueryResultTest, unknownFieldShouldThrow)
+{
+    EXPECT_THROW(queryResult_.getFieldIndex("unknown"), std::out_of_range);
+    EXPECT_THROW(queryResult_.getRow(0).getValue<uint32_t>("unknown"), std::out_of_range);
+}
+
+TEST_F(QueryResultTest, missingEmptyOrMalformedValuesShouldBeDefault)
+{
+    QueryResult queryResult;
+    queryResult.createRow();
+    queryResult.insert("12a");
+
+    EXPECT_EQ(0, queryResult.getRow(0).getValue<uint32_t>(0));
+    EXPECT_EQ(0, queryResult.getRow(0).getValue<uint32_t>(1));
+    EXPECT_EQ("", queryResult.getRow(0).getValue<std::string>(1));
+    EXPECT_EQ(0, queryResult_.getRow(1).getValue<int32_t>("balance"));
+}
+
+TEST_F(QueryResultTest, rowsWithDifferentNumberOfValues)
+{
+    QueryResult queryResult;
+    queryResult.createRow();
+    queryResult.createRow();
+    queryResult.insert("1");
+
+    EXPECT_EQ(0, queryResult.getRow(0).getNumberOfValues());
+    EXPECT_EQ(1, queryResult.getRow(1).getNumberOfValues());
+    EXPECT_EQ(1, queryResult.getRow(1).getValue<uint32_t>(0));
+}
@@ -1 +1 @@
-#include <ut/dataserver/database/sqlInterfaceMock.hpp>
+#include <ut/dataserver/database/sqlInterfaceMock.hpp>
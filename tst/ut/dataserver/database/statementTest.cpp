@@ -0,0 +1,21 @@
+#include <dataserver/database/statement.hpp>
+
+#include <gtest/gtest.h>
+
+using eMU::dataserver::database::Statement;
+
+TEST(StatementTest, numberOfParameters)
+{
+    EXPECT_EQ(3, Statement::getNumberOfParameters(Statement::CHECK_ACCOUNT));
+    EXPECT_EQ(1, Statement::getNumberOfParameters(Statement::CHARACTERS_LIST));
+    EXPECT_EQ(10, Statement::getNumberOfParameters(Statement::CHARACTER_CREATE));
+    EXPECT_EQ(Statement::kMaxBatchSize, Statement::getNumberOfParameters(Statement::CHARACTERS_LIST_BATCH));
+}
+
+TEST(StatementTest, textsShouldNotBeEmpty)
+{
+    for(size_t id = 0; id < Statement::NUMBER_OF_STATEMENTS; ++id)
+    {
+        EXPECT_FALSE(Statement::getText(static_cast<Statement::Id>(id)).empty());
+    }
+}
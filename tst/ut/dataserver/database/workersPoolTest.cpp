@@ -0,0 +1,154 @@
+#include <dataserver/database/workersPool.hpp>
+#include <ut/dataserver/database/sqlInterfaceMock.hpp>
+
+#include <gtest/gtest.h>
+#include <condition_variable>
+#include <thread>
+#include <set>
+
+using ::testing::Return;
+using ::testing::AnyNumber;
+using ::testing::AtLeast;
+using ::testing::Invoke;
+
+using eMU::dataserver::database::WorkersPool;
+using eMU::dataserver::database::SqlInterface;
+using eMU::ut::env::dataserver::database::SqlInterfaceMock;
+
+class WorkersPoolTest: public ::testing::Test
+{
+protected:
+    WorkersPoolTest():
+        workersPool_({&firstSqlInterface_, &secondSqlInterface_}) {}
+
+    SqlInterfaceMock firstSqlInterface_;
+    SqlInterfaceMock secondSqlInterface_;
+    WorkersPool workersPool_;
+};
+
+TEST_F(WorkersPoolTest, jobsPostedBeforeStartShouldBeExecutedInPlaceOnFirstConnection)
+{
+    SqlInterface *usedSqlInterface = nullptr;
+    std::thread::id executingThread;
+
+    workersPool_.post([&](SqlInterface &sqlInterface) { usedSqlInterface = &sqlInterface; executingThread = std::this_thread::get_id(); });
+
+    EXPECT_EQ(&firstSqlInterface_, usedSqlInterface);
+    EXPECT_EQ(std::this_thread::get_id(), executingThread);
+    EXPECT_EQ(1, workersPool_.getNumberOfExecutedJobs());
+    EXPECT_EQ(0, workersPool_.getQueueDepth());
+}
+
+TEST_F(WorkersPoolTest, startedPoolShouldExecuteJobsOnWorkerThreadsAndDrainQueueAtStop)
+{
+    const size_t numberOfJobs = 1000;
+
+    std::mutex mutex;
+    std::set<SqlInterface*> usedSqlInterfaces;
+    std::set<std::thread::id> executingThreads;
+
+    workersPool_.start();
+
+    for(size_t i = 0; i < numberOfJobs; ++i)
+    {
+        workersPool_.post([&](SqlInterface &sqlInterface)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            usedSqlInterfaces.insert(&sqlInterface);
+            executingThreads.insert(std::this_thread::get_id());
+        });
+    }
+
+    workersPool_.stop();
+
+    EXPECT_EQ(numberOfJobs, workersPool_.getNumberOfExecutedJobs());
+    EXPECT_EQ(0, workersPool_.getQueueDepth());
+    EXPECT_GE(workersPool_.getMaxQueueDepth(), 1);
+    EXPECT_EQ(0, executingThreads.count(std::this_thread::get_id()));
+    EXPECT_LE(executingThreads.size(), workersPool_.getNumberOfWorkers());
+
+    for(SqlInterface *sqlInterface : usedSqlInterfaces)
+    {
+        EXPECT_TRUE(sqlInterface == &firstSqlInterface_ || sqlInterface == &secondSqlInterface_);
+    }
+}
+
+TEST_F(WorkersPoolTest, numberOfWorkersShouldBeEqualToNumberOfConnections)
+{
+    EXPECT_EQ(2, workersPool_.getNumberOfWorkers());
+}
+
+TEST_F(WorkersPoolTest, idleWorkersShouldCheckHealthOfTheirConnections)
+{
+    std::mutex mutex;
+    std::condition_variable checked;
+    std::set<SqlInterface*> checkedSqlInterfaces;
+
+    auto markChecked = [&](SqlInterface *sqlInterface)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        checkedSqlInterfaces.insert(sqlInterface);
+        checked.notify_one();
+
+        return true;
+    };
+
+    EXPECT_CALL(firstSqlInterface_, isAlive()).Times(AtLeast(1)).WillRepeatedly(Invoke(std::bind(markChecked, &firstSqlInterface_)));
+    EXPECT_CALL(secondSqlInterface_, isAlive()).Times(AtLeast(1)).WillRepeatedly(Invoke(std::bind(markChecked, &secondSqlInterface_)));
+
+    workersPool_.setHealthCheckInterval(std::chrono::milliseconds(1));
+    workersPool_.start();
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(checked.wait_for(lock, std::chrono::seconds(5), [&]() { return checkedSqlInterfaces.size() == 2; }));
+    }
+
+    workersPool_.stop();
+
+    EXPECT_GE(workersPool_.getNumberOfHealthChecks(), 2);
+    EXPECT_EQ(0, workersPool_.getNumberOfFailedHealthChecks());
+}
+
+TEST_F(WorkersPoolTest, connectionWhichIsNotAliveShouldBeReconnectedByHealthCheck)
+{
+    std::mutex mutex;
+    std::condition_variable reconnected;
+    bool reconnectCalled = false;
+
+    EXPECT_CALL(firstSqlInterface_, isAlive()).Times(AnyNumber()).WillRepeatedly(Return(false));
+    EXPECT_CALL(firstSqlInterface_, getErrorMessage()).Times(AnyNumber()).WillRepeatedly(Return("lost"));
+    EXPECT_CALL(firstSqlInterface_, reconnect()).Times(AtLeast(1)).WillRepeatedly(Invoke([&]()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        reconnectCalled = true;
+        reconnected.notify_one();
+
+        return false;
+    }));
+
+    WorkersPool workersPool({&firstSqlInterface_});
+    workersPool.setHealthCheckInterval(std::chrono::milliseconds(1));
+    workersPool.start();
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(reconnected.wait_for(lock, std::chrono::seconds(5), [&]() { return reconnectCalled; }));
+    }
+
+    workersPool.stop();
+
+    EXPECT_GE(workersPool.getNumberOfFailedHealthChecks(), 1);
+}
+
+TEST_F(WorkersPoolTest, healthChecksShouldBeDisabledByDefault)
+{
+    EXPECT_CALL(firstSqlInterface_, isAlive()).Times(0);
+    EXPECT_CALL(secondSqlInterface_, isAlive()).Times(0);
+
+    workersPool_.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    workersPool_.stop();
+
+    EXPECT_EQ(0, workersPool_.getNumberOfHealthChecks());
+}
@@ -0,0 +1,125 @@
+#include <dataserver/requestsBatcher.hpp>
+#include <ut/dataserver/database/sqlInterfaceMock.hpp>
+#include <ut/core/network/tcp/connectionMock.hpp>
+
+#include <gtest/gtest.h>
+#include <future>
+
+using eMU::dataserver::RequestsBatcher;
+using eMU::dataserver::database::WorkersPool;
+using eMU::dataserver::database::SqlInterface;
+using eMU::ut::env::dataserver::database::SqlInterfaceMock;
+using eMU::ut::env::core::network::tcp::ConnectionMock;
+
+class RequestsBatcherTest: public ::testing::Test
+{
+protected:
+    typedef RequestsBatcher<uint32_t> Batcher;
+
+    RequestsBatcherTest():
+        workersPool_({&sqlInterface_}),
+        batcher_(workersPool_, std::bind(&RequestsBatcherTest::handle, this, std::placeholders::_1, std::placeholders::_2)),
+        connection_(new ConnectionMock()) {}
+
+    void handle(SqlInterface &sqlInterface, const Batcher::Batch &batch)
+    {
+        std::vector<uint32_t> requests;
+
+        for(const auto &entry : batch)
+        {
+            EXPECT_EQ(connection_, entry.connection_);
+            requests.push_back(entry.request_);
+        }
+
+        batches_.push_back(requests);
+    }
+
+    // single worker is kept busy so requests queue up behind it
+    void blockWorker()
+    {
+        std::shared_future<void> released = release_.get_future().share();
+        workersPool_.post([released](SqlInterface&) { released.wait(); });
+    }
+
+    SqlInterfaceMock sqlInterface_;
+    WorkersPool workersPool_;
+    Batcher batcher_;
+    ConnectionMock::Pointer connection_;
+    std::promise<void> release_;
+    std::vector<std::vector<uint32_t>> batches_;
+};
+
+TEST_F(RequestsBatcherTest, batchingShouldBeDisabledByDefault)
+{
+    EXPECT_FALSE(batcher_.isEnabled());
+
+    batcher_.configure(4, std::chrono::microseconds(0));
+    EXPECT_TRUE(batcher_.isEnabled());
+
+    batcher_.configure(0, std::chrono::microseconds(0));
+    EXPECT_FALSE(batcher_.isEnabled());
+}
+
+TEST_F(RequestsBatcherTest, requestShouldBeFlushedInPlaceWhenWorkersAreNotStarted)
+{
+    batcher_.configure(4, std::chrono::microseconds(0));
+
+    batcher_.add(connection_, 1);
+    batcher_.add(connection_, 2);
+
+    ASSERT_EQ(2, batches_.size());
+    EXPECT_EQ(std::vector<uint32_t>({1}), batches_[0]);
+    EXPECT_EQ(std::vector<uint32_t>({2}), batches_[1]);
+}
+
+TEST_F(RequestsBatcherTest, requestsQueuedWhileWorkerIsBusyShouldBeCoalesced)
+{
+    batcher_.configure(4, std::chrono::microseconds(0));
+    workersPool_.start();
+    this->blockWorker();
+
+    for(uint32_t i = 0; i < 10; ++i)
+    {
+        batcher_.add(connection_, i);
+    }
+
+    release_.set_value();
+    workersPool_.stop();
+
+    ASSERT_EQ(3, batches_.size());
+    EXPECT_EQ(std::vector<uint32_t>({0, 1, 2, 3}), batches_[0]);
+    EXPECT_EQ(std::vector<uint32_t>({4, 5, 6, 7}), batches_[1]);
+    EXPECT_EQ(std::vector<uint32_t>({8, 9}), batches_[2]);
+
+    EXPECT_EQ(10, batcher_.getNumberOfRequests());
+    EXPECT_EQ(3, batcher_.getNumberOfBatches());
+    EXPECT_EQ(4, batcher_.getLargestBatchSize());
+}
+
+TEST_F(RequestsBatcherTest, flushShouldWaitForBatchToFillWithinLatency)
+{
+    batcher_.configure(3, std::chrono::seconds(10));
+    workersPool_.start();
+
+    batcher_.add(connection_, 1);
+    batcher_.add(connection_, 2);
+    batcher_.add(connection_, 3);
+
+    workersPool_.stop();
+
+    ASSERT_EQ(1, batches_.size());
+    EXPECT_EQ(std::vector<uint32_t>({1, 2, 3}), batches_[0]);
+}
+
+TEST_F(RequestsBatcherTest, incompleteBatchShouldBeFlushedAfterLatency)
+{
+    batcher_.configure(3, std::chrono::milliseconds(5));
+    workersPool_.start();
+
+    batcher_.add(connection_, 1);
+
+    workersPool_.stop();
+
+    ASSERT_EQ(1, batches_.size());
+    EXPECT_EQ(std::vector<uint32_t>({1}), batches_[0]);
+}
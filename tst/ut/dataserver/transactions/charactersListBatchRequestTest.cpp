@@ -0,0 +1,170 @@
+#include <dataserver/transactions/charactersListBatchRequest.hpp>
+
+#include <streaming/readStream.hpp>
+#include <streaming/dataserver/streamIds.hpp>
+#include <streaming/dataserver/charactersListRequest.hpp>
+#include <streaming/dataserver/charactersListResponse.hpp>
+#include <streaming/dataserver/faultIndication.hpp>
+
+#include <ut/dataserver/database/sqlInterfaceMock.hpp>
+#include <ut/core/network/tcp/connectionMock.hpp>
+
+#include <gtest/gtest.h>
+
+using ::testing::_;
+using ::testing::Return;
+using ::testing::SaveArg;
+
+using eMU::ut::env::core::network::tcp::ConnectionMock;
+using eMU::ut::env::dataserver::database::SqlInterfaceMock;
+
+using eMU::dataserver::CharactersCache;
+using eMU::dataserver::database::QueryResult;
+using eMU::dataserver::database::Statement;
+namespace transactions = eMU::dataserver::transactions;
+
+using eMU::streaming::ReadStream;
+namespace streamIds = eMU::streaming::dataserver::streamIds;
+
+using eMU::streaming::dataserver::CharactersListRequest;
+using eMU::streaming::dataserver::CharactersListResponse;
+using eMU::streaming::dataserver::FaultIndication;
+using eMU::streaming::common::CharacterInfoContainer;
+
+using eMU::core::network::Payload;
+using eMU::core::network::tcp::NetworkUser;
+
+class DataserverCharactersListBatchRequestTransactionTest: public ::testing::Test
+{
+protected:
+    DataserverCharactersListBatchRequestTransactionTest():
+        firstConnection_(new ConnectionMock()),
+        secondConnection_(new ConnectionMock())
+    {
+        this->addToBatch(firstConnection_, NetworkUser::Hash(0x100), "andrew");
+        this->addToBatch(secondConnection_, NetworkUser::Hash(0x200), "greg");
+
+        charactersCache_.configure(1024 * 1024, std::chrono::minutes(1));
+    }
+
+    void addToBatch(const ConnectionMock::Pointer &connection, NetworkUser::Hash userHash, const std::string &accountId)
+    {
+        CharactersListRequest request(ReadStream(CharactersListRequest(userHash, accountId).getWriteStream().getPayload()));
+        batch_.push_back(transactions::CharactersListBatchRequest::Batcher::Entry{connection, request, std::chrono::steady_clock::now()});
+    }
+
+    SqlInterfaceMock sqlInterface_;
+    CharactersCache charactersCache_;
+    QueryResult queryResult_;
+    Payload firstPayload_;
+    Payload secondPayload_;
+
+    ConnectionMock::Pointer firstConnection_;
+    ConnectionMock::Pointer secondConnection_;
+    transactions::CharactersListBatchRequest::Batcher::Batch batch_;
+};
+
+TEST_F(DataserverCharactersListBatchRequestTransactionTest, handle)
+{
+    queryResult_ = QueryResult({{"accountId", 0}, {"hairColor", 1}, {"hairType", 2}, {"level", 3},
+                                {"name", 4}, {"race", 5}, {"tutorialState", 6}});
+
+    queryResult_.createRow();
+    queryResult_.insert("Greg"); queryResult_.insert("55"); queryResult_.insert("64"); queryResult_.insert("178"); queryResult_.insert("gregor"); queryResult_.insert("81"); queryResult_.insert("1");
+
+    queryResult_.createRow();
+    queryResult_.insert("andrew"); queryResult_.insert("12"); queryResult_.insert("23"); queryResult_.insert("45"); queryResult_.insert("andy"); queryResult_.insert("44"); queryResult_.insert("0");
+
+    queryResult_.createRow();
+    queryResult_.insert("greg"); queryResult_.insert("1"); queryResult_.insert("2"); queryResult_.insert("3"); queryResult_.insert("greggy"); queryResult_.insert("4"); queryResult_.insert("5");
+
+    Statement::Parameters parameters(Statement::kMaxBatchSize, std::string("andrew"));
+    parameters[1] = std::string("greg");
+
+    EXPECT_CALL(sqlInterface_, isConnected()).WillOnce(Return(true));
+    EXPECT_CALL(sqlInterface_, executeStatement(Statement::CHARACTERS_LIST_BATCH, parameters)).WillOnce(Return(true));
+    EXPECT_CALL(sqlInterface_, fetchQueryResult()).WillOnce(Return(queryResult_));
+    EXPECT_CALL(*firstConnection_, send(_)).WillOnce(SaveArg<0>(&firstPayload_));
+    EXPECT_CALL(*secondConnection_, send(_)).WillOnce(SaveArg<0>(&secondPayload_));
+
+    transactions::CharactersListBatchRequest(sqlInterface_, batch_, charactersCache_).handle();
+
+    ReadStream firstStream(firstPayload_);
+    ASSERT_EQ(streamIds::kCharactersListResponse, firstStream.getId());
+    CharactersListResponse firstResponse(firstStream);
+
+    ASSERT_EQ(NetworkUser::Hash(0x100), firstResponse.getUserHash());
+    ASSERT_EQ(1, firstResponse.getCharacters().size());
+    EXPECT_EQ("andy", firstResponse.getCharacters()[0].name_);
+    EXPECT_EQ(45, firstResponse.getCharacters()[0].level_);
+
+    ReadStream secondStream(secondPayload_);
+    ASSERT_EQ(streamIds::kCharactersListResponse, secondStream.getId());
+    CharactersListResponse secondResponse(secondStream);
+
+    ASSERT_EQ(NetworkUser::Hash(0x200), secondResponse.getUserHash());
+    ASSERT_EQ(2, secondResponse.getCharacters().size());
+    EXPECT_EQ("gregor", secondResponse.getCharacters()[0].name_);
+    EXPECT_EQ(178, secondResponse.getCharacters()[0].level_);
+    EXPECT_EQ("greggy", secondResponse.getCharacters()[1].name_);
+    EXPECT_EQ(5, secondResponse.getCharacters()[1].tutorialState_);
+
+    CharacterInfoContainer characters;
+    ASSERT_TRUE(charactersCache_.find("greg", characters));
+    EXPECT_EQ(2, characters.size());
+    ASSERT_TRUE(charactersCache_.find("andrew", characters));
+    EXPECT_EQ(1, characters.size());
+}
+
+TEST_F(DataserverCharactersListBatchRequestTransactionTest, WhenQueryResultIsEmptyThenEmptyListsShouldBeSent)
+{
+    EXPECT_CALL(sqlInterface_, isConnected()).WillOnce(Return(true));
+    EXPECT_CALL(sqlInterface_, executeStatement(Statement::CHARACTERS_LIST_BATCH, _)).WillOnce(Return(true));
+    EXPECT_CALL(sqlInterface_, fetchQueryResult()).WillOnce(Return(queryResult_));
+    EXPECT_CALL(*firstConnection_, send(_)).WillOnce(SaveArg<0>(&firstPayload_));
+    EXPECT_CALL(*secondConnection_, send(_)).WillOnce(SaveArg<0>(&secondPayload_));
+
+    transactions::CharactersListBatchRequest(sqlInterface_, batch_, charactersCache_).handle();
+
+    for(const Payload *payload : {&firstPayload_, &secondPayload_})
+    {
+        ReadStream readStream(*payload);
+        ASSERT_EQ(streamIds::kCharactersListResponse, readStream.getId());
+        EXPECT_TRUE(CharactersListResponse(readStream).getCharacters().empty());
+    }
+}
+
+TEST_F(DataserverCharactersListBatchRequestTransactionTest, WhenExecutionOfQueryIsFailedThenFaultIndicationShouldBeSentToEachUser)
+{
+    std::string errorMessage = "database error";
+
+    EXPECT_CALL(sqlInterface_, isConnected()).WillOnce(Return(true));
+    EXPECT_CALL(sqlInterface_, executeStatement(Statement::CHARACTERS_LIST_BATCH, _)).WillOnce(Return(false));
+    EXPECT_CALL(sqlInterface_, getErrorMessage()).WillOnce(Return(errorMessage));
+    EXPECT_CALL(*firstConnection_, send(_)).WillOnce(SaveArg<0>(&firstPayload_));
+    EXPECT_CALL(*secondConnection_, send(_)).WillOnce(SaveArg<0>(&secondPayload_));
+
+    transactions::CharactersListBatchRequest(sqlInterface_, batch_, charactersCache_).handle();
+
+    ReadStream firstStream(firstPayload_);
+    ASSERT_EQ(streamIds::kFaultIndication, firstStream.getId());
+    EXPECT_EQ(NetworkUser::Hash(0x100), FaultIndication(firstStream).getUserHash());
+    EXPECT_EQ(errorMessage, FaultIndication(firstStream).getMessage());
+
+    ReadStream secondStream(secondPayload_);
+    ASSERT_EQ(streamIds::kFaultIndication, secondStream.getId());
+    EXPECT_EQ(NetworkUser::Hash(0x200), FaultIndication(secondStream).getUserHash());
+}
+
+TEST_F(DataserverCharactersListBatchRequestTransactionTest, WhenConnectionToDatabaseIsDiedThenFaultIndicationShouldBeSentToEachUser)
+{
+    EXPECT_CALL(sqlInterface_, isConnected()).WillOnce(Return(false));
+    EXPECT_CALL(sqlInterface_, executeStatement(_, _)).Times(0);
+    EXPECT_CALL(*firstConnection_, send(_)).WillOnce(SaveArg<0>(&firstPayload_));
+    EXPECT_CALL(*secondConnection_, send(_)).WillOnce(SaveArg<0>(&secondPayload_));
+
+    transactions::CharactersListBatchRequest(sqlInterface_, batch_, charactersCache_).handle();
+
+    EXPECT_EQ(streamIds::kFaultIndication, ReadStream(firstPayload_).getId());
+    EXPECT_EQ(streamIds::kFaultIndication, ReadStream(secondPayload_).getId());
+}
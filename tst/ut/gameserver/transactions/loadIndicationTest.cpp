@@ -0,0 +1,50 @@
+#include <gameserver/transactions/loadIndication.hpp>
+#include <streaming/gameserver/loadIndication.hpp>
+#include <streaming/gameserver/streamIds.hpp>
+#include <streaming/readStream.hpp>
+
+#include <ut/core/network/udp/connectionMock.hpp>
+
+#include <gtest/gtest.h>
+
+using ::testing::_;
+using ::testing::SaveArg;
+
+using eMU::streaming::ReadStream;
+using eMU::streaming::gameserver::LoadIndication;
+namespace streamIds = eMU::streaming::gameserver::streamIds;
+using eMU::core::network::Payload;
+
+class GameserverLoadIndicationTransactionTest: public ::testing::Test
+{
+protected:
+    GameserverLoadIndicationTransactionTest():
+        loginserverEndpoint_(boost::asio::ip::udp::endpoint(boost::asio::ip::address::from_string("10.0.0.1"), 55557)),
+        udpConnection_(new eMU::ut::env::core::network::udp::ConnectionMock()),
+        gameserverCode_(7) {}
+
+    boost::asio::ip::udp::endpoint loginserverEndpoint_;
+    eMU::ut::env::core::network::udp::ConnectionMock::Pointer udpConnection_;
+    uint16_t gameserverCode_;
+    Payload payload_;
+};
+
+TEST_F(GameserverLoadIndicationTransactionTest, handle)
+{
+    EXPECT_CALL(*udpConnection_, sendTo(loginserverEndpoint_, _)).WillOnce(SaveArg<1>(&payload_));
+
+    eMU::gameserver::transactions::LoadIndication(loginserverEndpoint_, udpConnection_, gameserverCode_, 42, 300).handle();
+
+    ReadStream readStream(payload_);
+    ASSERT_EQ(streamIds::kLoadIndication, readStream.getId());
+
+    LoadIndication indication(readStream);
+    EXPECT_EQ(gameserverCode_, indication.getGameserverCode());
+    EXPECT_EQ(42, indication.getNumberOfUsers());
+    EXPECT_EQ(300, indication.getMaxNumberOfUsers());
+}
+
+TEST_F(GameserverLoadIndicationTransactionTest, WhenUdpConnectionIsNullptrThenNothingShouldHappen)
+{
+    eMU::gameserver::transactions::LoadIndication(loginserverEndpoint_, nullptr, gameserverCode_, 42, 300).handle();
+}
@@ -1,15 +1,15 @@
-#include <ut/loginserver/gameserversListMock.hpp>
-
-namespace eMU
-{
-namespace ut
-{
-namespace env
-{
-namespace loginserver
-{
-
-}
-}
-}
-}
+#include <ut/loginserver/gameserversListMock.hpp>
+
+namespace eMU
+{
+namespace ut
+{
+namespace env
+{
+namespace loginserver
+{
+
+}
+}
+}
+}
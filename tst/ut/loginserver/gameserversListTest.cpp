@@ -1,95 +1,248 @@
-#include <gtest/gtest.h>
-#include <loginserver/gameserversList.hpp>
-#include <core/common/xmlReader.hpp>
-#include <core/common/exception.hpp>
-
-using eMU::loginserver::GameserversList;
-using eMU::streaming::loginserver::GameserverInfo;
-using eMU::streaming::loginserver::GameserversInfoContainer;
-using eMU::core::common::XmlReader;
-
-class GameserversListTest: public ::testing::Test
-{
-protected:
-    void prepareXmlContent()
-    {
-        xmlContent_ = "<servers> \
-                            <server code=\"0\" name=\"eMU_Test\" address=\"localhost\" port=\"55901\" /> \
-                            <server code=\"20\" name=\"eMU_Test2\" address=\"127.0.0.1\" port=\"55902\" /> \
-                        </servers>";
-    }
-
-    void prepareSampleServers()
-    {
-        GameserverInfo info = {};
-
-        info.address_ = "localhost";
-        info.code_ = 0;
-        info.name_ = "eMU_Test";
-        info.port_ = 55901;
-        sampleServers_.push_back(info);
-
-        info.address_ = "127.0.0.1";
-        info.code_ = 20;
-        info.name_ = "eMU_Test2";
-        info.port_ = 55902;
-        sampleServers_.push_back(info);
-    }
-
-    void compareGameserverInfo(const GameserverInfo &left,
-                               const GameserverInfo &right)
-    {
-        EXPECT_EQ(left.address_, right.address_);
-        EXPECT_EQ(left.code_, right.code_);
-        EXPECT_EQ(left.name_, right.name_);
-        EXPECT_EQ(left.port_, right.port_);
-    }
-
-    void SetUp() {}
-
-    void initialize()
-    {
-        prepareXmlContent();
-
-        XmlReader xmlReader(xmlContent_);
-
-        prepareSampleServers();
-        ASSERT_TRUE(gameserversList_.initialize(xmlReader));
-    }
-
-    std::string xmlContent_;
-    GameserversInfoContainer sampleServers_;
-    GameserversList gameserversList_;
-};
-
-TEST_F(GameserversListTest, initialize)
-{
-    initialize();
-
-    ASSERT_EQ(sampleServers_.size(), gameserversList_.getServers().size());
-
-    for(size_t i = 0; i < sampleServers_.size(); ++i)
-    {
-        compareGameserverInfo(sampleServers_[i], gameserversList_.getServers()[i]);
-    }
-}
-
-TEST_F(GameserversListTest, hasGameserver)
-{
-    initialize();
-
-    EXPECT_TRUE(gameserversList_.hasGameserver(0));
-    EXPECT_TRUE(gameserversList_.hasGameserver(20));
-
-    EXPECT_FALSE(gameserversList_.hasGameserver(21));
-    EXPECT_FALSE(gameserversList_.hasGameserver(3));
-}
-
-TEST_F(GameserversListTest, getGameserverInfo)
-{
-    initialize();
-
-    const GameserverInfo &serverInfo = gameserversList_.getGameserverInfo(20);
-
-    compareGameserverInfo(sampleServers_[1], serverInfo);
-}
+#include <gtest/gtest.h>
+#include <loginserver/gameserversList.hpp>
+#include <core/common/xmlReader.hpp>
+#include <core/common/exception.hpp>
+#include <thread>
+#include <streaming/loginserver/gameserversListResponse.hpp>
+#include <streaming/readStream.hpp>
+
+using eMU::loginserver::GameserversList;
+using eMU::streaming::loginserver::GameserverInfo;
+using eMU::streaming::loginserver::GameserversInfoContainer;
+using eMU::streaming::loginserver::GameserversListResponse;
+using eMU::streaming::ReadStream;
+using eMU::core::common::XmlReader;
+
+class GameserversListTest: public ::testing::Test
+{
+protected:
+    void prepareXmlContent()
+    {
+        xmlContent_ = "<servers> \
+                            <server code=\"0\" name=\"eMU_Test\" address=\"localhost\" port=\"55901\" /> \
+                            <server code=\"20\" name=\"eMU_Test2\" address=\"127.0.0.1\" port=\"55902\" /> \
+                        </servers>";
+    }
+
+    void prepareSampleServers()
+    {
+        GameserverInfo info = {};
+
+        info.address_ = "localhost";
+        info.code_ = 0;
+        info.name_ = "eMU_Test";
+        info.port_ = 55901;
+        sampleServers_.push_back(info);
+
+        info.address_ = "127.0.0.1";
+        info.code_ = 20;
+        info.name_ = "eMU_Test2";
+        info.port_ = 55902;
+        sampleServers_.push_back(info);
+    }
+
+    void compareGameserverInfo(const GameserverInfo &left,
+                               const GameserverInfo &right)
+    {
+        EXPECT_EQ(left.address_, right.address_);
+        EXPECT_EQ(left.code_, right.code_);
+        EXPECT_EQ(left.name_, right.name_);
+        EXPECT_EQ(left.port_, right.port_);
+    }
+
+    void SetUp() {}
+
+    void initialize()
+    {
+        prepareXmlContent();
+
+        XmlReader xmlReader(xmlContent_);
+
+        prepareSampleServers();
+        ASSERT_TRUE(gameserversList_.initialize(xmlReader));
+    }
+
+    std::string xmlContent_;
+    GameserversInfoContainer sampleServers_;
+    GameserversList gameserversList_;
+};
+
+TEST_F(GameserversListTest, initialize)
+{
+    initialize();
+
+    ASSERT_EQ(sampleServers_.size(), gameserversList_.getServers().size());
+
+    for(size_t i = 0; i < sampleServers_.size(); ++i)
+    {
+        compareGameserverInfo(sampleServers_[i], gameserversList_.getServers()[i]);
+    }
+}
+
+TEST_F(GameserversListTest, hasGameserver)
+{
+    initialize();
+
+    EXPECT_TRUE(gameserversList_.hasGameserver(0));
+    EXPECT_TRUE(gameserversList_.hasGameserver(20));
+
+    EXPECT_FALSE(gameserversList_.hasGameserver(21));
+    EXPECT_FALSE(gameserversList_.hasGameserver(3));
+}
+
+TEST_F(GameserversListTest, findGameserverInfo)
+{
+    initialize();
+
+    GameserverInfo serverInfo = {};
+    ASSERT_TRUE(gameserversList_.findGameserverInfo(20, serverInfo));
+
+    compareGameserverInfo(sampleServers_[1], serverInfo);
+    EXPECT_FALSE(gameserversList_.findGameserverInfo(21, serverInfo));
+}
+
+TEST_F(GameserversListTest, listResponseShouldBeEncodedOnInitialize)
+{
+    GameserversList::PayloadPointer emptyListResponse = gameserversList_.getListResponse();
+    ASSERT_TRUE(emptyListResponse != nullptr);
+    EXPECT_TRUE(GameserversListResponse(ReadStream(*emptyListResponse)).getServers().empty());
+
+    initialize();
+
+    GameserversList::PayloadPointer listResponse = gameserversList_.getListResponse();
+    ASSERT_NE(emptyListResponse, listResponse);
+
+    ReadStream readStream(*listResponse);
+    GameserversListResponse response(readStream);
+    ASSERT_EQ(gameserversList_.getServers().size(), response.getServers().size());
+
+    for(size_t i = 0; i < response.getServers().size(); ++i)
+    {
+        EXPECT_EQ(gameserversList_.getServers()[i].code_, response.getServers()[i].code_);
+        EXPECT_EQ(gameserversList_.getServers()[i].name_, response.getServers()[i].name_);
+    }
+
+    EXPECT_EQ(listResponse, gameserversList_.getListResponse());
+}
+
+TEST_F(GameserversListTest, reloadShouldReplaceServersAndKeepReportedLoad)
+{
+    initialize();
+    ASSERT_TRUE(gameserversList_.updateLoad(20, 50, 100));
+
+    XmlReader xmlReader("<servers>"
+                        "<server code=\"20\" name=\"eMU_Test2\" address=\"127.0.0.1\" port=\"55902\"/>"
+                        "<server code=\"30\" name=\"eMU_Test3\" address=\"127.0.0.3\" port=\"55903\"/>"
+                        "</servers>");
+    ASSERT_TRUE(gameserversList_.initialize(xmlReader));
+
+    EXPECT_FALSE(gameserversList_.hasGameserver(0));
+    EXPECT_TRUE(gameserversList_.hasGameserver(30));
+
+    GameserverInfo serverInfo = {};
+    ASSERT_TRUE(gameserversList_.findGameserverInfo(20, serverInfo));
+    EXPECT_EQ(50, serverInfo.load_);
+
+    EXPECT_EQ(2, gameserversList_.getNumberOfLoads());
+}
+
+TEST_F(GameserversListTest, WhenReloadedListHasDuplicatedCodesThenPreviousListShouldBeKept)
+{
+    initialize();
+    GameserversList::PayloadPointer listResponse = gameserversList_.getListResponse();
+
+    XmlReader xmlReader("<servers>"
+                        "<server code=\"5\" name=\"eMU_Test\" address=\"127.0.0.1\" port=\"55901\"/>"
+                        "<server code=\"5\" name=\"eMU_Test2\" address=\"127.0.0.1\" port=\"55902\"/>"
+                        "</servers>");
+    ASSERT_FALSE(gameserversList_.initialize(xmlReader));
+
+    EXPECT_TRUE(gameserversList_.hasGameserver(20));
+    EXPECT_FALSE(gameserversList_.hasGameserver(5));
+    EXPECT_EQ(listResponse, gameserversList_.getListResponse());
+}
+
+TEST_F(GameserversListTest, updateLoadShouldBeAdvertisedInListResponse)
+{
+    initialize();
+
+    EXPECT_TRUE(gameserversList_.updateLoad(20, 3, 4));
+    EXPECT_FALSE(gameserversList_.updateLoad(21, 3, 4));
+
+    GameserversList::PayloadPointer listResponse = gameserversList_.getListResponse();
+    ReadStream readStream(*listResponse);
+    GameserversListResponse response(readStream);
+
+    ASSERT_EQ(2, response.getServers().size());
+    EXPECT_EQ(0, response.getServers()[0].load_);
+    EXPECT_EQ(75, response.getServers()[1].load_);
+
+    EXPECT_TRUE(gameserversList_.updateLoad(20, 3, 4));
+    EXPECT_EQ(listResponse, gameserversList_.getListResponse());
+}
+
+TEST_F(GameserversListTest, WhenRequestedGameserverHasFreeSlotsThenItShouldBeSelected)
+{
+    initialize();
+    gameserversList_.updateLoad(0, 10, 100);
+    gameserversList_.updateLoad(20, 1, 100);
+
+    GameserverInfo serverInfo = {};
+    ASSERT_TRUE(gameserversList_.selectGameserver(0, serverInfo));
+    EXPECT_EQ(0, serverInfo.code_);
+    EXPECT_EQ(0, gameserversList_.getNumberOfRedirections());
+}
+
+TEST_F(GameserversListTest, WhenRequestedGameserverDidNotReportLoadThenItShouldBeSelected)
+{
+    initialize();
+
+    GameserverInfo serverInfo = {};
+    ASSERT_TRUE(gameserversList_.selectGameserver(20, serverInfo));
+    EXPECT_EQ(20, serverInfo.code_);
+
+    EXPECT_FALSE(gameserversList_.selectGameserver(21, serverInfo));
+}
+
+TEST_F(GameserversListTest, WhenRequestedGameserverIsFullThenLeastOccupiedOneShouldBeSelected)
+{
+    XmlReader xmlReader("<servers>"
+                        "<server code=\"1\" name=\"eMU_Test1\" address=\"127.0.0.1\" port=\"55901\"/>"
+                        "<server code=\"2\" name=\"eMU_Test2\" address=\"127.0.0.2\" port=\"55902\"/>"
+                        "<server code=\"3\" name=\"eMU_Test3\" address=\"127.0.0.3\" port=\"55903\"/>"
+                        "<server code=\"4\" name=\"eMU_Test4\" address=\"127.0.0.4\" port=\"55904\"/>"
+                        "</servers>");
+    ASSERT_TRUE(gameserversList_.initialize(xmlReader));
+
+    gameserversList_.updateLoad(1, 100, 100);
+    gameserversList_.updateLoad(2, 80, 100);
+    gameserversList_.updateLoad(3, 10, 20);
+
+    GameserverInfo serverInfo = {};
+    ASSERT_TRUE(gameserversList_.selectGameserver(1, serverInfo));
+    EXPECT_EQ(3, serverInfo.code_);
+    EXPECT_EQ(1, gameserversList_.getNumberOfRedirections());
+}
+
+TEST_F(GameserversListTest, WhenAllGameserversAreFullThenNoneShouldBeSelected)
+{
+    initialize();
+    gameserversList_.updateLoad(0, 100, 100);
+    gameserversList_.updateLoad(20, 5, 0);
+
+    GameserverInfo serverInfo = {};
+    EXPECT_FALSE(gameserversList_.selectGameserver(0, serverInfo));
+}
+
+TEST_F(GameserversListTest, WhenLoadReportIsOutdatedThenLoadShouldBeTreatedAsUnknown)
+{
+    initialize();
+    gameserversList_.setLoadTimeout(std::chrono::milliseconds(1));
+    gameserversList_.updateLoad(0, 100, 100);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    GameserverInfo serverInfo = {};
+    ASSERT_TRUE(gameserversList_.selectGameserver(0, serverInfo));
+    EXPECT_EQ(0, serverInfo.code_);
+}
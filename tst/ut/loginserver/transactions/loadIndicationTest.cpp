@@ -0,0 +1,42 @@
+#include <loginserver/transactions/loadIndication.hpp>
+#include <streaming/gameserver/loadIndication.hpp>
+#include <streaming/readStream.hpp>
+
+#include <ut/loginserver/gameserversListMock.hpp>
+
+#include <gtest/gtest.h>
+
+using ::testing::Return;
+using ::testing::_;
+
+using eMU::streaming::ReadStream;
+using eMU::streaming::gameserver::LoadIndication;
+using eMU::ut::env::loginserver::GameserversListMock;
+
+class LoginserverLoadIndicationTransactionTest: public ::testing::Test
+{
+protected:
+    LoginserverLoadIndicationTransactionTest():
+        gameserverCode_(15),
+        indication_(ReadStream(LoadIndication(gameserverCode_, 120, 500).getWriteStream().getPayload())) {}
+
+    GameserversListMock gameserversList_;
+    uint16_t gameserverCode_;
+    LoadIndication indication_;
+};
+
+TEST_F(LoginserverLoadIndicationTransactionTest, handle)
+{
+    EXPECT_CALL(gameserversList_, hasGameserver(gameserverCode_)).WillOnce(Return(true));
+    EXPECT_CALL(gameserversList_, updateLoad(gameserverCode_, 120, 500)).WillOnce(Return(true));
+
+    eMU::loginserver::transactions::LoadIndication(gameserversList_, indication_).handle();
+}
+
+TEST_F(LoginserverLoadIndicationTransactionTest, WhenGameserverDoesNotExistThenLoadShouldBeIgnored)
+{
+    EXPECT_CALL(gameserversList_, hasGameserver(gameserverCode_)).WillOnce(Return(false));
+    EXPECT_CALL(gameserversList_, updateLoad(_, _, _)).Times(0);
+
+    eMU::loginserver::transactions::LoadIndication(gameserversList_, indication_).handle();
+}
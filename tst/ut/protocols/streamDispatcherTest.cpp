@@ -0,0 +1,79 @@
+#include <protocols/streamDispatcher.hpp>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+using eMU::protocols::StreamDispatcher;
+
+class StreamDispatcherTest: public ::testing::Test
+{
+protected:
+    StreamDispatcherTest():
+        dispatcher_(kStreamIdBase) {}
+
+    static const uint16_t kStreamIdBase = 0x1000;
+
+    StreamDispatcher<int> dispatcher_;
+    std::vector<int> arguments_;
+};
+
+TEST_F(StreamDispatcherTest, RegisteredHandlerShouldBeCalledWithArguments)
+{
+    dispatcher_.registerHandler(kStreamIdBase + 2, [this](int argument) { arguments_.push_back(argument); });
+
+    ASSERT_TRUE(dispatcher_.dispatch(kStreamIdBase + 2, 7));
+    ASSERT_TRUE(dispatcher_.dispatch(kStreamIdBase + 2, 9));
+
+    ASSERT_EQ(std::vector<int>({7, 9}), arguments_);
+}
+
+TEST_F(StreamDispatcherTest, OnlyHandlerOfGivenStreamIdShouldBeCalled)
+{
+    int firstCalls = 0;
+    int secondCalls = 0;
+
+    dispatcher_.registerHandler(kStreamIdBase + 1, [&firstCalls](int) { ++firstCalls; });
+    dispatcher_.registerHandler(kStreamIdBase + 3, [&secondCalls](int) { ++secondCalls; });
+
+    ASSERT_TRUE(dispatcher_.dispatch(kStreamIdBase + 1, 0));
+
+    ASSERT_EQ(1, firstCalls);
+    ASSERT_EQ(0, secondCalls);
+}
+
+TEST_F(StreamDispatcherTest, WhenStreamIdHasNoHandlerThenDispatchShouldFail)
+{
+    dispatcher_.registerHandler(kStreamIdBase + 3, [this](int argument) { arguments_.push_back(argument); });
+
+    ASSERT_FALSE(dispatcher_.dispatch(kStreamIdBase + 2, 0));
+    ASSERT_FALSE(dispatcher_.dispatch(kStreamIdBase + 4, 0));
+    ASSERT_FALSE(dispatcher_.dispatch(kStreamIdBase - 1, 0));
+    ASSERT_FALSE(dispatcher_.dispatch(0, 0));
+    ASSERT_FALSE(dispatcher_.dispatch(0xFFFF, 0));
+
+    ASSERT_TRUE(arguments_.empty());
+}
+
+TEST_F(StreamDispatcherTest, HandledStreamsShouldBeCountedPerStreamId)
+{
+    dispatcher_.registerHandler(kStreamIdBase + 1, [](int) {});
+    dispatcher_.registerHandler(kStreamIdBase + 2, [](int) {});
+
+    // metrics are shared by all dispatchers of given stream id
+    uint64_t firstStreams = dispatcher_.getNumberOfHandledStreams(kStreamIdBase + 1);
+    uint64_t secondStreams = dispatcher_.getNumberOfHandledStreams(kStreamIdBase + 2);
+    uint64_t firstLatencyCount = dispatcher_.getLatency(kStreamIdBase + 1)->getCount();
+
+    dispatcher_.dispatch(kStreamIdBase + 1, 0);
+    dispatcher_.dispatch(kStreamIdBase + 1, 0);
+    dispatcher_.dispatch(kStreamIdBase + 2, 0);
+    dispatcher_.dispatch(kStreamIdBase + 5, 0);
+
+    ASSERT_EQ(2, dispatcher_.getNumberOfHandledStreams(kStreamIdBase + 1) - firstStreams);
+    ASSERT_EQ(1, dispatcher_.getNumberOfHandledStreams(kStreamIdBase + 2) - secondStreams);
+    ASSERT_EQ(2, dispatcher_.getLatency(kStreamIdBase + 1)->getCount() - firstLatencyCount);
+
+    ASSERT_EQ(0, dispatcher_.getNumberOfHandledStreams(kStreamIdBase + 5));
+    ASSERT_EQ(nullptr, dispatcher_.getLatency(kStreamIdBase + 5));
+    ASSERT_EQ(nullptr, dispatcher_.getLatency(kStreamIdBase - 1));
+}
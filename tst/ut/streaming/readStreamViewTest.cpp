@@ -0,0 +1,102 @@
+#include <streaming/readStreamView.hpp>
+#include <streaming/readStream.hpp>
+#include <streaming/writeStream.hpp>
+#include <ut/core/network/samplePayloads.hpp>
+
+#include <gtest/gtest.h>
+
+using eMU::streaming::ReadStreamView;
+using eMU::streaming::ReadStream;
+using eMU::core::network::Payload;
+using eMU::ut::env::core::network::SamplePayloads;
+
+class ReadStreamViewTest: public ::testing::Test
+{
+protected:
+    ReadStreamViewTest():
+        readStreamView_(samplePayloads_.halfFilledPayload_) {}
+
+    SamplePayloads samplePayloads_;
+    ReadStreamView readStreamView_;
+};
+
+TEST_F(ReadStreamViewTest, viewShouldPointIntoPayloadWithoutCopy)
+{
+    ASSERT_EQ(&samplePayloads_.halfFilledPayload_[0], readStreamView_.getData());
+    ASSERT_EQ(samplePayloads_.halfFilledPayload_.getSize(), readStreamView_.getSize());
+}
+
+TEST_F(ReadStreamViewTest, readNext)
+{
+    uint32_t &value1 = reinterpret_cast<uint32_t&>(samplePayloads_.halfFilledPayload_[6]);
+    ASSERT_EQ(value1, readStreamView_.readNext<uint32_t>());
+
+    uint16_t &value2 = reinterpret_cast<uint16_t&>(samplePayloads_.halfFilledPayload_[10]);
+    ASSERT_EQ(value2, readStreamView_.readNext<uint16_t>());
+}
+
+TEST_F(ReadStreamViewTest, readNextShouldThrowExceptionWhenViewEndIsReached)
+{
+    ReadStreamView view(&samplePayloads_.halfFilledPayload_[0], 8);
+
+    ASSERT_EQ(reinterpret_cast<uint16_t&>(samplePayloads_.halfFilledPayload_[6]), view.readNext<uint16_t>());
+    ASSERT_THROW(view.readNext<uint8_t>(), ReadStreamView::OverflowException);
+}
+
+TEST_F(ReadStreamViewTest, readNextStringShouldSkipNullCharacters)
+{
+    samplePayloads_.halfFilledPayload_[6] = 'a';
+    samplePayloads_.halfFilledPayload_[7] = 0;
+    samplePayloads_.halfFilledPayload_[8] = 'b';
+
+    ASSERT_EQ("ab", readStreamView_.readNextString(3));
+}
+
+TEST_F(ReadStreamViewTest, readNextStringShouldThrowExceptionWhenStringLengthIsOutOfBound)
+{
+    ASSERT_THROW(readStreamView_.readNextString(samplePayloads_.halfFilledPayload_.getSize()), ReadStreamView::OverflowException);
+}
+
+TEST_F(ReadStreamViewTest, ownedReadStreamShouldOutliveSourceData)
+{
+    Payload payload = samplePayloads_.halfFilledPayload_;
+    ReadStreamView view(payload);
+    view.readNext<uint32_t>();
+
+    ReadStream readStream(view);
+    payload.clear();
+
+    ASSERT_EQ(reinterpret_cast<uint16_t&>(samplePayloads_.halfFilledPayload_[4]), readStream.getId());
+    ASSERT_EQ(reinterpret_cast<uint16_t&>(samplePayloads_.halfFilledPayload_[10]), readStream.readNext<uint16_t>());
+}
+
+TEST_F(ReadStreamViewTest, copiedReadStreamShouldKeepItsOwnData)
+{
+    ReadStream readStream(samplePayloads_.halfFilledPayload_);
+    readStream.readNext<uint32_t>();
+
+    ReadStream copy(readStream);
+    const ReadStreamView &copyView = copy;
+
+    ASSERT_EQ(&copy.getPayload()[0], copyView.getData());
+    ASSERT_EQ(readStream.readNext<uint16_t>(), copy.readNext<uint16_t>());
+}
+
+TEST_F(ReadStreamViewTest, readNextWideStringAsUtf8)
+{
+    eMU::streaming::WriteStream writeStream(0x1234);
+    writeStream.writeNextWideString(std::string("eMU \xC5\xBC\xC3\xB3\xC5\x82w"));
+    writeStream.writeNext<uint8_t>(0xAB);
+
+    ReadStreamView view(writeStream.getPayload());
+
+    ASSERT_EQ("eMU \xC5\xBC\xC3\xB3\xC5\x82w", view.readNextWideStringAsUtf8(8));
+    ASSERT_EQ(0xAB, view.readNext<uint8_t>());
+}
+
+TEST_F(ReadStreamViewTest, readNextWideStringAsUtf8ShouldThrowExceptionWhenStringLengthIsOutOfBound)
+{
+    ReadStreamView view(&samplePayloads_.halfFilledPayload_[0], 10);
+
+    ASSERT_THROW(view.readNextWideStringAsUtf8(3), ReadStreamView::OverflowException);
+}
@@ -0,0 +1,99 @@
+#include <streaming/schema.hpp>
+#include <streaming/readStreamView.hpp>
+#include <streaming/writeStream.hpp>
+
+#include <gtest/gtest.h>
+
+using eMU::streaming::WriteStream;
+using eMU::streaming::ReadStreamView;
+namespace schema = eMU::streaming::schema;
+
+class SchemaTest: public ::testing::Test
+{
+protected:
+    typedef schema::Message<schema::Value<uint32_t>,
+                            schema::Padding<3>,
+                            schema::Constant<uint8_t, 0x7F>,
+                            schema::WideString<uint32_t>,
+                            schema::Value<uint16_t>,
+                            schema::String<uint8_t>,
+                            schema::FixedString<4>> Layout;
+};
+
+TEST_F(SchemaTest, fixedPrefixShouldEndWithLengthOfFirstString)
+{
+    ASSERT_EQ(12, Layout::kFixedPrefixSize);
+    ASSERT_EQ(16, (schema::Message<schema::Padding<12>, schema::FixedString<4>>::kFixedPrefixSize));
+}
+
+TEST_F(SchemaTest, encodedPayloadShouldMatchFieldByFieldWrites)
+{
+    WriteStream expectedStream(0x1234);
+    expectedStream.writeNext<uint32_t>(0xAABBCCDD);
+    expectedStream.writeNext<uint16_t>(0);
+    expectedStream.writeNext<uint8_t>(0);
+    expectedStream.writeNext<uint8_t>(0x7F);
+    expectedStream.writeNext<uint32_t>(3);
+    expectedStream.writeNextWideString(std::wstring(L"eMU"));
+    expectedStream.writeNext<uint16_t>(55901);
+    expectedStream.writeNext<uint8_t>(4);
+    expectedStream.writeNextString("test");
+    expectedStream.writeNextString("ab");
+    expectedStream.writeNext<uint16_t>(0);
+
+    WriteStream writeStream(0x1234);
+    Layout::encode(writeStream, 0xAABBCCDD, std::string("eMU"), 55901, std::string("test"), std::string("ab"));
+
+    ASSERT_EQ(expectedStream.getPayload().getSize(), writeStream.getPayload().getSize());
+    ASSERT_EQ(0, memcmp(&expectedStream.getPayload()[0], &writeStream.getPayload()[0], writeStream.getPayload().getSize()));
+}
+
+TEST_F(SchemaTest, decodeShouldReadEncodedValues)
+{
+    WriteStream writeStream(0x1234);
+    Layout::encode(writeStream, 0xAABBCCDD, std::string("Za\xC5\xBC\xC3\xB3\xC5\x82\xC4\x87"), 55901, std::string("test"), std::string("abcdef"));
+
+    ReadStreamView readStream(writeStream.getPayload());
+
+    uint32_t value = 0;
+    std::string wideString;
+    uint16_t port = 0;
+    std::string string;
+    std::string fixedString;
+    Layout::decode(readStream, value, wideString, port, string, fixedString);
+
+    ASSERT_EQ(0xAABBCCDD, value);
+    ASSERT_EQ("Za\xC5\xBC\xC3\xB3\xC5\x82\xC4\x87", wideString);
+    ASSERT_EQ(55901, port);
+    ASSERT_EQ("test", string);
+    ASSERT_EQ("abcd", fixedString);
+    ASSERT_THROW(readStream.readNext<uint8_t>(), ReadStreamView::OverflowException);
+}
+
+TEST_F(SchemaTest, decodeShouldThrowExceptionWhenFixedPartIsTruncated)
+{
+    WriteStream writeStream(0x1234);
+    Layout::encode(writeStream, 1, std::string("eMU"), 2, std::string("test"), std::string("ab"));
+
+    ReadStreamView readStream(&writeStream.getPayload()[0], 6 + Layout::kFixedPrefixSize - 1);
+
+    uint32_t value = 0;
+    std::string wideString;
+    uint16_t port = 0;
+    std::string string;
+    std::string fixedString;
+
+    ASSERT_THROW(Layout::decode(readStream, value, wideString, port, string, fixedString), ReadStreamView::OverflowException);
+    ASSERT_EQ(0, value);
+}
+
+TEST_F(SchemaTest, decodeShouldThrowExceptionWhenStringLengthIsOutOfBound)
+{
+    WriteStream writeStream(0x1234);
+    schema::Message<schema::Value<uint32_t>>::encode(writeStream, 100);
+
+    ReadStreamView readStream(writeStream.getPayload());
+    std::string value;
+
+    ASSERT_THROW(schema::Message<schema::String<uint32_t>>::decode(readStream, value), ReadStreamView::OverflowException);
+}
@@ -0,0 +1,113 @@
+#include <streaming/wideStringCodec.hpp>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+using eMU::streaming::WideStringCodec;
+
+class WideStringCodecTest: public ::testing::Test
+{
+protected:
+    std::vector<uint16_t> encode(const std::string &value)
+    {
+        std::vector<uint8_t> bytes(WideStringCodec::getEncodedLength(value) * sizeof(char16_t));
+        WideStringCodec::encode(value, bytes.data());
+
+        std::vector<uint16_t> units;
+
+        for(size_t i = 0; i < bytes.size(); i += sizeof(char16_t))
+        {
+            units.push_back(bytes[i] | (bytes[i + 1] << 8));
+        }
+
+        return units;
+    }
+
+    std::string decode(const std::vector<uint16_t> &units)
+    {
+        std::vector<uint8_t> bytes;
+
+        for(uint16_t unit : units)
+        {
+            bytes.push_back(unit & 0xFF);
+            bytes.push_back(unit >> 8);
+        }
+
+        std::string value;
+        WideStringCodec::decode(bytes.data(), units.size(), value);
+
+        return value;
+    }
+};
+
+TEST_F(WideStringCodecTest, asciiShouldBeEncodedAsLittleEndianUnits)
+{
+    std::vector<uint16_t> expectedUnits = {'e', 'M', 'U', '_', '1'};
+
+    ASSERT_EQ(expectedUnits, this->encode("eMU_1"));
+}
+
+TEST_F(WideStringCodecTest, longAsciiStringShouldBeEncodedAndDecoded)
+{
+    std::string value;
+
+    for(size_t i = 0; i < 100; ++i)
+    {
+        value.push_back('!' + i % 90);
+    }
+
+    std::vector<uint16_t> units = this->encode(value);
+
+    ASSERT_EQ(value.length(), units.size());
+    ASSERT_EQ(value, this->decode(units));
+}
+
+TEST_F(WideStringCodecTest, nonAsciiCharactersShouldBeConvertedBothWays)
+{
+    // "Zażółć gęślą jaźń" - non ASCII characters placed both in and after first 16 bytes
+    std::string value = "Za\xC5\xBC\xC3\xB3\xC5\x82\xC4\x87 g\xC4\x99\xC5\x9Bl\xC4\x85 ja\xC5\xBA\xC5\x84";
+    std::vector<uint16_t> expectedUnits = {'Z', 'a', 0x017C, 0x00F3, 0x0142, 0x0107, ' ', 'g', 0x0119, 0x015B, 'l', 0x0105, ' ', 'j', 'a', 0x017A, 0x0144};
+
+    ASSERT_EQ(expectedUnits, this->encode(value));
+    ASSERT_EQ(value, this->decode(expectedUnits));
+}
+
+TEST_F(WideStringCodecTest, threeBytesCharacterShouldTakeSingleUnit)
+{
+    std::string value = "\xE2\x82\xAC"; // euro sign
+
+    ASSERT_EQ(std::vector<uint16_t>({0x20AC}), this->encode(value));
+    ASSERT_EQ(value, this->decode({0x20AC}));
+}
+
+TEST_F(WideStringCodecTest, supplementaryCharacterShouldBeEncodedAsSurrogatePair)
+{
+    std::string value = "abcdefghijklmnopqrstuvwxyz\xF0\x9F\x98\x80";
+
+    std::vector<uint16_t> units = this->encode(value);
+
+    ASSERT_EQ(28, units.size());
+    ASSERT_EQ(0xD83D, units[26]);
+    ASSERT_EQ(0xDE00, units[27]);
+    ASSERT_EQ(value, this->decode(units));
+}
+
+TEST_F(WideStringCodecTest, invalidUtf8SequencesShouldBeSkipped)
+{
+    std::string value = "a\xFF" "b\xC3" "c\xE0\x80\x80" "d\xED\xA0\x80" "e\xF0\x9F\x98";
+    std::vector<uint16_t> expectedUnits = {'a', 'b', 'c', 'd', 'e'};
+
+    ASSERT_EQ(expectedUnits.size(), WideStringCodec::getEncodedLength(value));
+    ASSERT_EQ(expectedUnits, this->encode(value));
+}
+
+TEST_F(WideStringCodecTest, unpairedSurrogatesShouldBeSkipped)
+{
+    ASSERT_EQ("ab", this->decode({0xD83D, 'a', 0xDE00, 'b', 0xD83D}));
+}
+
+TEST_F(WideStringCodecTest, emptyString)
+{
+    ASSERT_EQ(0, WideStringCodec::getEncodedLength(""));
+    ASSERT_EQ("", this->decode({}));
+}